@@ -153,6 +153,7 @@ const QString SubsurfaceFeatures("SubsurfaceFeatures");
 
 const QString SurfaceMeshCSLBoundary("SurfaceMeshCSLBoundary");
 const QString SurfaceMeshCSLBoundaryIncoherence("SurfaceMeshCSLBoundaryIncoherence");
+const QString SurfaceMeshCSLSigma("SurfaceMeshCSLSigma");
 
 namespace CSL
 {
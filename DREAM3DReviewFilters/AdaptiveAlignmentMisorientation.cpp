@@ -35,7 +35,9 @@
 
 #include "AdaptiveAlignmentMisorientation.h"
 
+#include <cmath>
 #include <fstream>
+#include <limits>
 
 #include <QtCore/QDateTime>
 #include <QtCore/QTextStream>
@@ -46,15 +48,160 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "EbsdLib/LaueOps/LaueOps.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/AdaptiveAlignmentShiftSearch.hpp"
+
+namespace
+{
+constexpr uint32_t k_InvalidSymmetry = std::numeric_limits<uint32_t>::max();
+
+/**
+ * @brief The FindMisorientationShiftsImpl class determines the candidate shifts for a range of adjacent
+ * slice pairs. A pair only reads its own two slices, so pairs are searched concurrently. The crystal
+ * symmetry of every voxel of both slices is resolved once per pair, so evaluating a shift only looks up
+ * the quaternions and calls calculateMisorientation for voxels of matching, valid symmetry.
+ */
+class FindMisorientationShiftsImpl
+{
+public:
+  FindMisorientationShiftsImpl(AbstractFilter* filter, const uint64_t* dims, const float* quats, const int32_t* cellPhases, const bool* goodVoxels, const uint32_t* crystalStructures,
+                               const LaueOpsContainer& orientationOps, float toleranceRad, uint64_t pyramidLevels, uint64_t maxStoredShifts, std::vector<std::vector<int64_t>>& newxshift,
+                               std::vector<std::vector<int64_t>>& newyshift, std::vector<std::vector<float>>& mindisorientation)
+  : m_Filter(filter)
+  , m_Quats(quats)
+  , m_CellPhases(cellPhases)
+  , m_GoodVoxels(goodVoxels)
+  , m_CrystalStructures(crystalStructures)
+  , m_OrientationOps(orientationOps)
+  , m_ToleranceRad(toleranceRad)
+  , m_PyramidLevels(pyramidLevels)
+  , m_MaxStoredShifts(maxStoredShifts)
+  , m_NewXShift(newxshift)
+  , m_NewYShift(newyshift)
+  , m_MinDisorientation(mindisorientation)
+  {
+    m_Dims[0] = dims[0];
+    m_Dims[1] = dims[1];
+    m_Dims[2] = dims[2];
+  }
+
+  void findSliceShifts(uint64_t iter) const
+  {
+    const uint64_t sliceSize = m_Dims[0] * m_Dims[1];
+    const uint64_t slice = (m_Dims[2] - 1) - iter;
+    const uint64_t refOffset = (slice + 1) * sliceSize;
+    const uint64_t curOffset = slice * sliceSize;
+
+    std::vector<uint32_t> refSymmetry(sliceSize);
+    std::vector<uint32_t> curSymmetry(sliceSize);
+    cacheSymmetry(refOffset, refSymmetry);
+    cacheSymmetry(curOffset, curSymmetry);
+
+    auto costFunction = [&](int64_t xshift, int64_t yshift, uint64_t stride) {
+      float disorientation = 0.0f;
+      float count = 0.0f;
+      for(uint64_t l = 0; l < m_Dims[1]; l = l + stride)
+      {
+        const int64_t curRow = static_cast<int64_t>(l) + yshift;
+        if(curRow < 0 || curRow >= static_cast<int64_t>(m_Dims[1]))
+        {
+          continue;
+        }
+        for(uint64_t n = 0; n < m_Dims[0]; n = n + stride)
+        {
+          const int64_t curCol = static_cast<int64_t>(n) + xshift;
+          if(curCol < 0 || curCol >= static_cast<int64_t>(m_Dims[0]))
+          {
+            continue;
+          }
+          count++;
+          const uint64_t refLocal = l * m_Dims[0] + n;
+          const uint64_t curLocal = static_cast<uint64_t>(curRow) * m_Dims[0] + static_cast<uint64_t>(curCol);
+          const uint64_t refposition = refOffset + refLocal;
+          const uint64_t curposition = curOffset + curLocal;
+          if(m_GoodVoxels == nullptr || (m_GoodVoxels[refposition] && m_GoodVoxels[curposition]))
+          {
+            const uint32_t symmetry = refSymmetry[refLocal];
+            if(symmetry == k_InvalidSymmetry || symmetry != curSymmetry[curLocal])
+            {
+              disorientation++;
+            }
+            else
+            {
+              const float* q = m_Quats + refposition * 4;
+              QuatF q1(q[0], q[1], q[2], q[3]);
+              q = m_Quats + curposition * 4;
+              QuatF q2(q[0], q[1], q[2], q[3]);
+              OrientationD axisAngle = m_OrientationOps[symmetry]->calculateMisorientation(q1, q2);
+              if(axisAngle[3] > m_ToleranceRad)
+              {
+                disorientation++;
+              }
+            }
+          }
+          if(m_GoodVoxels != nullptr && m_GoodVoxels[refposition] != m_GoodVoxels[curposition])
+          {
+            disorientation++;
+          }
+        }
+      }
+      return disorientation / count;
+    };
+
+    AdaptiveAlignmentShiftSearch::FindSliceShifts(m_Dims[0], m_Dims[1], m_PyramidLevels, m_MaxStoredShifts, costFunction, m_NewXShift[iter], m_NewYShift[iter], m_MinDisorientation[iter]);
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t iter = range.min(); iter < range.max(); iter++)
+    {
+      if(m_Filter->getCancel())
+      {
+        return;
+      }
+      findSliceShifts(iter);
+    }
+  }
+
+private:
+  void cacheSymmetry(uint64_t offset, std::vector<uint32_t>& symmetry) const
+  {
+    for(size_t i = 0; i < symmetry.size(); i++)
+    {
+      symmetry[i] = k_InvalidSymmetry;
+      const int32_t phase = m_CellPhases[offset + i];
+      if(phase > 0 && m_CrystalStructures[phase] < static_cast<uint32_t>(m_OrientationOps.size()))
+      {
+        symmetry[i] = m_CrystalStructures[phase];
+      }
+    }
+  }
+
+  AbstractFilter* m_Filter = nullptr;
+  uint64_t m_Dims[3] = {0, 0, 0};
+  const float* m_Quats = nullptr;
+  const int32_t* m_CellPhases = nullptr;
+  const bool* m_GoodVoxels = nullptr;
+  const uint32_t* m_CrystalStructures = nullptr;
+  const LaueOpsContainer& m_OrientationOps;
+  float m_ToleranceRad = 0.0f;
+  uint64_t m_PyramidLevels = 1;
+  uint64_t m_MaxStoredShifts = 1;
+  std::vector<std::vector<int64_t>>& m_NewXShift;
+  std::vector<std::vector<int64_t>>& m_NewYShift;
+  std::vector<std::vector<float>>& m_MinDisorientation;
+};
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -86,6 +233,7 @@ void AdaptiveAlignmentMisorientation::setupFilterParameters()
   // getting the current parameters that were set by the parent and adding to it before resetting it
   FilterParameterVectorType parameters = getFilterParameters();
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Misorientation Tolerance (Degrees)", MisorientationTolerance, FilterParameter::Category::Parameter, AdaptiveAlignmentMisorientation));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Pyramid Levels", PyramidLevels, FilterParameter::Category::Parameter, AdaptiveAlignmentMisorientation));
   std::vector<QString> linkedProps = {"GoodVoxelsArrayPath"};
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Mask Array", UseGoodVoxels, FilterParameter::Category::Parameter, AdaptiveAlignmentMisorientation, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
@@ -120,6 +268,7 @@ void AdaptiveAlignmentMisorientation::readFilterParameters(AbstractFilterParamet
   setCrystalStructuresArrayPath(reader->readDataArrayPath("CrystalStructuresArrayPath", getCrystalStructuresArrayPath()));
   setGoodVoxelsArrayPath(reader->readDataArrayPath("GoodVoxelsArrayPath", getGoodVoxelsArrayPath()));
   setUseGoodVoxels(reader->readValue("UseGoodVoxels", getUseGoodVoxels()));
+  setPyramidLevels(reader->readValue("PyramidLevels", getPyramidLevels()));
   setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath()));
   setQuatsArrayPath(reader->readDataArrayPath("QuatsArrayPath", getQuatsArrayPath()));
   setMisorientationTolerance(reader->readValue("MisorientationTolerance", getMisorientationTolerance()));
@@ -153,6 +302,13 @@ void AdaptiveAlignmentMisorientation::dataCheck()
     return;
   }
 
+  if(getPyramidLevels() < 1 || getPyramidLevels() > 8)
+  {
+    QString ss = QObject::tr("The number of pyramid levels must be between 1 and 8, but %1 was entered").arg(getPyramidLevels());
+    setErrorCondition(-3021, ss);
+    return;
+  }
+
   QVector<DataArrayPath> dataArrayPaths;
 
   std::vector<size_t> cDims(1, 4);
@@ -220,8 +376,6 @@ void AdaptiveAlignmentMisorientation::find_shifts(std::vector<int64_t>& xshifts,
     maxstoredshifts = 20;
   }
 
-  float disorientation = 0.0f;
-
   std::vector<std::vector<int64_t>> newxshift(dims[2]);
   std::vector<std::vector<int64_t>> newyshift(dims[2]);
   std::vector<std::vector<float>> mindisorientation(dims[2]);
@@ -232,136 +386,22 @@ void AdaptiveAlignmentMisorientation::find_shifts(std::vector<int64_t>& xshifts,
     mindisorientation[a].resize(maxstoredshifts, std::numeric_limits<float>::max());
   }
 
-  int64_t oldxshift = 0;
-  int64_t oldyshift = 0;
-  float count = 0.0f;
-  uint64_t slice = 0;
-  uint64_t refposition = 0;
-  uint64_t curposition = 0;
-
-  uint32_t phase1 = 0, phase2 = 0;
-  uint64_t progInt = 0;
-
-  // Allocate a 2D Array which will be reused from slice to slice
-  // second dimension is assigned in each cycle separately
-  std::vector<std::vector<bool>> misorients(dims[0]);
-
-  const uint64_t halfDim0 = static_cast<uint64_t>(dims[0] * 0.5f);
-  const uint64_t halfDim1 = static_cast<uint64_t>(dims[1] * 0.5f);
+  QString ss = QObject::tr("Aligning Anisotropic Sections || Determining Shifts");
+  notifyStatusMessage(ss);
 
+  // Each pair of adjacent slices is searched independently
   float misorientationToleranceRad = m_MisorientationTolerance * SIMPLib::Constants::k_PiOver180D;
-  float* currentQuatPtr = nullptr;
-  // Loop over the Z Direction
-  for(uint64_t iter = 1; iter < dims[2]; iter++)
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, dims[2]);
+  dataAlg.execute(FindMisorientationShiftsImpl(this, dims, m_Quats, m_CellPhases, m_UseGoodVoxels ? m_GoodVoxels : nullptr, m_CrystalStructures, m_OrientationOps, misorientationToleranceRad,
+                                               static_cast<uint64_t>(m_PyramidLevels), maxstoredshifts, newxshift, newyshift, mindisorientation));
+  if(getCancel())
   {
-    progInt = static_cast<uint64_t>(iter * 100 / static_cast<float>(dims[2]));
-    QString ss = QObject::tr("Aligning Anisotropic Sections || Determining Shifts || %1% Complete").arg(progInt);
-    notifyStatusMessage(ss);
-    if(getCancel())
-    {
-      return;
-    }
-
-    slice = (dims[2] - 1) - iter;
-    oldxshift = -1;
-    oldyshift = -1;
-
-    for(uint64_t i = 0; i < dims[0]; i++)
-    {
-      misorients[i].assign(dims[1], false);
-    }
-
-    while(newxshift[iter][0] != oldxshift || newyshift[iter][0] != oldyshift)
-    {
-      oldxshift = newxshift[iter][0];
-      oldyshift = newyshift[iter][0];
-
-      for(int32_t j = -3; j <= 3; j++)
-      {
-        for(int32_t k = -3; k <= 3; k++)
-        {
-          disorientation = 0.0f;
-          count = 0.0f;
-          if(llabs(k + oldxshift) < static_cast<int64_t>(halfDim0) && llabs(j + oldyshift) < static_cast<int64_t>(halfDim1) && !misorients[k + oldxshift + halfDim0][j + oldyshift + halfDim1])
-          {
-            for(uint64_t l = 0; l < dims[1]; l = l + 4)
-            {
-              for(uint64_t n = 0; n < dims[0]; n = n + 4)
-              {
-                if(int64_t((l + j + oldyshift)) >= 0 && (l + j + oldyshift) < dims[1] && int64_t((n + k + oldxshift)) >= 0 && (n + k + oldxshift) < dims[0])
-                {
-                  count++;
-                  refposition = ((slice + 1) * dims[0] * dims[1]) + (l * dims[0]) + n;
-                  curposition = (slice * dims[0] * dims[1]) + ((l + j + oldyshift) * dims[0]) + (n + k + oldxshift);
-                  if(!m_UseGoodVoxels || (m_GoodVoxels[refposition] && m_GoodVoxels[curposition]))
-                  {
-                    OrientationD axisAngle(0.0, 0.0, 0.0, std::numeric_limits<double>::max());
-                    if(m_CellPhases[refposition] > 0 && m_CellPhases[curposition] > 0)
-                    {
-                      currentQuatPtr = m_Quats + refposition * 4;
-
-                      QuatF q1(currentQuatPtr[0], currentQuatPtr[1], currentQuatPtr[2], currentQuatPtr[3]);
-                      phase1 = m_CrystalStructures[m_CellPhases[refposition]];
-                      currentQuatPtr = m_Quats + curposition * 4;
-                      QuatF q2(currentQuatPtr[0], currentQuatPtr[1], currentQuatPtr[2], currentQuatPtr[3]);
-                      phase2 = m_CrystalStructures[m_CellPhases[curposition]];
-                      if(phase1 == phase2 && phase1 < static_cast<uint32_t>(m_OrientationOps.size()))
-                      {
-                        axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-                      }
-                    }
-                    if(axisAngle[3] > misorientationToleranceRad)
-                    {
-                      disorientation++;
-                    }
-                  }
-                  if(m_UseGoodVoxels)
-                  {
-                    if(m_GoodVoxels[refposition] && !m_GoodVoxels[curposition])
-                    {
-                      disorientation++;
-                    }
-                    if(!m_GoodVoxels[refposition] && m_GoodVoxels[curposition])
-                    {
-                      disorientation++;
-                    }
-                  }
-                }
-                else
-                {
-                }
-              }
-            }
-
-            disorientation = disorientation / count;
-            misorients[k + oldxshift + halfDim0][j + oldyshift + halfDim1] = true;
-
-            // compare the new shift with currently stored ones
-            int64_t s = maxstoredshifts;
-            while(s - 1 >= 0 && disorientation < mindisorientation[iter][s - 1])
-            {
-              s--;
-            }
+    return;
+  }
 
-            // new shift is stored with index 's' in the arrays
-            if(s < static_cast<int64_t>(maxstoredshifts))
-            {
-              // lag the shifts already stored
-              for(int64_t t = maxstoredshifts - 1; t > s; t--)
-              {
-                newxshift[iter][t] = newxshift[iter][t - 1];
-                newyshift[iter][t] = newyshift[iter][t - 1];
-                mindisorientation[iter][t] = mindisorientation[iter][t - 1];
-              }
-              // store the new shift
-              newxshift[iter][s] = k + oldxshift;
-              newyshift[iter][s] = j + oldyshift;
-              mindisorientation[iter][s] = disorientation;
-            }
-          }
-        }
-      }
-    }
+  for(uint64_t iter = 1; iter < dims[2]; iter++)
+  {
     xshifts[iter] = xshifts[iter - 1] + newxshift[iter][0];
     yshifts[iter] = yshifts[iter - 1] + newyshift[iter][0];
   }
@@ -371,7 +411,7 @@ void AdaptiveAlignmentMisorientation::find_shifts(std::vector<int64_t>& xshifts,
   // find corrected shifts
   if(!xneedshifts.empty())
   {
-    QString ss = QObject::tr("Aligning Anisotropic Sections || Correcting shifts");
+    ss = QObject::tr("Aligning Anisotropic Sections || Correcting shifts");
     notifyStatusMessage(ss);
 
     std::vector<float> changedisorientation(dims[2], 0);
@@ -492,7 +532,7 @@ void AdaptiveAlignmentMisorientation::find_shifts(std::vector<int64_t>& xshifts,
     outFile.open(getAlignmentShiftFileName().toLatin1().data());
     for(uint64_t iter = 1; iter < dims[2]; iter++)
     {
-      slice = (dims[2] - 1) - iter;
+      uint64_t slice = (dims[2] - 1) - iter;
       xshifts[iter] = xshifts[iter - 1] + newxshift[iter][curindex[iter]];
       yshifts[iter] = yshifts[iter - 1] + newyshift[iter][curindex[iter]];
       outFile << slice << "	" << slice + 1 << "	" << newxshift[iter][curindex[iter]] << "	" << newyshift[iter][curindex[iter]] << "	" << xshifts[iter] << "	" << yshifts[iter] << "\n";
@@ -727,6 +767,18 @@ bool AdaptiveAlignmentMisorientation::getUseGoodVoxels() const
   return m_UseGoodVoxels;
 }
 
+// -----------------------------------------------------------------------------
+void AdaptiveAlignmentMisorientation::setPyramidLevels(int value)
+{
+  m_PyramidLevels = value;
+}
+
+// -----------------------------------------------------------------------------
+int AdaptiveAlignmentMisorientation::getPyramidLevels() const
+{
+  return m_PyramidLevels;
+}
+
 // -----------------------------------------------------------------------------
 void AdaptiveAlignmentMisorientation::setQuatsArrayPath(const DataArrayPath& value)
 {
@@ -62,6 +62,7 @@ class DREAM3DReview_EXPORT AdaptiveAlignmentMisorientation : public AdaptiveAlig
   PYB11_FILTER_NEW_MACRO(AdaptiveAlignmentMisorientation)
   PYB11_PROPERTY(float MisorientationTolerance READ getMisorientationTolerance WRITE setMisorientationTolerance)
   PYB11_PROPERTY(bool UseGoodVoxels READ getUseGoodVoxels WRITE setUseGoodVoxels)
+  PYB11_PROPERTY(int PyramidLevels READ getPyramidLevels WRITE setPyramidLevels)
   PYB11_PROPERTY(DataArrayPath QuatsArrayPath READ getQuatsArrayPath WRITE setQuatsArrayPath)
   PYB11_PROPERTY(DataArrayPath CellPhasesArrayPath READ getCellPhasesArrayPath WRITE setCellPhasesArrayPath)
   PYB11_PROPERTY(DataArrayPath GoodVoxelsArrayPath READ getGoodVoxelsArrayPath WRITE setGoodVoxelsArrayPath)
@@ -112,6 +113,17 @@ public:
   bool getUseGoodVoxels() const;
   Q_PROPERTY(bool UseGoodVoxels READ getUseGoodVoxels WRITE setUseGoodVoxels)
 
+  /**
+   * @brief Setter property for PyramidLevels
+   */
+  void setPyramidLevels(int value);
+  /**
+   * @brief Getter property for PyramidLevels
+   * @return Value of PyramidLevels
+   */
+  int getPyramidLevels() const;
+  Q_PROPERTY(int PyramidLevels READ getPyramidLevels WRITE setPyramidLevels)
+
   /**
    * @brief Setter property for QuatsArrayPath
    */
@@ -258,6 +270,7 @@ private:
 
   float m_MisorientationTolerance = {};
   bool m_UseGoodVoxels = {};
+  int m_PyramidLevels = {1};
   DataArrayPath m_QuatsArrayPath = {};
   DataArrayPath m_CellPhasesArrayPath = {};
   DataArrayPath m_GoodVoxelsArrayPath = {};
@@ -35,7 +35,9 @@
 
 #include "AdaptiveAlignmentMutualInformation.h"
 
+#include <cmath>
 #include <fstream>
+#include <limits>
 
 #include <QtCore/QTextStream>
 
@@ -45,16 +47,150 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/Math/SIMPLibRandom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "EbsdLib/LaueOps/LaueOps.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/AdaptiveAlignmentShiftSearch.hpp"
+
+namespace
+{
+/**
+ * @brief The FindMutualInformationShiftsImpl class determines the candidate shifts for a range of adjacent
+ * slice pairs from the mutual information of the per-section feature ids. A pair only reads its own two
+ * slices, so pairs are searched concurrently, each with its own joint histogram. Only the histogram bins
+ * touched by a shift are summed and reset.
+ */
+class FindMutualInformationShiftsImpl
+{
+public:
+  FindMutualInformationShiftsImpl(AbstractFilter* filter, const uint64_t* dims, const int32_t* miFeatureIds, const int32_t* featureCounts, uint64_t pyramidLevels, uint64_t maxStoredShifts,
+                                  std::vector<std::vector<int64_t>>& newxshift, std::vector<std::vector<int64_t>>& newyshift, std::vector<std::vector<float>>& mindisorientation)
+  : m_Filter(filter)
+  , m_MIFeatureIds(miFeatureIds)
+  , m_FeatureCounts(featureCounts)
+  , m_PyramidLevels(pyramidLevels)
+  , m_MaxStoredShifts(maxStoredShifts)
+  , m_NewXShift(newxshift)
+  , m_NewYShift(newyshift)
+  , m_MinDisorientation(mindisorientation)
+  {
+    m_Dims[0] = dims[0];
+    m_Dims[1] = dims[1];
+    m_Dims[2] = dims[2];
+  }
+
+  void findSliceShifts(uint64_t iter) const
+  {
+    const uint64_t sliceSize = m_Dims[0] * m_Dims[1];
+    const uint64_t slice = (m_Dims[2] - 1) - iter;
+    const uint64_t refOffset = (slice + 1) * sliceSize;
+    const uint64_t curOffset = slice * sliceSize;
+    const size_t featurecount1 = static_cast<size_t>(m_FeatureCounts[slice]);
+    const size_t featurecount2 = static_cast<size_t>(m_FeatureCounts[slice + 1]);
+
+    std::vector<float> mutualinfo12(featurecount1 * featurecount2, 0.0f);
+    std::vector<float> mutualinfo1(featurecount1, 0.0f);
+    std::vector<float> mutualinfo2(featurecount2, 0.0f);
+    std::vector<size_t> touched;
+
+    auto addPair = [&](size_t curgnum, size_t refgnum) {
+      float& bin = mutualinfo12[curgnum * featurecount2 + refgnum];
+      if(bin == 0.0f)
+      {
+        touched.push_back(curgnum * featurecount2 + refgnum);
+      }
+      bin++;
+      mutualinfo1[curgnum]++;
+      mutualinfo2[refgnum]++;
+    };
+
+    auto costFunction = [&](int64_t xshift, int64_t yshift, uint64_t stride) {
+      float count = 0.0f;
+      for(uint64_t l = 0; l < m_Dims[1]; l = l + stride)
+      {
+        const int64_t curRow = static_cast<int64_t>(l) + yshift;
+        for(uint64_t n = 0; n < m_Dims[0]; n = n + stride)
+        {
+          const int64_t curCol = static_cast<int64_t>(n) + xshift;
+          if(curRow >= 0 && curRow < static_cast<int64_t>(m_Dims[1]) && curCol >= 0 && curCol < static_cast<int64_t>(m_Dims[0]))
+          {
+            const int32_t refgnum = m_MIFeatureIds[refOffset + l * m_Dims[0] + n];
+            const int32_t curgnum = m_MIFeatureIds[curOffset + static_cast<uint64_t>(curRow) * m_Dims[0] + static_cast<uint64_t>(curCol)];
+            if(curgnum >= 0 && refgnum >= 0)
+            {
+              addPair(static_cast<size_t>(curgnum), static_cast<size_t>(refgnum));
+              count++;
+            }
+          }
+          else
+          {
+            addPair(0, 0);
+          }
+        }
+      }
+
+      float disorientation = 0.0f;
+      for(size_t bin : touched)
+      {
+        const size_t b = bin / featurecount2;
+        const size_t c = bin % featurecount2;
+        const float p12 = mutualinfo12[bin] / count;
+        const float p1 = mutualinfo1[b] / count;
+        const float p2 = mutualinfo2[c] / count;
+        float value = 0.0f;
+        if(p1 > 0 && p2 > 0)
+        {
+          value = p12 / (p1 * p2);
+        }
+        if(value != 0.0f)
+        {
+          disorientation = disorientation + (p12 * logf(value));
+        }
+        mutualinfo12[bin] = 0.0f;
+      }
+      touched.clear();
+      std::fill(mutualinfo1.begin(), mutualinfo1.end(), 0.0f);
+      std::fill(mutualinfo2.begin(), mutualinfo2.end(), 0.0f);
+
+      return 1.0f / disorientation;
+    };
+
+    AdaptiveAlignmentShiftSearch::FindSliceShifts(m_Dims[0], m_Dims[1], m_PyramidLevels, m_MaxStoredShifts, costFunction, m_NewXShift[iter], m_NewYShift[iter], m_MinDisorientation[iter]);
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t iter = range.min(); iter < range.max(); iter++)
+    {
+      if(m_Filter->getCancel())
+      {
+        return;
+      }
+      findSliceShifts(iter);
+    }
+  }
+
+private:
+  AbstractFilter* m_Filter = nullptr;
+  uint64_t m_Dims[3] = {0, 0, 0};
+  const int32_t* m_MIFeatureIds = nullptr;
+  const int32_t* m_FeatureCounts = nullptr;
+  uint64_t m_PyramidLevels = 1;
+  uint64_t m_MaxStoredShifts = 1;
+  std::vector<std::vector<int64_t>>& m_NewXShift;
+  std::vector<std::vector<int64_t>>& m_NewYShift;
+  std::vector<std::vector<float>>& m_MinDisorientation;
+};
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -90,6 +226,7 @@ void AdaptiveAlignmentMutualInformation::setupFilterParameters()
   // getting the current parameters that were set by the parent and adding to it before resetting it
   FilterParameterVectorType parameters = getFilterParameters();
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Misorientation Tolerance", MisorientationTolerance, FilterParameter::Category::Parameter, AdaptiveAlignmentMutualInformation));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Pyramid Levels", PyramidLevels, FilterParameter::Category::Parameter, AdaptiveAlignmentMutualInformation));
   std::vector<QString> linkedProps = {"GoodVoxelsArrayPath"};
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Mask Array", UseGoodVoxels, FilterParameter::Category::Parameter, AdaptiveAlignmentMutualInformation, linkedProps));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
@@ -124,6 +261,7 @@ void AdaptiveAlignmentMutualInformation::readFilterParameters(AbstractFilterPara
   reader->openFilterGroup(this, index);
   setCrystalStructuresArrayPath(reader->readDataArrayPath("CrystalStructuresArrayPath", getCrystalStructuresArrayPath()));
   setUseGoodVoxels(reader->readValue("UseGoodVoxels", getUseGoodVoxels()));
+  setPyramidLevels(reader->readValue("PyramidLevels", getPyramidLevels()));
   setGoodVoxelsArrayPath(reader->readDataArrayPath("GoodVoxelsArrayPath", getGoodVoxelsArrayPath()));
   setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath()));
   setQuatsArrayPath(reader->readDataArrayPath("QuatsArrayPath", getQuatsArrayPath()));
@@ -158,6 +296,13 @@ void AdaptiveAlignmentMutualInformation::dataCheck()
     return;
   }
 
+  if(getPyramidLevels() < 1 || getPyramidLevels() > 8)
+  {
+    QString ss = QObject::tr("The number of pyramid levels must be between 1 and 8, but %1 was entered").arg(getPyramidLevels());
+    setErrorCondition(-3021, ss);
+    return;
+  }
+
   m_FeatureCounts = DataArray<int32_t>::CreateArray(0, std::string("m_FeatureCounts"), true);
   QVector<DataArrayPath> dataArrayPaths;
 
@@ -230,8 +375,6 @@ void AdaptiveAlignmentMutualInformation::find_shifts(std::vector<int64_t>& xshif
     maxstoredshifts = 20;
   }
 
-  float disorientation = 0.0f;
-
   std::vector<std::vector<int64_t>> newxshift(dims[2]);
   std::vector<std::vector<int64_t>> newyshift(dims[2]);
   std::vector<std::vector<float>> mindisorientation(dims[2]);
@@ -242,176 +385,26 @@ void AdaptiveAlignmentMutualInformation::find_shifts(std::vector<int64_t>& xshif
     mindisorientation[a].resize(maxstoredshifts, std::numeric_limits<float>::max());
   }
 
-  std::vector<std::vector<float>> mutualinfo12 = {};
-  std::vector<float> mutualinfo1 = {};
-  std::vector<float> mutualinfo2 = {};
-  int32_t featurecount1 = 0, featurecount2 = 0;
-  int64_t oldxshift = 0;
-  int64_t oldyshift = 0;
-  float count = 0.0f;
-  uint64_t slice = 0;
-
-  int32_t refgnum = 0, curgnum = 0;
-  uint64_t refposition = 0;
-  uint64_t curposition = 0;
-
   form_features_sections();
+  if(getCancel())
+  {
+    return;
+  }
 
-  // Allocate a 2D Array which will be reused from slice to slice
-  // second dimension is assigned in each cycle separately
-  std::vector<std::vector<bool>> misorients(dims[0]);
+  QString ss = QObject::tr("Aligning Anisotropic Sections || Determining Shifts");
+  notifyStatusMessage(ss);
 
-  const uint64_t halfDim0 = static_cast<uint64_t>(dims[0] * 0.5f);
-  const uint64_t halfDim1 = static_cast<uint64_t>(dims[1] * 0.5f);
-  uint64_t progInt = 0;
+  // Each pair of adjacent slices is searched independently
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, dims[2]);
+  dataAlg.execute(FindMutualInformationShiftsImpl(this, dims, miFeatureIds, featurecounts, static_cast<uint64_t>(m_PyramidLevels), maxstoredshifts, newxshift, newyshift, mindisorientation));
+  if(getCancel())
+  {
+    return;
+  }
 
   for(uint64_t iter = 1; iter < dims[2]; iter++)
   {
-    progInt = static_cast<uint64_t>(iter * 100 / static_cast<float>(dims[2]));
-    QString ss = QObject::tr("Aligning Anisotropic Sections || Determining Shifts || %1% Complete").arg(progInt);
-    notifyStatusMessage(ss);
-
-    slice = (dims[2] - 1) - iter;
-    featurecount1 = featurecounts[slice];
-    featurecount2 = featurecounts[slice + 1];
-    mutualinfo12.resize(featurecount1);
-    mutualinfo1.resize(featurecount1);
-    mutualinfo2.resize(featurecount2);
-
-    for(int32_t a = 0; a < featurecount1; a++)
-    {
-      mutualinfo1[a] = 0.0f;
-      mutualinfo12[a].resize(featurecount2);
-      for(int32_t b = 0; b < featurecount2; b++)
-      {
-        mutualinfo12[a][b] = 0.0f;
-        mutualinfo2[b] = 0.0f;
-      }
-    }
-    oldxshift = -1;
-    oldyshift = -1;
-
-    for(uint64_t i = 0; i < dims[0]; i++)
-    {
-      misorients[i].assign(dims[1], false);
-    }
-
-    while(newxshift[iter][0] != oldxshift || newyshift[iter][0] != oldyshift)
-    {
-      oldxshift = newxshift[iter][0];
-      oldyshift = newyshift[iter][0];
-
-      for(int32_t j = -3; j < 4; j++)
-      {
-        for(int32_t k = -3; k < 4; k++)
-        {
-          disorientation = 0;
-          count = 0;
-          if(static_cast<uint64_t>(std::abs(k + oldxshift)) < halfDim0 && static_cast<uint64_t>(std::abs(j + oldyshift)) < halfDim1 && !misorients[k + oldxshift + halfDim0][j + oldyshift + halfDim1])
-          {
-            for(uint64_t l = 0; l < dims[1]; l = l + 4)
-            {
-              for(uint64_t n = 0; n < dims[0]; n = n + 4)
-              {
-                if(int64_t((l + j + oldyshift)) >= 0 && (l + j + oldyshift) < dims[1] && int64_t((n + k + oldxshift)) >= 0 && (n + k + oldxshift) < dims[0])
-                {
-                  refposition = ((slice + 1) * dims[0] * dims[1]) + (l * dims[0]) + n;
-                  curposition = (slice * dims[0] * dims[1]) + ((l + j + oldyshift) * dims[0]) + (n + k + oldxshift);
-                  refgnum = miFeatureIds[refposition];
-                  curgnum = miFeatureIds[curposition];
-                  if(curgnum >= 0 && refgnum >= 0)
-                  {
-                    mutualinfo12[curgnum][refgnum]++;
-                    mutualinfo1[curgnum]++;
-                    mutualinfo2[refgnum]++;
-                    count++;
-                  }
-                }
-                else
-                {
-                  mutualinfo12[0][0]++;
-                  mutualinfo1[0]++;
-                  mutualinfo2[0]++;
-                }
-              }
-            }
-            float ha = 0.0f;
-            float hb = 0.0f;
-            float hab = 0.0f;
-            for(int32_t b = 0; b < featurecount1; b++)
-            {
-              mutualinfo1[b] = mutualinfo1[b] / count;
-              if(mutualinfo1[b] != 0.0f)
-              {
-                ha = ha + mutualinfo1[b] * logf(mutualinfo1[b]);
-              }
-            }
-            for(int32_t c = 0; c < featurecount2; c++)
-            {
-              mutualinfo2[c] = mutualinfo2[c] / float(count);
-              if(mutualinfo2[c] != 0.0f)
-              {
-                hb = hb + mutualinfo2[c] * logf(mutualinfo2[c]);
-              }
-            }
-            for(int32_t b = 0; b < featurecount1; b++)
-            {
-              for(int32_t c = 0; c < featurecount2; c++)
-              {
-                mutualinfo12[b][c] = mutualinfo12[b][c] / count;
-                if(mutualinfo12[b][c] != 0.0f)
-                {
-                  hab = hab + mutualinfo12[b][c] * logf(mutualinfo12[b][c]);
-                }
-                float value = 0.0f;
-                if(mutualinfo1[b] > 0 && mutualinfo2[c] > 0)
-                {
-                  value = (mutualinfo12[b][c] / (mutualinfo1[b] * mutualinfo2[c]));
-                }
-                if(value != 0.0f)
-                {
-                  disorientation = disorientation + (mutualinfo12[b][c] * logf(value));
-                }
-              }
-            }
-            for(int32_t b = 0; b < featurecount1; b++)
-            {
-              for(int32_t c = 0; c < featurecount2; c++)
-              {
-                mutualinfo12[b][c] = 0.0f;
-                mutualinfo1[b] = 0.0f;
-                mutualinfo2[c] = 0.0f;
-              }
-            }
-            disorientation = 1.0f / disorientation;
-            misorients[k + oldxshift + halfDim0][j + oldyshift + halfDim1] = true;
-
-            // compare the new shift with currently stored ones
-            int64_t s = static_cast<int64_t>(maxstoredshifts);
-            while(s - 1 >= 0 && disorientation < mindisorientation[iter][s - 1])
-            {
-              s--;
-            }
-
-            // new shift is stored with index 's' in the arrays
-            if(s < static_cast<int64_t>(maxstoredshifts))
-            {
-              // lag the shifts already stored
-              for(int64_t t = maxstoredshifts - 1; t > s; t--)
-              {
-                newxshift[iter][t] = newxshift[iter][t - 1];
-                newyshift[iter][t] = newyshift[iter][t - 1];
-                mindisorientation[iter][t] = mindisorientation[iter][t - 1];
-              }
-              // store the new shift
-              newxshift[iter][s] = k + oldxshift;
-              newyshift[iter][s] = j + oldyshift;
-              mindisorientation[iter][s] = disorientation;
-            }
-          }
-        }
-      }
-    }
     xshifts[iter] = xshifts[iter - 1] + newxshift[iter][0];
     yshifts[iter] = yshifts[iter - 1] + newyshift[iter][0];
   }
@@ -421,7 +414,7 @@ void AdaptiveAlignmentMutualInformation::find_shifts(std::vector<int64_t>& xshif
   // find corrected shifts
   if(!xneedshifts.empty())
   {
-    QString ss = QObject::tr("Aligning Anisotropic Sections || Correcting shifts");
+    ss = QObject::tr("Aligning Anisotropic Sections || Correcting shifts");
     notifyStatusMessage(ss);
 
     std::vector<float> changedisorientation(dims[2], 0);
@@ -542,7 +535,7 @@ void AdaptiveAlignmentMutualInformation::find_shifts(std::vector<int64_t>& xshif
     outFile.open(getAlignmentShiftFileName().toLatin1().data());
     for(uint64_t iter = 1; iter < dims[2]; iter++)
     {
-      slice = (dims[2] - 1) - iter;
+      uint64_t slice = (dims[2] - 1) - iter;
       xshifts[iter] = xshifts[iter - 1] + newxshift[iter][curindex[iter]];
       yshifts[iter] = yshifts[iter - 1] + newyshift[iter][curindex[iter]];
       outFile << slice << "	" << slice + 1 << "	" << newxshift[iter][curindex[iter]] << "	" << newyshift[iter][curindex[iter]] << "	" << xshifts[iter] << "	" << yshifts[iter] << "\n";
@@ -944,6 +937,18 @@ bool AdaptiveAlignmentMutualInformation::getUseGoodVoxels() const
   return m_UseGoodVoxels;
 }
 
+// -----------------------------------------------------------------------------
+void AdaptiveAlignmentMutualInformation::setPyramidLevels(int value)
+{
+  m_PyramidLevels = value;
+}
+
+// -----------------------------------------------------------------------------
+int AdaptiveAlignmentMutualInformation::getPyramidLevels() const
+{
+  return m_PyramidLevels;
+}
+
 // -----------------------------------------------------------------------------
 void AdaptiveAlignmentMutualInformation::setQuatsArrayPath(const DataArrayPath& value)
 {
@@ -65,7 +65,6 @@
 #include "SIMPLib/Math/MatrixMath.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
-#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
@@ -783,9 +782,7 @@ void ApplyTransformationToGeometry::applyImageGeometryTransformation()
 
   QList<QString> selectedCellArrayNames = m->getAttributeMatrix(attrMatName)->getAttributeArrayNames();
 
-  ParallelTaskAlgorithm taskRunner;
-  taskRunner.setParallelizationEnabled(true);
-
+  std::vector<std::unique_ptr<ImageRotationUtilities::IResampledArray>> resampledArrays;
   for(const auto& attrArrayName : selectedCellArrayNames)
   {
     // Get the source array from our "cached" Cell AttributeMatrix
@@ -797,22 +794,29 @@ void ApplyTransformationToGeometry::applyImageGeometryTransformation()
     // and never actually allocate the data. So we just resize to 1 tuple, and then to the real size.
     targetArray->resizeTuples(1);                // Allocate the memory for this data array
     targetArray->resizeTuples(newNumCellTuples); // Allocate the memory for this data array
-    if(m_InterpolationType == k_NearestNeighborInterpolation)
-    {
-      ImageRotationUtilities::ExecuteParallelFunction<ImageRotationUtilities::RotateImageGeometryWithNearestNeighbor>(sourceArray, taskRunner, this, this, sourceArray, targetArray, m_Params,
-                                                                                                                      m_TransformationMatrix);
-    }
-    else if(m_InterpolationType == k_LinearInterpolation)
-    {
-      ImageRotationUtilities::ExecuteParallelFunction<ImageRotationUtilities::RotateImageGeometryWithTrilinearInterpolation>(sourceArray, taskRunner, this, this, sourceArray, targetArray, m_Params,
-                                                                                                                             m_TransformationMatrix);
-    }
-    if(getCancel() || getErrorCode() < 0)
+
+    std::unique_ptr<ImageRotationUtilities::IResampledArray> resampledArray = ImageRotationUtilities::CreateResampledArray(sourceArray, targetArray);
+    if(nullptr == resampledArray)
     {
-      break;
+      QString ss = QObject::tr("Can not interpolate the data type of array '%1'").arg(attrArrayName);
+      setErrorCondition(-45102, ss);
+      return;
     }
+    resampledArrays.push_back(std::move(resampledArray));
+  }
+
+  // The mapping from each output voxel back into the original geometry is computed once per row and then
+  // gathered into every array, with the output Z slices split across threads.
+  ImageRotationUtilities::ResamplingPlan plan(m_Params, m_TransformationMatrix, m_InterpolationType == k_LinearInterpolation);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, static_cast<size_t>(m_Params.zpNew));
+  dataAlg.execute(ImageRotationUtilities::ResampleImageGeometryImpl<ApplyTransformationToGeometry>(this, plan, resampledArrays));
+
+  for(const auto& resampledArray : resampledArrays)
+  {
+    resampledArray->releaseSource();
   }
-  taskRunner.wait();
 }
 
 /**
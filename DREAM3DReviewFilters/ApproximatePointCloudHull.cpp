@@ -15,6 +15,7 @@
 #include "ApproximatePointCloudHull.h"
 
 #include <cstring>
+#include <vector>
 
 #include <QtCore/QTextStream>
 
@@ -25,10 +26,243 @@
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
+#include "DREAM3DReview/DREAM3DReviewFilters/util/RadixSort.hpp"
+
+namespace
+{
+/**
+ * @brief The OccupancyGrid class stores one bit per voxel of a sampling grid, with each X row packed into
+ * 64 bit words so that whole runs of voxels can be tested at once. Bits past the end of a row are always zero.
+ */
+class OccupancyGrid
+{
+public:
+  explicit OccupancyGrid(const int64_t* dims)
+  : m_WordsPerRow((static_cast<size_t>(dims[0]) + 63) / 64)
+  , m_Words(m_WordsPerRow * static_cast<size_t>(dims[1]) * static_cast<size_t>(dims[2]), 0)
+  {
+    m_Dims[0] = dims[0];
+    m_Dims[1] = dims[1];
+    m_Dims[2] = dims[2];
+    const size_t tailBits = static_cast<size_t>(dims[0]) % 64;
+    m_LastWordMask = (tailBits == 0) ? ~uint64_t(0) : (uint64_t(1) << tailBits) - 1;
+  }
+
+  void set(uint64_t cell)
+  {
+    const uint64_t x = cell % static_cast<uint64_t>(m_Dims[0]);
+    m_Words[(cell / static_cast<uint64_t>(m_Dims[0])) * m_WordsPerRow + x / 64] |= uint64_t(1) << (x % 64);
+  }
+
+  bool test(uint64_t cell) const
+  {
+    const uint64_t x = cell % static_cast<uint64_t>(m_Dims[0]);
+    return ((m_Words[(cell / static_cast<uint64_t>(m_Dims[0])) * m_WordsPerRow + x / 64] >> (x % 64)) & 1) != 0;
+  }
+
+  uint64_t* row(int64_t y, int64_t z)
+  {
+    return m_Words.data() + (static_cast<size_t>(z) * static_cast<size_t>(m_Dims[1]) + static_cast<size_t>(y)) * m_WordsPerRow;
+  }
+
+  const uint64_t* row(int64_t y, int64_t z) const
+  {
+    return m_Words.data() + (static_cast<size_t>(z) * static_cast<size_t>(m_Dims[1]) + static_cast<size_t>(y)) * m_WordsPerRow;
+  }
+
+  /**
+   * @brief emptyWord Returns the bits of word w of a row that are inside the grid but hold no points
+   */
+  uint64_t emptyWord(const uint64_t* row, size_t w) const
+  {
+    return ~row[w] & (w + 1 == m_WordsPerRow ? m_LastWordMask : ~uint64_t(0));
+  }
+
+  const int64_t* getDims() const
+  {
+    return m_Dims;
+  }
+
+  size_t getWordsPerRow() const
+  {
+    return m_WordsPerRow;
+  }
+
+private:
+  int64_t m_Dims[3] = {0, 0, 0};
+  size_t m_WordsPerRow = 0;
+  uint64_t m_LastWordMask = 0;
+  std::vector<uint64_t> m_Words;
+};
+
+/**
+ * @brief The FindSurfaceVoxelsImpl class flags the occupied voxels that have more than a threshold number of
+ * empty neighbors among their 26 neighbors inside the grid. The count is bit sliced: each of the 26 shifted
+ * neighbor words is added into a 5 bit counter held across 5 words, so 64 voxels are counted per bitwise
+ * operation. Tasks run over Z slabs and each output word is written by exactly one task.
+ */
+class FindSurfaceVoxelsImpl
+{
+public:
+  FindSurfaceVoxelsImpl(const OccupancyGrid& occupied, int32_t threshold, OccupancyGrid& surface)
+  : m_Occupied(occupied)
+  , m_Threshold(threshold)
+  , m_Surface(surface)
+  {
+  }
+
+  void findSurfaceVoxels(int64_t zStart, int64_t zEnd) const
+  {
+    const int64_t* dims = m_Occupied.getDims();
+    const size_t wordsPerRow = m_Occupied.getWordsPerRow();
+    for(int64_t z = zStart; z < zEnd; z++)
+    {
+      for(int64_t y = 0; y < dims[1]; y++)
+      {
+        const uint64_t* occupiedRow = m_Occupied.row(y, z);
+        uint64_t* surfaceRow = m_Surface.row(y, z);
+        for(size_t w = 0; w < wordsPerRow; w++)
+        {
+          if(occupiedRow[w] == 0)
+          {
+            continue;
+          }
+
+          uint64_t counter[5] = {0, 0, 0, 0, 0};
+          for(int64_t dz = -1; dz <= 1; dz++)
+          {
+            if(z + dz < 0 || z + dz >= dims[2])
+            {
+              continue;
+            }
+            for(int64_t dy = -1; dy <= 1; dy++)
+            {
+              if(y + dy < 0 || y + dy >= dims[1])
+              {
+                continue;
+              }
+              const uint64_t* neighborRow = m_Occupied.row(y + dy, z + dz);
+              const uint64_t empty = m_Occupied.emptyWord(neighborRow, w);
+              const uint64_t before = (w > 0) ? m_Occupied.emptyWord(neighborRow, w - 1) : 0;
+              const uint64_t after = (w + 1 < wordsPerRow) ? m_Occupied.emptyWord(neighborRow, w + 1) : 0;
+              // Neighbors at x - 1 and x + 1; the voxel itself is skipped
+              add(counter, (empty << 1) | (before >> 63));
+              add(counter, (empty >> 1) | (after << 63));
+              if(dy != 0 || dz != 0)
+              {
+                add(counter, empty);
+              }
+            }
+          }
+          surfaceRow[w] = occupiedRow[w] & exceeds(counter);
+        }
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    findSurfaceVoxels(static_cast<int64_t>(range.min()), static_cast<int64_t>(range.max()));
+  }
+
+private:
+  const OccupancyGrid& m_Occupied;
+  int32_t m_Threshold;
+  OccupancyGrid& m_Surface;
+
+  static void add(uint64_t* counter, uint64_t bits)
+  {
+    for(size_t b = 0; b < 5 && bits != 0; b++)
+    {
+      const uint64_t carry = counter[b] & bits;
+      counter[b] ^= bits;
+      bits = carry;
+    }
+  }
+
+  /**
+   * @brief exceeds Returns the bits whose count is strictly greater than the threshold
+   */
+  uint64_t exceeds(const uint64_t* counter) const
+  {
+    if(m_Threshold >= 31)
+    {
+      return 0;
+    }
+    uint64_t greater = 0;
+    uint64_t equal = ~uint64_t(0);
+    for(size_t b = 5; b-- > 0;)
+    {
+      if(((m_Threshold >> b) & 1) == 0)
+      {
+        greater |= equal & counter[b];
+        equal &= ~counter[b];
+      }
+      else
+      {
+        equal &= counter[b];
+      }
+    }
+    return greater;
+  }
+};
+
+/**
+ * @brief The AverageSurfaceVoxelsImpl class writes one hull point per surface voxel, the mean of the points in
+ * that voxel. Surface voxel i is the run order[segmentStarts[s]] .. order[segmentStarts[s + 1] - 1] with
+ * s = surfaceSegments[i].
+ */
+class AverageSurfaceVoxelsImpl
+{
+public:
+  AverageSurfaceVoxelsImpl(const float* verts, const std::vector<int64_t>& order, const std::vector<size_t>& segmentStarts, const std::vector<size_t>& surfaceSegments, float* hullVerts)
+  : m_Verts(verts)
+  , m_Order(order)
+  , m_SegmentStarts(segmentStarts)
+  , m_SurfaceSegments(surfaceSegments)
+  , m_HullVerts(hullVerts)
+  {
+  }
+
+  void average(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      const size_t s = m_SurfaceSegments[i];
+      double sum[3] = {0.0, 0.0, 0.0};
+      for(size_t v = m_SegmentStarts[s]; v < m_SegmentStarts[s + 1]; v++)
+      {
+        const float* vert = m_Verts + 3 * m_Order[v];
+        sum[0] += vert[0];
+        sum[1] += vert[1];
+        sum[2] += vert[2];
+      }
+      const double count = static_cast<double>(m_SegmentStarts[s + 1] - m_SegmentStarts[s]);
+      m_HullVerts[3 * i + 0] = static_cast<float>(sum[0] / count);
+      m_HullVerts[3 * i + 1] = static_cast<float>(sum[1] / count);
+      m_HullVerts[3 * i + 2] = static_cast<float>(sum[2] / count);
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    average(range.min(), range.max());
+  }
+
+private:
+  const float* m_Verts;
+  const std::vector<int64_t>& m_Order;
+  const std::vector<size_t>& m_SegmentStarts;
+  const std::vector<size_t>& m_SurfaceSegments;
+  float* m_HullVerts;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -105,18 +339,6 @@ void ApproximatePointCloudHull::dataCheck()
   dc->setGeometry(vertex);
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-bool validNeighbor(int64_t dims[3], int64_t neighborhood[78], size_t index, int64_t x, int64_t y, int64_t z)
-{
-  int64_t modX = x + neighborhood[3 * index + 0];
-  int64_t modY = y + neighborhood[3 * index + 1];
-  int64_t modZ = z + neighborhood[3 * index + 2];
-
-  return (modX >= 0 && modX < dims[0]) && (modY >= 0 && modY < dims[1]) && (modZ >= 0 && modZ < dims[2]);
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -195,106 +417,71 @@ void ApproximatePointCloudHull::execute()
   m_SamplingGrid->setDimensions(dims[0], dims[1], dims[2]);
 
   int64_t multiplier[3] = {1, static_cast<int64_t>(m_SamplingGrid->getXPoints()), static_cast<int64_t>(m_SamplingGrid->getXPoints() * m_SamplingGrid->getYPoints())};
-  std::vector<std::vector<int64_t>> vertsInVoxels(m_SamplingGrid->getNumberOfElements());
 
-  int64_t progIncrement = numVerts / 100;
-  int64_t prog = 1;
-  int64_t progressInt = 0;
+  notifyStatusMessage(QObject::tr("Mapping Vertices to Voxels..."));
 
-  for(int64_t v = 0; v < numVerts; v++)
+  std::vector<uint64_t> cellKeys(numVerts);
+  std::vector<int64_t> order(numVerts);
+  ParallelDataAlgorithm keyAlg;
+  keyAlg.setRange(0, numVerts);
+  keyAlg.execute([&](const SIMPLRange& range) {
+    for(size_t v = range.min(); v < range.max(); v++)
+    {
+      int64_t i = static_cast<int64_t>(std::floor(verts[3 * v + 0] * inverseResolution[0]) - static_cast<float>(bboxMin[0]));
+      int64_t j = static_cast<int64_t>(std::floor(verts[3 * v + 1] * inverseResolution[1]) - static_cast<float>(bboxMin[1]));
+      int64_t k = static_cast<int64_t>(std::floor(verts[3 * v + 2] * inverseResolution[2]) - static_cast<float>(bboxMin[2]));
+      cellKeys[v] = static_cast<uint64_t>(i * multiplier[0] + j * multiplier[1] + k * multiplier[2]);
+      order[v] = static_cast<int64_t>(v);
+    }
+  });
+
+  RadixSort::SortPairs(cellKeys, order, static_cast<uint64_t>(m_SamplingGrid->getNumberOfElements() - 1));
+  if(getCancel())
   {
-    int64_t i = static_cast<int64_t>(std::floor(verts[3 * v + 0] * inverseResolution[0]) - static_cast<float>(bboxMin[0]));
-    int64_t j = static_cast<int64_t>(std::floor(verts[3 * v + 1] * inverseResolution[1]) - static_cast<float>(bboxMin[1]));
-    int64_t k = static_cast<int64_t>(std::floor(verts[3 * v + 2] * inverseResolution[2]) - static_cast<float>(bboxMin[2]));
-    int64_t index = i * multiplier[0] + j * multiplier[1] + k * multiplier[2];
-    vertsInVoxels[index].push_back(v);
+    return;
+  }
 
-    if(v > prog)
+  // Each run of equal keys is one occupied voxel, visited in the same X-fastest order as the grid itself
+  OccupancyGrid occupied(dims);
+  std::vector<size_t> segmentStarts;
+  for(size_t v = 0; v < cellKeys.size(); v++)
+  {
+    if(v == 0 || cellKeys[v] != cellKeys[v - 1])
     {
-      progressInt = static_cast<int64_t>((static_cast<float>(v) / numVerts) * 100.0f);
-      QString ss = QObject::tr("Mapping Vertices to Voxels || %1% Complete").arg(progressInt);
-      notifyStatusMessage(ss);
-      prog = prog + progIncrement;
+      segmentStarts.push_back(v);
+      occupied.set(cellKeys[v]);
     }
   }
+  segmentStarts.push_back(cellKeys.size());
 
-  std::vector<float> tmpVerts;
-  int64_t neighborhood[78] = {1,  0, 0,  -1, 0, 0, 0, 1, 0,  0, -1, 0, 0, 0,  1,  0, 0, -1, 1, 1, 0,  -1, 1,  0, 1, -1, 0,  -1, -1, 0, 1,  0, 1,  1,  0,  -1, -1, 0,  1,
-                              -1, 0, -1, 0,  1, 1, 0, 1, -1, 0, -1, 1, 0, -1, -1, 1, 1, 1,  1, 1, -1, 1,  -1, 1, 1, -1, -1, -1, 1,  1, -1, 1, -1, -1, -1, 1,  -1, -1, -1};
+  notifyStatusMessage(QObject::tr("Trimming Interior Voxels..."));
 
-  progIncrement = (dims[0] * dims[1] * dims[2]) / 100;
-  prog = 1;
-  progressInt = 0;
-  int64_t counter = 0;
-  int64_t vertCounter = 0;
-  float xAvg = 0.0f;
-  float yAvg = 0.0f;
-  float zAvg = 0.0f;
+  OccupancyGrid surface(dims);
+  ParallelDataAlgorithm stencilAlg;
+  stencilAlg.setRange(0, dims[2]);
+  stencilAlg.execute(FindSurfaceVoxelsImpl(occupied, m_NumberOfEmptyNeighbors, surface));
+  if(getCancel())
+  {
+    return;
+  }
 
-  for(int64_t z = 0; z < dims[2]; z++)
+  std::vector<size_t> surfaceSegments;
+  for(size_t s = 0; s + 1 < segmentStarts.size(); s++)
   {
-    for(int64_t y = 0; y < dims[1]; y++)
+    if(surface.test(cellKeys[segmentStarts[s]]))
     {
-      for(int64_t x = 0; x < dims[0]; x++)
-      {
-        size_t index = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        if(vertsInVoxels[index].empty())
-        {
-          counter++;
-          continue;
-        }
-
-        size_t emtpyNeighbors = 0;
-
-        for(size_t n = 0; n < 26; n++)
-        {
-          if(validNeighbor(dims, neighborhood, n, x, y, z))
-          {
-            size_t neighborIndex = ((z + neighborhood[3 * n + 2]) * dims[1] * dims[0]) + ((y + neighborhood[3 * n + 1]) * dims[0]) + (x + neighborhood[3 * n + 0]);
-            if(vertsInVoxels[neighborIndex].empty())
-            {
-              emtpyNeighbors++;
-            }
-          }
-        }
-
-        if(emtpyNeighbors > m_NumberOfEmptyNeighbors)
-        {
-          for(auto vert : vertsInVoxels[index])
-          {
-            vertCounter++;
-            xAvg += verts[3 * vert + 0];
-            yAvg += verts[3 * vert + 1];
-            zAvg += verts[3 * vert + 2];
-          }
-          xAvg /= static_cast<float>(vertCounter);
-          yAvg /= static_cast<float>(vertCounter);
-          zAvg /= static_cast<float>(vertCounter);
-          tmpVerts.push_back(xAvg);
-          tmpVerts.push_back(yAvg);
-          tmpVerts.push_back(zAvg);
-          vertCounter = 0;
-          xAvg = 0.0f;
-          yAvg = 0.0f;
-          zAvg = 0.0f;
-        }
-
-        if(counter > prog)
-        {
-          progressInt = static_cast<int64_t>((static_cast<float>(counter) / (dims[0] * dims[1] * dims[2])) * 100.0f);
-          QString ss = QObject::tr("Trimming Interior Voxels || %1% Complete").arg(progressInt);
-          notifyStatusMessage(ss);
-          prog = prog + progIncrement;
-        }
-        counter++;
-      }
+      surfaceSegments.push_back(s);
     }
   }
+  std::vector<uint64_t>().swap(cellKeys);
 
   VertexGeom::Pointer hull = getDataContainerArray()->getDataContainer(m_HullDataContainerName)->getGeometryAs<VertexGeom>();
-  hull->resizeVertexList(tmpVerts.size() / 3);
+  hull->resizeVertexList(surfaceSegments.size());
   float* hullVerts = hull->getVertexPointer(0);
-  std::memcpy(hullVerts, tmpVerts.data(), hull->getNumberOfVertices() * 3 * sizeof(float));
+
+  ParallelDataAlgorithm averageAlg;
+  averageAlg.setRange(0, surfaceSegments.size());
+  averageAlg.execute(AverageSurfaceVoxelsImpl(verts, order, segmentStarts, surfaceSegments, hullVerts));
 
   notifyStatusMessage("Complete");
 }
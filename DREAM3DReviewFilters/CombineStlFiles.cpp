@@ -14,25 +14,145 @@
 
 #include "CombineStlFiles.h"
 
+#include <algorithm>
+#include <array>
 #include <cstring>
+#include <unordered_map>
 
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputPathFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/FilterFactory.hpp"
-#include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
+namespace
+{
+constexpr int64_t k_StlHeaderSize = 80;
+constexpr int64_t k_StlTriangleSize = 50;
+constexpr int64_t k_TrianglesPerChunk = 65536;
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief ReadStlTriangleCount Reads the number of triangles from the header of a binary STL file. Returns -1 if
+ * the file cannot be opened or is too short to hold the triangles its header announces.
+ */
+int64_t ReadStlTriangleCount(const QFileInfo& fileInfo)
+{
+  QFile file(fileInfo.canonicalFilePath());
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return -1;
+  }
+  char header[k_StlHeaderSize + sizeof(uint32_t)];
+  if(file.read(header, sizeof(header)) != static_cast<int64_t>(sizeof(header)))
+  {
+    return -1;
+  }
+  uint32_t numTris = 0;
+  std::memcpy(&numTris, header + k_StlHeaderSize, sizeof(uint32_t));
+  if(static_cast<int64_t>(sizeof(header)) + static_cast<int64_t>(numTris) * k_StlTriangleSize > file.size())
+  {
+    return -1;
+  }
+  return static_cast<int64_t>(numTris);
+}
+
+/**
+ * @brief The ReadStlFilesImpl class reads binary STL files in parallel straight into a preallocated combined
+ * triangle soup. File f owns triangles triOffsets[f] to triOffsets[f + 1] - 1 and the three vertices of each of
+ * its triangles, so files never write to the same memory.
+ */
+class ReadStlFilesImpl
+{
+public:
+  ReadStlFilesImpl(const QFileInfoList& files, const std::vector<MeshIndexType>& triOffsets, MeshIndexType* tris, float* verts, double* normals, std::vector<int8_t>& fileRead)
+  : m_Files(files)
+  , m_TriOffsets(triOffsets)
+  , m_Tris(tris)
+  , m_Verts(verts)
+  , m_Normals(normals)
+  , m_FileRead(fileRead)
+  {
+  }
+
+  bool readFile(size_t f) const
+  {
+    QFile file(m_Files[static_cast<int>(f)].canonicalFilePath());
+    if(!file.open(QIODevice::ReadOnly) || !file.seek(k_StlHeaderSize + sizeof(uint32_t)))
+    {
+      return false;
+    }
+
+    std::vector<char> buffer(static_cast<size_t>(k_TrianglesPerChunk * k_StlTriangleSize));
+    MeshIndexType t = m_TriOffsets[f];
+    while(t < m_TriOffsets[f + 1])
+    {
+      const MeshIndexType numInChunk = std::min<MeshIndexType>(k_TrianglesPerChunk, m_TriOffsets[f + 1] - t);
+      const int64_t numBytes = static_cast<int64_t>(numInChunk) * k_StlTriangleSize;
+      if(file.read(buffer.data(), numBytes) != numBytes)
+      {
+        return false;
+      }
+      for(MeshIndexType k = 0; k < numInChunk; k++, t++)
+      {
+        // normal (3), vertices (3 x 3), then a 2 byte attribute count
+        float record[12];
+        std::memcpy(record, buffer.data() + k * k_StlTriangleSize, sizeof(record));
+        m_Normals[3 * t + 0] = static_cast<double>(record[0]);
+        m_Normals[3 * t + 1] = static_cast<double>(record[1]);
+        m_Normals[3 * t + 2] = static_cast<double>(record[2]);
+        std::memcpy(m_Verts + 9 * t, record + 3, 9 * sizeof(float));
+        m_Tris[3 * t + 0] = 3 * t + 0;
+        m_Tris[3 * t + 1] = 3 * t + 1;
+        m_Tris[3 * t + 2] = 3 * t + 2;
+      }
+    }
+    return true;
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t f = range.min(); f < range.max(); f++)
+    {
+      m_FileRead[f] = readFile(f) ? 1 : 0;
+    }
+  }
+
+private:
+  const QFileInfoList& m_Files;
+  const std::vector<MeshIndexType>& m_TriOffsets;
+  MeshIndexType* m_Tris;
+  float* m_Verts;
+  double* m_Normals;
+  std::vector<int8_t>& m_FileRead;
+};
+
+using Vertex = std::array<float, 3>;
+
+struct VertexHasher
+{
+  size_t operator()(const Vertex& vert) const
+  {
+    size_t hash = std::hash<float>()(vert[0]);
+    hash ^= std::hash<float>()(vert[1]) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<float>()(vert[2]) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+  }
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -67,6 +187,7 @@ void CombineStlFiles::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
   parameters.push_back(SIMPL_NEW_INPUT_PATH_FP("Path to STL Files", StlFilesPath, FilterParameter::Category::Parameter, CombineStlFiles));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Weld Vertices", WeldVertices, FilterParameter::Category::Parameter, CombineStlFiles));
   parameters.push_back(SIMPL_NEW_STRING_FP("Data Container", TriangleDataContainerName, FilterParameter::Category::CreatedArray, CombineStlFiles));
   parameters.push_back(SeparatorFilterParameter::Create("Face Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_AM_WITH_LINKED_DC_FP("Face Attribute Matrix", FaceAttributeMatrixName, TriangleDataContainerName, FilterParameter::Category::CreatedArray, CombineStlFiles));
@@ -83,15 +204,6 @@ void CombineStlFiles::dataCheck()
   clearErrorCode();
   clearWarningCode();
 
-  FilterManager* fm = FilterManager::Instance();
-  IFilterFactory::Pointer factory = fm->getFactoryFromClassName("ReadStlFile");
-  if(!factory)
-  {
-    QString ss = QObject::tr("Combine STL Files requires the Read STL File filter to be loaded");
-    setErrorCondition(-1, ss);
-    return;
-  }
-
   QFileInfo fi(getStlFilesPath());
 
   if(getStlFilesPath().isEmpty())
@@ -159,93 +271,86 @@ void CombineStlFiles::execute()
     return;
   }
 
-  DataContainerArray::Pointer dca = DataContainerArray::New();
-
-  FilterManager* fm = FilterManager::Instance();
-  IFilterFactory::Pointer factory = fm->getFactoryFromClassName("ReadStlFile");
-  AbstractFilter::Pointer reader = factory->create();
-  reader->setDataContainerArray(dca);
-
-  for(auto&& file : m_FileList)
+  // Sizes come from the STL headers so the combined geometry is allocated once and every file is read
+  // straight into its own range of triangles
+  std::vector<MeshIndexType> triOffsets(m_FileList.size() + 1, 0);
+  for(int32_t f = 0; f < m_FileList.size(); f++)
   {
-    QVariant var;
-    var.setValue(file.canonicalFilePath());
-    reader->setProperty("StlFilePath", var);
-    var.setValue(DataArrayPath(file.baseName()));
-    reader->setProperty("SurfaceMeshDataContainerName", var);
-    var.setValue(SIMPL::Defaults::FaceAttributeMatrixName);
-    reader->setProperty("FaceAttributeMatrixName", var);
-    var.setValue(SIMPL::FaceData::SurfaceMeshFaceNormals);
-    reader->setProperty("FaceNormalsArrayName", var);
-    reader->execute();
-    if(reader->getErrorCode() < 0)
+    int64_t numTris = ReadStlTriangleCount(m_FileList[f]);
+    if(numTris < 0)
     {
-      QString ss = QObject::tr("Error reading STL file: %1").arg(file.fileName());
-      setErrorCondition(reader->getErrorCode(), ss);
+      QString ss = QObject::tr("Error reading STL file: %1. Only complete binary STL files are supported").arg(m_FileList[f].fileName());
+      setErrorCondition(-389, ss);
       return;
     }
+    triOffsets[f + 1] = triOffsets[f] + static_cast<MeshIndexType>(numTris);
   }
+  MeshIndexType totalTriangles = triOffsets.back();
+
+  TriangleGeom::Pointer combined = getDataContainerArray()->getDataContainer(m_TriangleDataContainerName)->getGeometryAs<TriangleGeom>();
+  AttributeMatrix::Pointer faceAttrmat = getDataContainerArray()->getAttributeMatrix(DataArrayPath(m_TriangleDataContainerName, m_FaceAttributeMatrixName, ""));
+  std::vector<size_t> tDims(1, totalTriangles);
+  combined->resizeTriList(totalTriangles);
+  combined->resizeVertexList(3 * totalTriangles);
+  faceAttrmat->resizeAttributeArrays(tDims);
+  m_FaceNormals = faceAttrmat->getAttributeArrayAs<DoubleArrayType>(m_FaceNormalsArrayName)->getPointer(0);
+
+  notifyStatusMessage(QObject::tr("Reading %1 triangles from %2 STL files").arg(totalTriangles).arg(m_FileList.size()));
 
-  std::list<TriangleGeom::Pointer> stlGeoms;
-  std::list<DoubleArrayType::Pointer> faceNormals;
-  auto containers = dca->getDataContainers();
-  DataArrayPath path;
+  std::vector<int8_t> fileRead(m_FileList.size(), 0);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_FileList.size());
+  dataAlg.execute(ReadStlFilesImpl(m_FileList, triOffsets, combined->getTriPointer(0), combined->getVertexPointer(0), m_FaceNormals, fileRead));
 
-  for(auto&& container : containers)
+  for(int32_t f = 0; f < m_FileList.size(); f++)
   {
-    stlGeoms.push_back(container->getGeometryAs<TriangleGeom>());
-    path.update(container->getName(), SIMPL::Defaults::FaceAttributeMatrixName, "");
-    faceNormals.push_back(container->getAttributeMatrix(path)->getAttributeArrayAs<DoubleArrayType>(SIMPL::FaceData::SurfaceMeshFaceNormals));
+    if(fileRead[f] == 0)
+    {
+      QString ss = QObject::tr("Error reading STL file: %1").arg(m_FileList[f].fileName());
+      setErrorCondition(-390, ss);
+      return;
+    }
   }
 
-  int64_t totalTriangles = 0;
-  int64_t totalVertices = 0;
-
-  for(auto&& geom : stlGeoms)
+  if(m_WeldVertices)
   {
-    totalTriangles += geom->getNumberOfTris();
-    totalVertices += geom->getNumberOfVertices();
+    weldVertices();
   }
 
+  notifyStatusMessage("Complete");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CombineStlFiles::weldVertices()
+{
   TriangleGeom::Pointer combined = getDataContainerArray()->getDataContainer(m_TriangleDataContainerName)->getGeometryAs<TriangleGeom>();
-  AttributeMatrix::Pointer faceAttrmat = getDataContainerArray()->getAttributeMatrix(DataArrayPath(m_TriangleDataContainerName, m_FaceAttributeMatrixName, ""));
-  std::vector<size_t> tDims(1, totalTriangles);
-  combined->resizeTriList(totalTriangles);
-  combined->resizeVertexList(totalVertices);
-  faceAttrmat->resizeAttributeArrays(tDims);
-  MeshIndexType triOffset = 0;
-  MeshIndexType vertOffset = 0;
-  MeshIndexType triCounter = 0;
+  MeshIndexType numVerts = combined->getNumberOfVertices();
   MeshIndexType* tris = combined->getTriPointer(0);
   float* verts = combined->getVertexPointer(0);
 
-  for(auto&& geom : stlGeoms)
+  notifyStatusMessage("Welding vertices");
+
+  // The combined geometry is a triangle soup, so vertex v is corner v of the triangle list
+  std::unordered_map<Vertex, MeshIndexType, VertexHasher> vertexMap;
+  vertexMap.reserve(numVerts / 4);
+  std::vector<float> uniqueVerts;
+  uniqueVerts.reserve(numVerts);
+  for(MeshIndexType v = 0; v < numVerts; v++)
   {
-    MeshIndexType* curTris = geom->getTriPointer(0);
-    for(MeshIndexType t = 0; t < geom->getNumberOfTris(); t++)
+    // Adding 0 turns -0 into +0, which compares equal but hashes differently
+    Vertex vert = {verts[3 * v + 0] + 0.0f, verts[3 * v + 1] + 0.0f, verts[3 * v + 2] + 0.0f};
+    auto iter = vertexMap.emplace(vert, static_cast<MeshIndexType>(vertexMap.size()));
+    if(iter.second)
     {
-      curTris[3 * t + 0] += triCounter;
-      curTris[3 * t + 1] += triCounter;
-      curTris[3 * t + 2] += triCounter;
+      uniqueVerts.insert(uniqueVerts.end(), vert.begin(), vert.end());
     }
-    triCounter += geom->getNumberOfVertices();
-    float* curVerts = geom->getVertexPointer(0);
-    std::memcpy(tris + triOffset, curTris, geom->getNumberOfTris() * 3 * sizeof(MeshIndexType));
-    std::memcpy(verts + vertOffset, curVerts, geom->getNumberOfVertices() * 3 * sizeof(float));
-    triOffset += geom->getNumberOfTris() * 3;
-    vertOffset += geom->getNumberOfVertices() * 3;
-  }
-
-  size_t faceNormalsOffset = 0;
-  m_FaceNormals = faceAttrmat->getAttributeArrayAs<DoubleArrayType>(m_FaceNormalsArrayName)->getPointer(0);
-
-  for(auto&& dataArray : faceNormals)
-  {
-    std::memcpy(m_FaceNormals + faceNormalsOffset, dataArray->getPointer(0), dataArray->getSize() * sizeof(double));
-    faceNormalsOffset += dataArray->getSize();
+    tris[v] = iter.first->second;
   }
 
-  notifyStatusMessage("Complete");
+  combined->resizeVertexList(vertexMap.size());
+  std::memcpy(combined->getVertexPointer(0), uniqueVerts.data(), uniqueVerts.size() * sizeof(float));
 }
 
 // -----------------------------------------------------------------------------
@@ -396,3 +501,15 @@ QString CombineStlFiles::getFaceNormalsArrayName() const
 {
   return m_FaceNormalsArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void CombineStlFiles::setWeldVertices(bool value)
+{
+  m_WeldVertices = value;
+}
+
+// -----------------------------------------------------------------------------
+bool CombineStlFiles::getWeldVertices() const
+{
+  return m_WeldVertices;
+}
@@ -95,6 +95,17 @@ public:
   QString getFaceNormalsArrayName() const;
   Q_PROPERTY(QString FaceNormalsArrayName READ getFaceNormalsArrayName WRITE setFaceNormalsArrayName)
 
+  /**
+   * @brief Setter property for WeldVertices
+   */
+  void setWeldVertices(bool value);
+  /**
+   * @brief Getter property for WeldVertices
+   * @return Value of WeldVertices
+   */
+  bool getWeldVertices() const;
+  Q_PROPERTY(bool WeldVertices READ getWeldVertices WRITE setWeldVertices)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -163,6 +174,12 @@ protected:
    */
   void initialize();
 
+  /**
+   * @brief weldVertices Merges vertices of the combined geometry that have identical coordinates and
+   * renumbers the triangles to use the merged vertices
+   */
+  void weldVertices();
+
 private:
   std::weak_ptr<DoubleArrayType> m_FaceNormalsPtr;
   double* m_FaceNormals = nullptr;
@@ -171,6 +188,7 @@ private:
   QString m_TriangleDataContainerName = {};
   QString m_FaceAttributeMatrixName = {};
   QString m_FaceNormalsArrayName = {};
+  bool m_WeldVertices = {true};
 
   QFileInfoList m_FileList;
 
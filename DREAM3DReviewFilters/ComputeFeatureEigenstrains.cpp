@@ -32,7 +32,10 @@
 
 #include "ComputeFeatureEigenstrains.h"
 
+#include <algorithm>
 #include <cmath>
+#include <map>
+#include <vector>
 
 #include <QtCore/QTextStream>
 
@@ -54,6 +57,7 @@
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
@@ -62,6 +66,149 @@
 
 namespace SIMPLMath = SIMPLib::Constants;
 
+namespace
+{
+using MatrixList6 = std::vector<EigenstrainsHelper::Matrix6Type, Eigen::aligned_allocator<EigenstrainsHelper::Matrix6Type>>;
+
+/**
+ * @brief Axis difference below which the Eshelby solution treats an ellipsoid as a sphere (see EigenstrainsHelper::find_eshelby)
+ */
+constexpr double k_SphereEps = 1e-5;
+
+/**
+ * @brief The EshelbyShape struct identifies an Eshelby tensor by the aspect ratios b/a and c/a of the inclusion.
+ * The tensor does not depend on the size of the inclusion, so every feature with the same aspect ratios shares it.
+ */
+struct EshelbyShape
+{
+  double b;
+  double c;
+
+  bool operator<(const EshelbyShape& other) const
+  {
+    return b < other.b || (b == other.b && c < other.c);
+  }
+};
+
+/**
+ * @brief The FindEshelbyInversesImpl class calculates (S-I)^-1 in Mandel form for a list of unit-sized shapes
+ */
+class FindEshelbyInversesImpl
+{
+public:
+  FindEshelbyInversesImpl(const std::vector<EshelbyShape>& shapes, double nu, bool ellipsoidal, MatrixList6& inverses)
+  : m_Shapes(shapes)
+  , m_Nu(nu)
+  , m_Ellipsoidal(ellipsoidal)
+  , m_Inverses(inverses)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t s = range.min(); s < range.max(); s++)
+    {
+      m_Inverses[s] = EigenstrainsHelper::find_eshelby_inverse(1.0, m_Shapes[s].b, m_Shapes[s].c, m_Nu, m_Ellipsoidal);
+    }
+  }
+
+private:
+  const std::vector<EshelbyShape>& m_Shapes;
+  double m_Nu;
+  bool m_Ellipsoidal;
+  MatrixList6& m_Inverses;
+};
+
+/**
+ * @brief The FindEigenstrainsImpl class calculates the eigenstrains of a range of features from their elastic strains
+ * and the cached (S-I)^-1 of their shape. Features with a negative shape index are skipped and get zero eigenstrains.
+ */
+class FindEigenstrainsImpl
+{
+public:
+  FindEigenstrainsImpl(const float* elasticStrains, const float* axisEulerAngles, const std::vector<int32_t>& featureShapes, const MatrixList6& eshelbyInverses, const Eigen::Matrix3d& beta,
+                       float* eigenstrains)
+  : m_ElasticStrains(elasticStrains)
+  , m_AxisEulerAngles(axisEulerAngles)
+  , m_FeatureShapes(featureShapes)
+  , m_EshelbyInverses(eshelbyInverses)
+  , m_Beta(beta)
+  , m_Eigenstrains(eigenstrains)
+  {
+  }
+
+  void find(size_t start, size_t end) const
+  {
+    for(size_t feature = start; feature < end; feature++)
+    {
+      float* eigenstrains = m_Eigenstrains + feature * 6;
+      const float* elasticStrains = m_ElasticStrains + feature * 6;
+      std::fill(eigenstrains, eigenstrains + 6, 0.0f);
+
+      int32_t shape = m_FeatureShapes[feature];
+      if(shape < 0)
+      {
+        continue;
+      }
+
+      Eigen::Matrix3d elasticStrainTensor;
+      // clang-format off
+      elasticStrainTensor << elasticStrains[0], elasticStrains[5], elasticStrains[4],
+                             elasticStrains[5], elasticStrains[1], elasticStrains[3],
+                             elasticStrains[4], elasticStrains[3], elasticStrains[2];
+      // clang-format on
+
+      // Check if the elastic strains are zero (or negligible) then so are the eigenstrains
+      if(elasticStrainTensor.isMuchSmallerThan(1e-10))
+      {
+        continue;
+      }
+
+      Eigen::Matrix3d OM = Eigen::Matrix3d::Identity(); // Defaults to no orientation identity
+      if(m_AxisEulerAngles != nullptr)
+      {
+        const float* eulers = m_AxisEulerAngles + feature * 3;
+        OrientationD orientationMatrix = OrientationTransformation::eu2om<OrientationD, OrientationD>({eulers[0], eulers[1], eulers[2]});
+        // clang-format off
+        OM << orientationMatrix[0], orientationMatrix[1], orientationMatrix[2],
+              orientationMatrix[3], orientationMatrix[4], orientationMatrix[5],
+              orientationMatrix[6], orientationMatrix[7], orientationMatrix[8];
+        // clang-format on
+      }
+
+      // Change basis into ellipsoid reference frame | e' = Q e Q^T
+      Eigen::Matrix3d elasticStrainTensorRot = OM * elasticStrainTensor * OM.transpose();
+
+      // Calculate eigenstrain tensor | e*' = (S-I)^-1 e'
+      Eigen::Matrix3d eigenstrainTensorRot = EigenstrainsHelper::mandel_tensor(m_EshelbyInverses[shape] * EigenstrainsHelper::mandel_vector(elasticStrainTensorRot));
+
+      // Change basis back to global reference frame and add correction | e*c = B (Q^T e*' Q)
+      Eigen::Matrix3d eigenstrainTensorCorrected = (OM.transpose() * eigenstrainTensorRot * OM).cwiseProduct(m_Beta);
+
+      eigenstrains[0] = eigenstrainTensorCorrected(0, 0);
+      eigenstrains[1] = eigenstrainTensorCorrected(1, 1);
+      eigenstrains[2] = eigenstrainTensorCorrected(2, 2);
+      eigenstrains[3] = eigenstrainTensorCorrected(1, 2);
+      eigenstrains[4] = eigenstrainTensorCorrected(0, 2);
+      eigenstrains[5] = eigenstrainTensorCorrected(0, 1);
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    find(range.min(), range.max());
+  }
+
+private:
+  const float* m_ElasticStrains;
+  const float* m_AxisEulerAngles;
+  const std::vector<int32_t>& m_FeatureShapes;
+  const MatrixList6& m_EshelbyInverses;
+  Eigen::Matrix3d m_Beta;
+  float* m_Eigenstrains;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -273,22 +420,7 @@ void ComputeFeatureEigenstrains::find_eigenstrains()
 {
   size_t numfeatures = m_ElasticStrainsPtr.lock()->getNumberOfTuples();
 
-  double phi1 = 0.0;
-  double theta = 0.0;
-  double phi2 = 0.0;
-
-  double semiAxisA = 0.0;
-  double semiAxisB = 0.0;
-  double semiAxisC = 0.0;
-
-  double E11 = 0.0;
-  double E22 = 0.0;
-  double E33 = 0.0;
-  double E23 = 0.0;
-  double E13 = 0.0;
-  double E12 = 0.0;
-
-  Eigen::Matrix<double, 3, 3> beta;
+  Eigen::Matrix3d beta;
   beta.setOnes(3, 3); // Default no correction
   if(m_UseCorrectionalMatrix)
   {
@@ -299,56 +431,38 @@ void ComputeFeatureEigenstrains::find_eigenstrains()
     // clang-format on
   }
 
-  OrientationD orientationMatrix;
-  Eigen::Matrix<double, 3, 3> OM;
-  Eigen::Matrix<double, 3, 3> OMT;
-  OM.setIdentity(3, 3); // Defaults to no orientation identity
-  OMT.setIdentity(3, 3);
-
-  Eigen::Matrix<double, 3, 3> elasticStrainTensor;
-  Eigen::Matrix<double, 3, 3> elasticStrainTensorRot;
-
-  EigenstrainsHelper::Tensor4DType eshelbyTensor;
-  EigenstrainsHelper::Tensor4DType eshelbyInverse;
-
-  Eigen::Matrix<double, 9, 9> eshelbyTensor99;
-  Eigen::Matrix<double, 9, 9> eshelbyInverse99;
-  Eigen::Matrix<double, 9, 9> I9;
-  I9.setIdentity(9, 9);
-
-  Eigen::Matrix<double, 3, 3> eigenstrainTensorRot;
-  Eigen::Matrix<double, 3, 3> eigenstrainTensor;
-  Eigen::Matrix<double, 3, 3> eigenstrainTensorCorrected;
+  const float* axisEulerAngles = nullptr;
+  const float* axisLengths = nullptr;
+  if(m_UseEllipsoidalGrains)
+  {
+    axisEulerAngles = m_AxisEulerAnglesPtr.lock()->getPointer(0);
+    axisLengths = m_AxisLengthsPtr.lock()->getPointer(0);
+  }
 
-  FloatArrayType& axisEulerAngles = *(m_AxisEulerAnglesPtr.lock().get());
-  FloatArrayType& axisLengths = *(m_AxisLengthsPtr.lock().get());
-  FloatArrayType& elasticStrains = *(m_ElasticStrainsPtr.lock().get());
-  FloatArrayType& eigenstrains = *(m_EigenstrainsPtr.lock().get());
+  // Validate the features and assign each one the Eshelby shape it uses; features that are skipped get -1
+  std::vector<int32_t> featureShapes(numfeatures, 0);
+  std::vector<EshelbyShape> shapes = {EshelbyShape{1.0, 1.0}};
+  if(m_UseEllipsoidalGrains)
+  {
+    std::map<EshelbyShape, int32_t> shapeIndices = {{shapes[0], 0}};
 
-  // small eps term added to euler angle bounds check as FindFeatureShapes has some small noise outside the bounds
-  double eps = 0.001;
-  double eulerPhiMax = 2 * SIMPLMath::k_PiD + eps;
-  double eulerThetaMax = SIMPLMath::k_PiD + eps;
-  double eulerMin = 0 - eps;
+    // small eps term added to euler angle bounds check as FindFeatureShapes has some small noise outside the bounds
+    double eps = 0.001;
+    double eulerPhiMax = 2 * SIMPLMath::k_PiD + eps;
+    double eulerThetaMax = SIMPLMath::k_PiD + eps;
+    double eulerMin = 0 - eps;
 
-  for(size_t feature = 0; feature < numfeatures; feature++)
-  {
-    if(m_UseEllipsoidalGrains)
+    for(size_t feature = 0; feature < numfeatures; feature++)
     {
-      phi1 = axisEulerAngles[feature * 3 + 0];
-      theta = axisEulerAngles[feature * 3 + 1];
-      phi2 = axisEulerAngles[feature * 3 + 2];
+      double phi1 = axisEulerAngles[feature * 3 + 0];
+      double theta = axisEulerAngles[feature * 3 + 1];
+      double phi2 = axisEulerAngles[feature * 3 + 2];
 
       if(std::isnan(phi1) || std::isnan(theta) || std::isnan(phi2))
       {
         QString ss = QObject::tr("NaN Axis Euler angle found in feature ID #%1, skipping").arg(feature);
         notifyStatusMessage(ss);
-        eigenstrains[feature * 6 + 0] = 0;
-        eigenstrains[feature * 6 + 1] = 0;
-        eigenstrains[feature * 6 + 2] = 0;
-        eigenstrains[feature * 6 + 3] = 0;
-        eigenstrains[feature * 6 + 4] = 0;
-        eigenstrains[feature * 6 + 5] = 0;
+        featureShapes[feature] = -1;
         continue;
       }
 
@@ -373,20 +487,15 @@ void ComputeFeatureEigenstrains::find_eigenstrains()
         return;
       }
 
-      semiAxisA = axisLengths[feature * 3 + 0];
-      semiAxisB = axisLengths[feature * 3 + 1];
-      semiAxisC = axisLengths[feature * 3 + 2];
+      double semiAxisA = axisLengths[feature * 3 + 0];
+      double semiAxisB = axisLengths[feature * 3 + 1];
+      double semiAxisC = axisLengths[feature * 3 + 2];
 
       if(std::isnan(semiAxisA) || std::isnan(semiAxisB) || std::isnan(semiAxisC))
       {
         QString ss = QObject::tr("NaN Axis length found in feature ID #%1, skipping").arg(feature);
         notifyStatusMessage(ss);
-        eigenstrains[feature * 6 + 0] = 0;
-        eigenstrains[feature * 6 + 1] = 0;
-        eigenstrains[feature * 6 + 2] = 0;
-        eigenstrains[feature * 6 + 3] = 0;
-        eigenstrains[feature * 6 + 4] = 0;
-        eigenstrains[feature * 6 + 5] = 0;
+        featureShapes[feature] = -1;
         continue;
       }
 
@@ -403,122 +512,36 @@ void ComputeFeatureEigenstrains::find_eigenstrains()
         setErrorCondition(-94000, ss);
         return;
       }
-    }
-
-    E11 = elasticStrains[feature * 6 + 0];
-    E22 = elasticStrains[feature * 6 + 1];
-    E33 = elasticStrains[feature * 6 + 2];
-    E23 = elasticStrains[feature * 6 + 3];
-    E13 = elasticStrains[feature * 6 + 4];
-    E12 = elasticStrains[feature * 6 + 5];
-
-    // clang-format off
-    elasticStrainTensor << E11, E12, E13,
-                           E12, E22, E23,
-                           E13, E23, E33;
-    // clang-format on
-
-    // Check if the elastic strains are zero (or negligible) then so are the eigenstrains
-    if(elasticStrainTensor.isMuchSmallerThan(1e-10))
-    {
-      eigenstrains[feature * 6 + 0] = 0;
-      eigenstrains[feature * 6 + 1] = 0;
-      eigenstrains[feature * 6 + 2] = 0;
-      eigenstrains[feature * 6 + 3] = 0;
-      eigenstrains[feature * 6 + 4] = 0;
-      eigenstrains[feature * 6 + 5] = 0;
-      continue;
-    }
-
-    if(m_UseEllipsoidalGrains)
-    {
-      orientationMatrix = OrientationTransformation::eu2om<OrientationD, OrientationD>({phi1, theta, phi2});
-
-      // clang-format off
-      OM << orientationMatrix[0], orientationMatrix[1], orientationMatrix[2],
-            orientationMatrix[3], orientationMatrix[4], orientationMatrix[5],
-            orientationMatrix[6], orientationMatrix[7], orientationMatrix[8];
-      OMT = OM.transpose();
-      // clang-format on
-    }
-
-    // Change basis into ellipsoid reference frame | e' = Q e Q^T
-    elasticStrainTensorRot = OM * elasticStrainTensor * OMT;
-
-    // Calculate Eshelby tensor | S = f(a, b, c, nu)
-    eshelbyTensor = EigenstrainsHelper::find_eshelby(semiAxisA, semiAxisB, semiAxisC, m_PoissonRatio, m_UseEllipsoidalGrains);
-
-    // Map Eshelby tensor into 9x9 matrix
-    size_t col = 0;
-    size_t row = 0;
-    for(size_t i = 0; i < 3; i++)
-    {
-      for(size_t j = 0; j < 3; j++)
-      {
-        for(size_t k = 0; k < 3; k++)
-        {
-          for(size_t l = 0; l < 3; l++)
-          {
-            eshelbyTensor99(col, row) = eshelbyTensor(i, j, k, l);
-            col++;
-          }
-        }
-        row++;
-        col = 0;
-      }
-    }
-
-    // Calculate inverse | (S-I)^-1
-    eshelbyInverse99 = (eshelbyTensor99 - I9).inverse();
 
-    // Remap inverse back into a 3x3x3x3 tensor
-    col = 0;
-    row = 0;
-    for(size_t i = 0; i < 3; i++)
-    {
-      for(size_t j = 0; j < 3; j++)
+      // Features the Eshelby solution treats as spheres all share the first shape
+      if(semiAxisA - semiAxisB <= k_SphereEps && semiAxisB - semiAxisC <= k_SphereEps)
       {
-        for(size_t k = 0; k < 3; k++)
-        {
-          for(size_t l = 0; l < 3; l++)
-          {
-            eshelbyInverse(i, j, k, l) = eshelbyInverse99(col, row);
-            col++;
-          }
-        }
-        row++;
-        col = 0;
+        continue;
       }
-    }
 
-    // Calculate eigenstrain tensor | e*' = (S-I)^-1 e'
-    eigenstrainTensorRot.setZero(3, 3);
-    for(size_t i = 0; i < 3; i++)
-    {
-      for(size_t j = 0; j < 3; j++)
+      EshelbyShape shape = {semiAxisB / semiAxisA, semiAxisC / semiAxisA};
+      auto inserted = shapeIndices.insert({shape, static_cast<int32_t>(shapes.size())});
+      if(inserted.second)
       {
-        for(size_t k = 0; k < 3; k++)
-        {
-          for(size_t l = 0; l < 3; l++)
-          {
-            eigenstrainTensorRot(i, j) += eshelbyInverse(i, j, k, l) * elasticStrainTensorRot(k, l);
-          }
-        }
+        shapes.push_back(shape);
       }
+      featureShapes[feature] = inserted.first->second;
     }
+  }
 
-    // Change basis back to global reference frame | e* = Q^T e*' Q
-    eigenstrainTensor = OMT * eigenstrainTensorRot * OM;
-
-    // Add correction | e*c = B e*
-    eigenstrainTensorCorrected = eigenstrainTensor.cwiseProduct(beta);
+  // Calculate (S-I)^-1 once per unique shape
+  MatrixList6 eshelbyInverses(shapes.size());
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, shapes.size());
+    dataAlg.setGrain(1);
+    dataAlg.execute(FindEshelbyInversesImpl(shapes, m_PoissonRatio, m_UseEllipsoidalGrains, eshelbyInverses));
+  }
 
-    eigenstrains[feature * 6 + 0] = eigenstrainTensorCorrected(0, 0);
-    eigenstrains[feature * 6 + 1] = eigenstrainTensorCorrected(1, 1);
-    eigenstrains[feature * 6 + 2] = eigenstrainTensorCorrected(2, 2);
-    eigenstrains[feature * 6 + 3] = eigenstrainTensorCorrected(1, 2);
-    eigenstrains[feature * 6 + 4] = eigenstrainTensorCorrected(0, 2);
-    eigenstrains[feature * 6 + 5] = eigenstrainTensorCorrected(0, 1);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numfeatures);
+    dataAlg.execute(FindEigenstrainsImpl(m_ElasticStrainsPtr.lock()->getPointer(0), axisEulerAngles, featureShapes, eshelbyInverses, beta, m_EigenstrainsPtr.lock()->getPointer(0)));
   }
 }
 
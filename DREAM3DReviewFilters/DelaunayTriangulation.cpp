@@ -18,6 +18,7 @@
 #include "SIMPLib/Geometry/IGeometryGrid.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewFilters/util/Delaunay2D.h"
@@ -47,70 +48,132 @@ struct VertexHasher
 
 using VertexMap = std::unordered_map<Vertex, int64_t, VertexHasher>;
 
-void mergeTriangleGeometries(std::vector<TriangleGeom::Pointer>& triangles)
+/**
+ * @brief The TriangulateFeaturesImpl class triangulates the vertices of each Feature independently, in
+ * parallel over Features
+ */
+class TriangulateFeaturesImpl
+{
+public:
+  TriangulateFeaturesImpl(const std::vector<TriMesh::VertexCoordList>& vertexLists, double offset, double tolerance, std::vector<TriangleGeom::Pointer>& triangles)
+  : m_VertexLists(vertexLists)
+  , m_Offset(offset)
+  , m_Tolerance(tolerance)
+  , m_Triangles(triangles)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t f = range.min(); f < range.max(); f++)
+    {
+      if(m_VertexLists[f].empty())
+      {
+        continue;
+      }
+      // No observer is attached, since progress messages cannot be sent from worker threads
+      Delaunay2D::Pointer delaunay = Delaunay2D::New(m_VertexLists[f], m_Offset, m_Tolerance, 0.0);
+      m_Triangles[f] = delaunay->triangulate();
+    }
+  }
+
+private:
+  const std::vector<TriMesh::VertexCoordList>& m_VertexLists;
+  double m_Offset;
+  double m_Tolerance;
+  std::vector<TriangleGeom::Pointer>& m_Triangles;
+};
+
+/**
+ * @brief The CopyFeatureTrianglesImpl class writes the triangles of each Feature into its precomputed range of
+ * the merged triangle list, renumbering the Feature's local vertex indices to the merged vertices
+ */
+class CopyFeatureTrianglesImpl
+{
+public:
+  CopyFeatureTrianglesImpl(const std::vector<TriangleGeom::Pointer>& triangles, const std::vector<size_t>& vertexOffsets, const std::vector<size_t>& triOffsets,
+                           const std::vector<int64_t>& mergedIds, size_t* mergedTris)
+  : m_Triangles(triangles)
+  , m_VertexOffsets(vertexOffsets)
+  , m_TriOffsets(triOffsets)
+  , m_MergedIds(mergedIds)
+  , m_MergedTris(mergedTris)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t f = range.min(); f < range.max(); f++)
+    {
+      if(m_Triangles[f] == nullptr)
+      {
+        continue;
+      }
+      size_t* localTris = m_Triangles[f]->getTriPointer(0);
+      size_t numEntries = 3 * (m_TriOffsets[f + 1] - m_TriOffsets[f]);
+      size_t* out = m_MergedTris + 3 * m_TriOffsets[f];
+      for(size_t i = 0; i < numEntries; i++)
+      {
+        out[i] = m_MergedIds[m_VertexOffsets[f] + localTris[i]];
+      }
+    }
+  }
+
+private:
+  const std::vector<TriangleGeom::Pointer>& m_Triangles;
+  const std::vector<size_t>& m_VertexOffsets;
+  const std::vector<size_t>& m_TriOffsets;
+  const std::vector<int64_t>& m_MergedIds;
+  size_t* m_MergedTris;
+};
+
+TriangleGeom::Pointer mergeTriangleGeometries(const std::vector<TriMesh::VertexCoordList>& vertexLists, const std::vector<TriangleGeom::Pointer>& triangles)
 {
-  int64_t numVerts = 0;
-  int64_t numTris = 0;
-  for(auto&& triangle : triangles)
+  // Each Feature triangulation keeps its input vertices in order, so the merged vertices are
+  // found from the vertex lists directly, and coincident vertices of different Features are merged
+  std::vector<size_t> vertexOffsets(vertexLists.size() + 1, 0);
+  std::vector<size_t> triOffsets(vertexLists.size() + 1, 0);
+  for(size_t f = 0; f < vertexLists.size(); f++)
   {
-    numVerts += triangle->getNumberOfVertices();
-    numTris += triangle->getNumberOfTris();
+    vertexOffsets[f + 1] = vertexOffsets[f] + vertexLists[f].size();
+    triOffsets[f + 1] = triOffsets[f] + (triangles[f] != nullptr ? triangles[f]->getNumberOfTris() : 0);
   }
 
   VertexMap vertexMap;
   std::vector<Vertex> mergedVerts;
-  mergedVerts.reserve(numVerts);
-  int64_t vertCounter = 0;
-  for(auto&& triangle : triangles)
+  mergedVerts.reserve(vertexOffsets.back());
+  std::vector<int64_t> mergedIds(vertexOffsets.back());
+  size_t counter = 0;
+  for(auto&& vertexList : vertexLists)
   {
-    float* vertPtr = triangle->getVertexPointer(0);
-    int64_t localNumVerts = triangle->getNumberOfVertices();
-    for(int64_t i = 0; i < localNumVerts; i++)
+    for(auto&& coords : vertexList)
     {
-      Vertex vert = {vertPtr[3 * i + 0], vertPtr[3 * i + 1], vertPtr[3 * i + 2]};
-      auto iter = vertexMap.find(vert);
-      if(iter == vertexMap.end())
+      Vertex vert = {coords[0], coords[1], coords[2]};
+      auto iter = vertexMap.emplace(vert, static_cast<int64_t>(mergedVerts.size()));
+      if(iter.second)
       {
         mergedVerts.push_back(vert);
-        vertexMap[vert] = vertCounter;
-        vertCounter++;
       }
+      mergedIds[counter++] = iter.first->second;
     }
   }
 
   SharedVertexList::Pointer mergedVertices = TriangleGeom::CreateSharedVertexList(mergedVerts.size());
   float* mergedVertsPtr = mergedVertices->getPointer(0);
-  for(size_t i = 0; i < mergedVertices->getNumberOfTuples(); i++)
+  for(size_t i = 0; i < mergedVerts.size(); i++)
   {
     mergedVertsPtr[3 * i + 0] = mergedVerts[i][0];
     mergedVertsPtr[3 * i + 1] = mergedVerts[i][1];
     mergedVertsPtr[3 * i + 2] = mergedVerts[i][2];
   }
 
-  mergedVerts.clear();
-  mergedVerts.shrink_to_fit();
+  TriangleGeom::Pointer mergedTriangle = TriangleGeom::CreateGeometry(triOffsets.back(), mergedVertices, SIMPL::Geometry::TriangleGeometry);
 
-  TriangleGeom::Pointer mergedTriangle = TriangleGeom::CreateGeometry(numTris, mergedVertices, SIMPL::Geometry::TriangleGeometry);
-  size_t* mergedTrisPtr = mergedTriangle->getTriPointer(0);
-  size_t triCounter = 0;
-  for(auto&& triangle : triangles)
-  {
-    size_t localNumTris = triangle->getNumberOfTris();
-    float vertCoords[9];
-    for(size_t i = 0; i < localNumTris; i++)
-    {
-      triangle->getVertCoordsAtTri(i, vertCoords, vertCoords + 3, vertCoords + 6);
-      for(size_t j = 0; j < 3; j++)
-      {
-        Vertex vert = {vertCoords[3 * j + 0], vertCoords[3 * j + 1], vertCoords[3 * j + 2]};
-        mergedTrisPtr[3 * triCounter + j] = vertexMap[vert];
-      }
-      triCounter++;
-    }
-  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, triangles.size());
+  dataAlg.execute(CopyFeatureTrianglesImpl(triangles, vertexOffsets, triOffsets, mergedIds, mergedTriangle->getTriPointer(0)));
 
-  triangles.resize(1);
-  triangles[0] = mergedTriangle;
+  return mergedTriangle;
 }
 }; // namespace
 
@@ -331,31 +394,33 @@ void DelaunayTriangulation::execute()
     }
   }
 
-  size_t counter = 1;
   std::vector<TriangleGeom::Pointer> triangles(vertexLists.size());
 
-  for(auto&& vertexList : vertexLists)
+  if(m_TriangulateByFeature)
+  {
+    QString ss = QObject::tr("Performing Delaunay Triangulation || %1 Features").arg(numFeatures);
+    notifyStatusMessage(ss);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, vertexLists.size());
+    // Features vary widely in size, so let each task take a single Feature
+    dataAlg.setGrain(1);
+    dataAlg.execute(TriangulateFeaturesImpl(vertexLists, m_Offset, m_Tolerance, triangles));
+
+    TriangleGeom::Pointer merged = mergeTriangleGeometries(vertexLists, triangles);
+    triangles.resize(1);
+    triangles[0] = merged;
+  }
+  else
   {
-    Delaunay2D::Pointer delaunay = Delaunay2D::New(vertexList, m_Offset, m_Tolerance, 0.0, this);
+    Delaunay2D::Pointer delaunay = Delaunay2D::New(vertexLists[0], m_Offset, m_Tolerance, 0.0, this);
     delaunay->setMessagePrefix(getHumanLabel());
-    QString ss = QObject::tr("Performing Delaunay Triangulation");
-    if(m_TriangulateByFeature)
-    {
-      QString featureProgress = QObject::tr(" || Feature %1 of %2").arg(counter).arg(numFeatures);
-      ss += featureProgress;
-    }
-    delaunay->setMessageTitle(ss);
-    triangles[counter - 1] = delaunay->triangulate();
-    counter++;
+    delaunay->setMessageTitle(QObject::tr("Performing Delaunay Triangulation"));
+    triangles[0] = delaunay->triangulate();
   }
 
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(m_TriangleDataContainerName);
 
-  if(m_TriangulateByFeature)
-  {
-    mergeTriangleGeometries(triangles);
-  }
-
   dc->setGeometry(triangles[0]);
   AttributeMatrix::Pointer attrMat = getDataContainerArray()->getDataContainer(m_TriangleDataContainerName)->getAttributeMatrix(m_VertexAttributeMatrixName);
   std::vector<size_t> tDims(1, triangles[0]->getNumberOfVertices());
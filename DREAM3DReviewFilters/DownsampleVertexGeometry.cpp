@@ -16,6 +16,8 @@
 
 #include <cstring>
 #include <random>
+#include <type_traits>
+#include <vector>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
@@ -29,10 +31,89 @@
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
+#include "DREAM3DReview/DREAM3DReviewFilters/util/RadixSort.hpp"
+
+namespace
+{
+/**
+ * @brief The AverageSegmentsImpl class collapses runs of tuples into single tuples. Segment s holds the source
+ * tuples order[segmentStarts[s]] through order[segmentStarts[s + 1] - 1]; every component is averaged in double
+ * precision, except for bool components, which take the majority value (ties give true).
+ */
+template <typename T>
+class AverageSegmentsImpl
+{
+public:
+  AverageSegmentsImpl(const T* source, T* dest, size_t numComps, const std::vector<int64_t>& order, const std::vector<size_t>& segmentStarts)
+  : m_Source(source)
+  , m_Dest(dest)
+  , m_NumComps(numComps)
+  , m_Order(order)
+  , m_SegmentStarts(segmentStarts)
+  {
+  }
+
+  void average(size_t start, size_t end) const
+  {
+    std::vector<double> accumulators(m_NumComps);
+    for(size_t s = start; s < end; s++)
+    {
+      std::fill(accumulators.begin(), accumulators.end(), 0.0);
+      for(size_t i = m_SegmentStarts[s]; i < m_SegmentStarts[s + 1]; i++)
+      {
+        const T* tuple = m_Source + m_NumComps * m_Order[i];
+        for(size_t c = 0; c < m_NumComps; c++)
+        {
+          accumulators[c] += static_cast<double>(tuple[c]);
+        }
+      }
+
+      const double count = static_cast<double>(m_SegmentStarts[s + 1] - m_SegmentStarts[s]);
+      for(size_t c = 0; c < m_NumComps; c++)
+      {
+        if constexpr(std::is_same<T, bool>::value)
+        {
+          m_Dest[m_NumComps * s + c] = (accumulators[c] >= 0.5 * count);
+        }
+        else
+        {
+          m_Dest[m_NumComps * s + c] = static_cast<T>(accumulators[c] / count);
+        }
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    average(range.min(), range.max());
+  }
+
+private:
+  const T* m_Source;
+  T* m_Dest;
+  size_t m_NumComps;
+  const std::vector<int64_t>& m_Order;
+  const std::vector<size_t>& m_SegmentStarts;
+};
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void averageSegments(IDataArray::Pointer source, IDataArray::Pointer dest, const std::vector<int64_t>& order, const std::vector<size_t>& segmentStarts)
+{
+  typename DataArray<T>::Pointer sourcePtr = std::dynamic_pointer_cast<DataArray<T>>(source);
+  typename DataArray<T>::Pointer destPtr = std::dynamic_pointer_cast<DataArray<T>>(dest);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, segmentStarts.size() - 1);
+  dataAlg.execute(AverageSegmentsImpl<T>(sourcePtr->getPointer(0), destPtr->getPointer(0), sourcePtr->getNumberOfComponents(), order, segmentStarts));
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -330,55 +411,6 @@ void DownsampleVertexGeometry::removeFractionPoints()
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename T>
-void downsampleDataByAveraging(IDataArray::Pointer source, IDataArray::Pointer dest, std::vector<int64_t>& indices, size_t destIdx)
-{
-  typename DataArray<T>::Pointer sourcePtr = std::dynamic_pointer_cast<DataArray<T>>(source);
-  T* sourceData = sourcePtr->getPointer(0);
-  typename DataArray<T>::Pointer destPtr = std::dynamic_pointer_cast<DataArray<T>>(dest);
-  T* destData = destPtr->getPointer(0);
-
-  double accumulator = 0.0;
-  for(int64_t idx : indices)
-  {
-    accumulator += sourceData[idx];
-  }
-  accumulator /= static_cast<double>(indices.size());
-
-  destData[destIdx] = static_cast<T>(accumulator);
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <>
-void downsampleDataByAveraging<bool>(IDataArray::Pointer source, IDataArray::Pointer dest, std::vector<int64_t>& indices, size_t destIdx)
-{
-  typename DataArray<bool>::Pointer sourcePtr = std::dynamic_pointer_cast<DataArray<bool>>(source);
-  bool* sourceData = sourcePtr->getPointer(0);
-  typename DataArray<bool>::Pointer destPtr = std::dynamic_pointer_cast<DataArray<bool>>(dest);
-  bool* destData = destPtr->getPointer(0);
-
-  size_t counter = 0;
-  bool value = false;
-  for(int64_t idx : indices)
-  {
-    if(sourceData[idx])
-    {
-      counter++;
-    }
-  }
-  if(static_cast<float>(counter) >= 0.5f * static_cast<float>(indices.size()))
-  {
-    value = true;
-  }
-
-  destData[destIdx] = value;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -453,126 +485,88 @@ void DownsampleVertexGeometry::gridDownsample()
   int64_t dims[3] = {bboxMax[0] - bboxMin[0] + 1, bboxMax[1] - bboxMin[1] + 1, bboxMax[2] - bboxMin[2] + 1};
   grid->setDimensions(dims[0], dims[1], dims[2]);
 
-  if(static_cast<int64_t>(grid->getNumberOfElements()) >= numVerts)
-  {
-    QString ss = QObject::tr("The total number of voxels in the sampling grid exceeds the number of vertices in the Vertex Geometry, so no points will be removed");
-    setErrorCondition(-1, ss);
-    return;
-  }
-
   int64_t multiplier[3] = {1, static_cast<int64_t>(grid->getXPoints()), static_cast<int64_t>(grid->getXPoints() * grid->getYPoints())};
-  std::vector<std::vector<int64_t>> vertsInVoxels(grid->getNumberOfElements());
+  const size_t numCells = grid->getNumberOfElements();
 
-  int64_t progIncrement = numVerts / 100;
-  int64_t prog = 1;
-  int64_t progressInt = 0;
+  notifyStatusMessage(QObject::tr("Mapping Vertices to Voxels..."));
+
+  std::vector<uint64_t> cellKeys(numVerts);
+  std::vector<int64_t> order(numVerts);
+  ParallelDataAlgorithm keyAlg;
+  keyAlg.setRange(0, numVerts);
+  keyAlg.execute([&](const SIMPLRange& range) {
+    for(size_t v = range.min(); v < range.max(); v++)
+    {
+      int64_t i = static_cast<int64_t>(std::floor(verts[3 * v + 0] * inverseResolution[0]) - static_cast<float>(bboxMin[0]));
+      int64_t j = static_cast<int64_t>(std::floor(verts[3 * v + 1] * inverseResolution[1]) - static_cast<float>(bboxMin[1]));
+      int64_t k = static_cast<int64_t>(std::floor(verts[3 * v + 2] * inverseResolution[2]) - static_cast<float>(bboxMin[2]));
+      cellKeys[v] = static_cast<uint64_t>(i * multiplier[0] + j * multiplier[1] + k * multiplier[2]);
+      order[v] = static_cast<int64_t>(v);
+    }
+  });
 
-  for(int64_t v = 0; v < numVerts; v++)
+  notifyStatusMessage(QObject::tr("Sorting Vertices by Voxel..."));
+
+  RadixSort::SortPairs(cellKeys, order, static_cast<uint64_t>(numCells - 1));
+  if(getCancel())
   {
-    int64_t i = static_cast<int64_t>(std::floor(verts[3 * v + 0] * inverseResolution[0]) - static_cast<float>(bboxMin[0]));
-    int64_t j = static_cast<int64_t>(std::floor(verts[3 * v + 1] * inverseResolution[1]) - static_cast<float>(bboxMin[1]));
-    int64_t k = static_cast<int64_t>(std::floor(verts[3 * v + 2] * inverseResolution[2]) - static_cast<float>(bboxMin[2]));
-    int64_t index = i * multiplier[0] + j * multiplier[1] + k * multiplier[2];
-    vertsInVoxels[index].push_back(v);
+    return;
+  }
 
-    if(v > prog)
+  // Each run of equal keys is one occupied voxel, visited in the same X-fastest order as the grid itself
+  std::vector<size_t> segmentStarts(1, 0);
+  for(size_t v = 1; v < cellKeys.size(); v++)
+  {
+    if(cellKeys[v] != cellKeys[v - 1])
     {
-      progressInt = static_cast<int64_t>((static_cast<float>(v) / numVerts) * 100.0f);
-      QString ss = QObject::tr("Mapping Vertices to Voxels || %1% Complete").arg(progressInt);
-      notifyStatusMessage(ss);
-      prog = prog + progIncrement;
+      segmentStarts.push_back(v);
     }
   }
+  segmentStarts.push_back(cellKeys.size());
+  std::vector<uint64_t>().swap(cellKeys);
+  const size_t numSegments = segmentStarts.size() - 1;
+  if(static_cast<int64_t>(numSegments) == numVerts)
+  {
+    QString ss = QObject::tr("Every vertex falls in its own voxel of the sampling grid, so no points will be removed");
+    setWarningCondition(-11003, ss);
+  }
 
-  std::vector<float> tmpVerts;
-  progIncrement = (dims[0] * dims[1] * dims[2]) / 100;
-  prog = 1;
-  progressInt = 0;
-  int64_t counter = 0;
-  int64_t vertCounter = 0;
-  float xAvg = 0.0f;
-  float yAvg = 0.0f;
-  float zAvg = 0.0f;
+  notifyStatusMessage(QObject::tr("Performing Grid Downsampling..."));
 
-  AttributeMatrix::Pointer downsampledData = attrMat->deepCopy();
-  QList<QString> headers = downsampledData->getAttributeArrayNames();
+  std::vector<float> tmpVerts(3 * numSegments);
+  ParallelDataAlgorithm vertAlg;
+  vertAlg.setRange(0, numSegments);
+  vertAlg.execute(AverageSegmentsImpl<float>(verts, tmpVerts.data(), 3, order, segmentStarts));
+
+  std::vector<size_t> tDims = {numSegments};
+  AttributeMatrix::Pointer downsampledData = AttributeMatrix::New(tDims, attrMat->getName(), attrMat->getType());
+  QList<QString> headers = attrMat->getAttributeArrayNames();
   for(QList<QString>::iterator iter = headers.begin(); iter != headers.end(); ++iter)
   {
-    IDataArray::Pointer p = downsampledData->getAttributeArray(*iter);
-    QString type = p->getTypeAsString();
+    if(getCancel())
+    {
+      return;
+    }
+    IDataArray::Pointer source = attrMat->getAttributeArray(*iter);
+    QString type = source->getTypeAsString();
     if(type.compare("NeighborList<T>") == 0)
     {
-      attrMat->removeAttributeArray(*iter);
+      continue;
     }
-  }
-
-  size_t globalIndex = 0;
-
-  for(int64_t z = 0; z < dims[2]; z++)
-  {
-    for(int64_t y = 0; y < dims[1]; y++)
+    IDataArray::Pointer dest = source->createNewArray(numSegments, source->getComponentDimensions(), source->getName(), true);
+    EXECUTE_FUNCTION_TEMPLATE(this, averageSegments, source, source, dest, order, segmentStarts)
+    if(getErrorCode() < 0)
     {
-      for(int64_t x = 0; x < dims[0]; x++)
-      {
-        size_t index = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-
-        if(vertsInVoxels[index].empty())
-        {
-          counter++;
-          continue;
-        }
-
-        for(auto vert : vertsInVoxels[index])
-        {
-          vertCounter++;
-          xAvg += verts[3 * vert + 0];
-          yAvg += verts[3 * vert + 1];
-          zAvg += verts[3 * vert + 2];
-        }
-        xAvg /= static_cast<float>(vertCounter);
-        yAvg /= static_cast<float>(vertCounter);
-        zAvg /= static_cast<float>(vertCounter);
-        tmpVerts.push_back(xAvg);
-        tmpVerts.push_back(yAvg);
-        tmpVerts.push_back(zAvg);
-        vertCounter = 0;
-        xAvg = 0.0f;
-        yAvg = 0.0f;
-        zAvg = 0.0f;
-
-        QList<QString> headers = downsampledData->getAttributeArrayNames();
-        for(QList<QString>::iterator iter = headers.begin(); iter != headers.end(); ++iter)
-        {
-          if(getCancel())
-          {
-            return;
-          }
-          IDataArray::Pointer source = attrMat->getAttributeArray(*iter);
-          IDataArray::Pointer dest = downsampledData->getAttributeArray(*iter);
-          EXECUTE_FUNCTION_TEMPLATE(this, downsampleDataByAveraging, source, source, dest, vertsInVoxels[index], globalIndex)
-        }
-        globalIndex++;
-
-        if(counter > prog)
-        {
-          progressInt = static_cast<int64_t>((static_cast<float>(counter) / (dims[0] * dims[1] * dims[2])) * 100.0f);
-          QString ss = QObject::tr("Performing Grid Downsampling || %1% Complete").arg(progressInt);
-          notifyStatusMessage(ss);
-          prog = prog + progIncrement;
-        }
-        counter++;
-      }
+      return;
     }
+    downsampledData->addOrReplaceAttributeArray(dest);
   }
 
-  std::vector<size_t> tDims = {globalIndex};
-  downsampledData->setTupleDimensions(tDims);
-
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getVertexAttrMatPath().getDataContainerName());
   dc->removeAttributeMatrix(attrMat->getName());
   dc->addOrReplaceAttributeMatrix(downsampledData);
 
-  vertices->resizeVertexList(tmpVerts.size() / 3);
+  vertices->resizeVertexList(numSegments);
   float* gridVerts = vertices->getVertexPointer(0);
   std::memcpy(gridVerts, tmpVerts.data(), vertices->getNumberOfVertices() * 3 * sizeof(float));
 }
@@ -14,10 +14,9 @@
 
 #include "ExtractTripleLinesFromTriangleGeometry.h"
 
+#include <algorithm>
 #include <array>
-#include <random>
 #include <unordered_map>
-#include <unordered_set>
 
 #include <QtCore/QTextStream>
 
@@ -32,7 +31,7 @@
 #include "SIMPLib/Geometry/EdgeGeom.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
-#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
@@ -72,6 +71,210 @@ struct EdgeHasher
 
 using VertexMap = std::unordered_map<Vertex, MeshIndexType, VertexHasher>;
 using EdgeMap = std::unordered_map<Edge, MeshIndexType, EdgeHasher>;
+
+constexpr size_t k_SplineDegree = 4;
+
+/**
+ * @brief The TripleLineChains struct stores triple lines as ordered lists of vertices in flat arrays; the vertices
+ * of triple line c are vertices[offsets[c]] through vertices[offsets[c + 1] - 1]
+ */
+struct TripleLineChains
+{
+  std::vector<MeshIndexType> offsets = {0};
+  std::vector<MeshIndexType> vertices;
+};
+
+// -----------------------------------------------------------------------------
+inline bool isQuadPoint(int8_t nodeType)
+{
+  return nodeType == 4 || nodeType == 14;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief FindTripleLineChains Splits an edge network into chains running between junctions (quad points and any
+ * vertex not shared by exactly two edges). Every edge leaving a junction seeds a walk on an explicit work stack;
+ * the edges left unvisited afterwards belong to closed loops. Edges are labeled with their chain (starting at 1).
+ */
+TripleLineChains FindTripleLineChains(const MeshIndexType* edges, MeshIndexType numVerts, MeshIndexType numEdges, const int8_t* nodeTypes, int32_t* edgeChainIds)
+{
+  // Edges containing each vertex, in compressed row form
+  std::vector<MeshIndexType> adjOffsets(numVerts + 1, 0);
+  for(MeshIndexType e = 0; e < numEdges; e++)
+  {
+    adjOffsets[edges[2 * e + 0] + 1]++;
+    adjOffsets[edges[2 * e + 1] + 1]++;
+  }
+  for(MeshIndexType v = 0; v < numVerts; v++)
+  {
+    adjOffsets[v + 1] += adjOffsets[v];
+  }
+  std::vector<MeshIndexType> adjEdges(2 * numEdges);
+  std::vector<MeshIndexType> fill(adjOffsets.begin(), adjOffsets.end() - 1);
+  for(MeshIndexType e = 0; e < numEdges; e++)
+  {
+    adjEdges[fill[edges[2 * e + 0]]++] = e;
+    adjEdges[fill[edges[2 * e + 1]]++] = e;
+  }
+
+  auto isJunction = [&](MeshIndexType v) { return (adjOffsets[v + 1] - adjOffsets[v]) != 2 || isQuadPoint(nodeTypes[v]); };
+
+  std::vector<uint8_t> visited(numEdges, 0);
+  TripleLineChains chains;
+  chains.vertices.reserve(numEdges + numVerts / 2);
+
+  auto walk = [&](MeshIndexType start, MeshIndexType edge) {
+    if(visited[edge] != 0)
+    {
+      return;
+    }
+    const int32_t chainId = static_cast<int32_t>(chains.offsets.size());
+    chains.vertices.push_back(start);
+    MeshIndexType current = start;
+    while(true)
+    {
+      visited[edge] = 1;
+      edgeChainIds[edge] = chainId;
+      current = (edges[2 * edge + 0] == current) ? edges[2 * edge + 1] : edges[2 * edge + 0];
+      chains.vertices.push_back(current);
+      if(current == start || isJunction(current))
+      {
+        break;
+      }
+      // Continue through the other edge of this two-edge vertex
+      const MeshIndexType* atVert = adjEdges.data() + adjOffsets[current];
+      edge = (atVert[0] == edge) ? atVert[1] : atVert[0];
+      if(visited[edge] != 0)
+      {
+        break;
+      }
+    }
+    chains.offsets.push_back(static_cast<MeshIndexType>(chains.vertices.size()));
+  };
+
+  std::vector<std::pair<MeshIndexType, MeshIndexType>> workStack;
+  for(MeshIndexType v = numVerts; v-- > 0;)
+  {
+    if(isJunction(v))
+    {
+      for(MeshIndexType k = adjOffsets[v + 1]; k-- > adjOffsets[v];)
+      {
+        workStack.emplace_back(v, adjEdges[k]);
+      }
+    }
+  }
+  while(!workStack.empty())
+  {
+    std::pair<MeshIndexType, MeshIndexType> seed = workStack.back();
+    workStack.pop_back();
+    walk(seed.first, seed.second);
+  }
+
+  for(MeshIndexType e = 0; e < numEdges; e++)
+  {
+    walk(edges[2 * e + 0], e);
+  }
+
+  return chains;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief ClampedKnot Returns knot i of the clamped uniform knot vector of a B-spline with numPoints control
+ * points: degree + 1 zeros, then 1, 2, ..., and finally degree + 1 copies of numPoints - degree
+ */
+inline float ClampedKnot(size_t i, size_t degree, size_t numPoints)
+{
+  if(i <= degree)
+  {
+    return 0.0f;
+  }
+  if(i >= numPoints)
+  {
+    return static_cast<float>(numPoints - degree);
+  }
+  return static_cast<float>(i - degree);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief EvaluateBspline Evaluates a clamped uniform B-spline at t in [0, numPoints - degree] with de Boor's
+ * algorithm. Only the degree + 1 control points supporting t are read, through controlPoint(k).
+ */
+template <typename ControlPointAccessor>
+void EvaluateBspline(ControlPointAccessor&& controlPoint, size_t numPoints, size_t degree, float t, float* result)
+{
+  const size_t span = std::min(degree + static_cast<size_t>(t), numPoints - 1);
+  std::array<std::array<float, 3>, k_SplineDegree + 1> d;
+  for(size_t j = 0; j <= degree; j++)
+  {
+    const float* point = controlPoint(span - degree + j);
+    d[j] = {point[0], point[1], point[2]};
+  }
+  for(size_t r = 1; r <= degree; r++)
+  {
+    for(size_t j = degree; j >= r; j--)
+    {
+      const size_t i = span - degree + j;
+      const float low = ClampedKnot(i, degree, numPoints);
+      const float high = ClampedKnot(i + degree + 1 - r, degree, numPoints);
+      const float alpha = (high > low) ? (t - low) / (high - low) : 0.0f;
+      for(size_t c = 0; c < 3; c++)
+      {
+        d[j][c] = (1.0f - alpha) * d[j - 1][c] + alpha * d[j][c];
+      }
+    }
+  }
+  result[0] = d[degree][0];
+  result[1] = d[degree][1];
+  result[2] = d[degree][2];
+}
+
+/**
+ * @brief The SmoothTripleLinesImpl class moves the interior vertices of each triple line onto a clamped B-spline
+ * that uses the vertices of the triple line as control points. The end points are interpolated by the spline and
+ * stay fixed; vertex k of n is placed at the curve parameter k / (n - 1) of the way along the curve.
+ */
+class SmoothTripleLinesImpl
+{
+public:
+  SmoothTripleLinesImpl(const TripleLineChains& chains, const std::vector<float>& controlPoints, float* vertices)
+  : m_Chains(chains)
+  , m_ControlPoints(controlPoints)
+  , m_Vertices(vertices)
+  {
+  }
+
+  void smooth(size_t start, size_t end) const
+  {
+    for(size_t c = start; c < end; c++)
+    {
+      const MeshIndexType* chain = m_Chains.vertices.data() + m_Chains.offsets[c];
+      const size_t numPoints = m_Chains.offsets[c + 1] - m_Chains.offsets[c];
+      if(numPoints < 3)
+      {
+        continue;
+      }
+      const size_t degree = std::min(k_SplineDegree, numPoints - 1);
+      const float scale = static_cast<float>(numPoints - degree) / static_cast<float>(numPoints - 1);
+      auto controlPoint = [&](size_t k) { return m_ControlPoints.data() + 3 * chain[k]; };
+      for(size_t k = 1; k + 1 < numPoints; k++)
+      {
+        EvaluateBspline(controlPoint, numPoints, degree, static_cast<float>(k) * scale, m_Vertices + 3 * chain[k]);
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    smooth(range.min(), range.max());
+  }
+
+private:
+  const TripleLineChains& m_Chains;
+  const std::vector<float>& m_ControlPoints;
+  float* m_Vertices;
+};
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -102,7 +305,7 @@ void ExtractTripleLinesFromTriangleGeometry::initialize()
 void ExtractTripleLinesFromTriangleGeometry::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
-  parameters.push_back(SIMPL_NEW_BOOL_FP("Compactify Triple Lines", SmoothTripleLines, FilterParameter::Category::Parameter, ExtractTripleLinesFromTriangleGeometry));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Smooth Triple Lines", SmoothTripleLines, FilterParameter::Category::Parameter, ExtractTripleLinesFromTriangleGeometry));
   DataArraySelectionFilterParameter::RequirementType dasReq = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Int8, 1, AttributeMatrix::Type::Vertex, IGeometry::Type::Triangle);
   parameters.push_back(SeparatorFilterParameter::Create("Vertex Data", FilterParameter::Category::RequiredArray));
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Node Types", NodeTypesArrayPath, FilterParameter::Category::RequiredArray, ExtractTripleLinesFromTriangleGeometry, dasReq));
@@ -112,6 +315,7 @@ void ExtractTripleLinesFromTriangleGeometry::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_STRING_FP("Node Types", NodeTypesArrayName, FilterParameter::Category::CreatedArray, ExtractTripleLinesFromTriangleGeometry));
   parameters.push_back(SeparatorFilterParameter::Create("Edge Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Edge Attribute Matrix", EdgeAttributeMatrixName, FilterParameter::Category::CreatedArray, ExtractTripleLinesFromTriangleGeometry));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Triple Line Ids", TripleLineIdsArrayName, FilterParameter::Category::CreatedArray, ExtractTripleLinesFromTriangleGeometry));
   setFilterParameters(parameters);
 }
 
@@ -163,6 +367,9 @@ void ExtractTripleLinesFromTriangleGeometry::dataCheck()
 
   DataArrayPath path(getEdgeGeometry(), getVertexAttributeMatrixName(), getNodeTypesArrayName());
   m_TripleLineNodeTypesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<Int8ArrayType>(this, path, 0, cDims);
+
+  path.update(getEdgeGeometry(), getEdgeAttributeMatrixName(), getTripleLineIdsArrayName());
+  m_TripleLineIdsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<Int32ArrayType>(this, path, 0, cDims);
 }
 
 // -----------------------------------------------------------------------------
@@ -494,336 +701,34 @@ void ExtractTripleLinesFromTriangleGeometry::extractTripleLines()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void burnVertices(std::vector<MeshIndexType> vertsToBurn, MeshIndexType seedVert, std::unordered_set<MeshIndexType>& burnedVerts, MeshIndexType& vertCounter, MeshIndexType& edgeCounter,
-                  float* vertPtr, MeshIndexType* edgePtr, int8_t* nodeTypes, ElementDynamicList::Pointer edgesContainingVert, VertexMap& vertexMap, EdgeMap& edgeMap, std::vector<Vertex>& tmpVerts,
-                  std::vector<Edge>& tmpEdges, std::vector<int8_t>& tmpNodeTypes, AbstractFilter* filter)
-{
-  if(vertsToBurn.empty())
-  {
-    return;
-  }
-
-  std::vector<MeshIndexType> chain;
-  MeshIndexType startVert = 0;
-  MeshIndexType endVert = 0;
-  for(auto vert : vertsToBurn)
-  {
-    burnedVerts.insert(vert);
-
-    Vertex headVert = {vertPtr[3 * vert + 0], vertPtr[3 * vert + 1], vertPtr[3 * vert + 2]};
-    auto hiter = vertexMap.find(headVert);
-    if(hiter == vertexMap.end())
-    {
-      tmpVerts.push_back(headVert);
-      tmpNodeTypes.push_back(nodeTypes[vert]);
-      vertexMap[headVert] = vertCounter;
-      vertCounter++;
-    }
-
-    uint16_t numEdgesToVert = edgesContainingVert->getNumberOfElements(vert);
-    MeshIndexType* edgesAtVert = edgesContainingVert->getElementListPointer(vert);
-    for(uint16_t i = 0; i < numEdgesToVert; i++)
-    {
-      startVert = vert;
-      endVert = (edgePtr[2 * edgesAtVert[i] + 0] != startVert) ? edgePtr[2 * edgesAtVert[i] + 0] : edgePtr[2 * edgesAtVert[i] + 1];
-      if((nodeTypes[endVert] == 4 || nodeTypes[endVert] == 14) && burnedVerts.count(endVert) == 0)
-      {
-        Vertex tailVert = {vertPtr[3 * endVert + 0], vertPtr[3 * endVert + 1], vertPtr[3 * endVert + 2]};
-        auto titer = vertexMap.find(tailVert);
-        if(titer == vertexMap.end())
-        {
-          tmpVerts.push_back(tailVert);
-          tmpNodeTypes.push_back(nodeTypes[endVert]);
-          vertexMap[tailVert] = vertCounter;
-          vertCounter++;
-        }
-
-        MeshIndexType head = vertexMap[headVert];
-        MeshIndexType tail = vertexMap[tailVert];
-        if(head > tail)
-        {
-          std::swap(head, tail);
-        }
-
-        Edge tmpEdge = {head, tail};
-        auto eiter = edgeMap.find(tmpEdge);
-        if(eiter == edgeMap.end())
-        {
-          tmpEdges.push_back(tmpEdge);
-          edgeMap[tmpEdge] = edgeCounter;
-          edgeCounter++;
-        }
-        return;
-      }
-    }
-
-    for(uint16_t i = 0; i < numEdgesToVert; i++)
-    {
-      startVert = vert;
-      endVert = (edgePtr[2 * edgesAtVert[i] + 0] != startVert) ? edgePtr[2 * edgesAtVert[i] + 0] : edgePtr[2 * edgesAtVert[i] + 1];
-      if(startVert != endVert)
-      {
-        if(burnedVerts.count(endVert) > 0)
-        {
-          continue;
-        }
-
-        Vertex tailVert = {vertPtr[3 * endVert + 0], vertPtr[3 * endVert + 1], vertPtr[3 * endVert + 2]};
-        auto titer = vertexMap.find(tailVert);
-        if(titer == vertexMap.end())
-        {
-          tmpVerts.push_back(tailVert);
-          tmpNodeTypes.push_back(nodeTypes[endVert]);
-          vertexMap[tailVert] = vertCounter;
-          vertCounter++;
-        }
-
-        MeshIndexType head = vertexMap[headVert];
-        MeshIndexType tail = vertexMap[tailVert];
-        if(head > tail)
-        {
-          std::swap(head, tail);
-        }
-
-        Edge tmpEdge = {head, tail};
-        auto eiter = edgeMap.find(tmpEdge);
-        if(eiter == edgeMap.end())
-        {
-          tmpEdges.push_back(tmpEdge);
-          edgeMap[tmpEdge] = edgeCounter;
-          edgeCounter++;
-        }
-
-        if(!(nodeTypes[endVert] == 4 || nodeTypes[endVert] == 14))
-        {
-          chain.push_back(endVert);
-        }
-      }
-    }
-  }
-
-  QString ss = QObject::tr("Burned %1 Vertices").arg(burnedVerts.size());
-  filter->notifyStatusMessage(ss);
-
-  burnVertices(chain, seedVert, burnedVerts, vertCounter, edgeCounter, vertPtr, edgePtr, nodeTypes, edgesContainingVert, vertexMap, edgeMap, tmpVerts, tmpEdges, tmpNodeTypes, filter);
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ExtractTripleLinesFromTriangleGeometry::smoothTripleLines()
+void ExtractTripleLinesFromTriangleGeometry::findTripleLines()
 {
   EdgeGeom::Pointer tripleLineEdge = getDataContainerArray()->getDataContainer(m_EdgeGeometry)->getGeometryAs<EdgeGeom>();
-  tripleLineEdge->findElementsContainingVert();
   float* vertPtr = tripleLineEdge->getVertexPointer(0);
   MeshIndexType* edgePtr = tripleLineEdge->getEdgePointer(0);
-  ElementDynamicList::Pointer edgesContainingVert = tripleLineEdge->getElementsContainingVert();
   MeshIndexType numVerts = tripleLineEdge->getNumberOfVertices();
-
-  VertexMap vertexMap;
-  EdgeMap edgeMap;
-  std::vector<Vertex> tmpVerts;
-  std::vector<Edge> tmpEdges;
-  std::vector<int8_t> tmpNodeTypes;
-  std::vector<int32_t> tmpTripleLineIds;
-  MeshIndexType vertCounter = 0;
-  MeshIndexType edgeCounter = 0;
-  // int32_t tripleLineCounter = 1;
-  MeshIndexType seedVert = -1;
-
-  // for(int64_t i = 0; i < numVerts; i++)
-  //{
-  //  if(m_TripleLineNodeTypes[i] == 4 || m_TripleLineNodeTypes[i] == 14)
-  //  {
-  //    bool valid = true;
-  //    uint16_t numEdgesToVert = edgesContainingVert->getNumberOfElements(i);
-  //    int64_t* edgesAtVert = edgesContainingVert->getElementListPointer(i);
-  //    for(uint16_t j = 0; j < numEdgesToVert; j++)
-  //    {
-  //      if(((m_TripleLineNodeTypes[edgePtr[2 * edgesAtVert[j] + 0]] == 4 || m_TripleLineNodeTypes[edgePtr[2 * edgesAtVert[j] + 0]] == 14) && edgePtr[2 * edgesAtVert[j] + 0] != i) ||
-  //         ((m_TripleLineNodeTypes[edgePtr[2 * edgesAtVert[j] + 1]] == 4 || m_TripleLineNodeTypes[edgePtr[2 * edgesAtVert[j] + 1]] == 14) && edgePtr[2 * edgesAtVert[j] + 1] != i))
-  //      {
-  //        valid = false;
-  //        break;
-  //      }
-  //    }
-  //    if(valid)
-  //    {
-  //      seedVert = i;
-  //      break;
-  //    }
-  //  }
-  //}
-
-  // if(seedVert < 0)
-  //{
-  //  setErrorCondition(-1, "Unable to find isolated seed quad point");
-  //  return;
-  //}
-
-  float minExtents[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
-  float maxExtents[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
-  for(MeshIndexType i = 0; i < numVerts; i++)
-  {
-    if(vertPtr[3 * i + 0] < minExtents[0])
-    {
-      minExtents[0] = vertPtr[3 * i + 0];
-    }
-    if(vertPtr[3 * i + 0] > maxExtents[0])
-    {
-      vertPtr[0] = vertPtr[3 * i + 0];
-    }
-    if(vertPtr[3 * i + 1] < minExtents[1])
-    {
-      minExtents[1] = vertPtr[3 * i + 1];
-    }
-    if(vertPtr[3 * i + 1] > maxExtents[1])
-    {
-      maxExtents[1] = vertPtr[3 * i + 1];
-    }
-    if(vertPtr[3 * i + 2] < minExtents[2])
-    {
-      minExtents[2] = vertPtr[3 * i + 2];
-    }
-    if(vertPtr[3 * i + 2] > maxExtents[2])
-    {
-      maxExtents[2] = vertPtr[3 * i + 2];
-    }
-  }
-
-  Vertex vert = {minExtents[0], minExtents[1], minExtents[2]};
-  tmpVerts.push_back(vert);
-  tmpNodeTypes.push_back(m_TripleLineNodeTypes[seedVert]);
-  vertexMap[vert] = vertCounter;
-  vertCounter++;
-
-  uint16_t numEdgesToVert = edgesContainingVert->getNumberOfElements(seedVert);
-  MeshIndexType* edgesAtVert = edgesContainingVert->getElementListPointer(seedVert);
-  std::unordered_set<MeshIndexType> burnedVerts;
-
-  for(uint16_t i = 0; i < numEdgesToVert; i++)
-  {
-    burnedVerts.insert(edgePtr[2 * edgesAtVert[i] + 0]);
-    burnedVerts.insert(edgePtr[2 * edgesAtVert[i] + 1]);
-  }
-
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_int_distribution<> dis(0, numEdgesToVert - 1);
-  uint16_t idx = dis(gen);
-  MeshIndexType begin = (edgePtr[2 * edgesAtVert[idx] + 0] != seedVert) ? edgePtr[2 * edgesAtVert[idx] + 0] : edgePtr[2 * edgesAtVert[idx] + 1];
-
-  Edge tmpEdge = {0, 1};
-  tmpEdges.push_back(tmpEdge);
-  edgeMap[tmpEdge] = edgeCounter;
-  edgeCounter++;
-
-  std::vector<MeshIndexType> vertsToBurn = {begin};
-
-  burnVertices(vertsToBurn, seedVert, burnedVerts, vertCounter, edgeCounter, vertPtr, edgePtr, m_TripleLineNodeTypes, edgesContainingVert, vertexMap, edgeMap, tmpVerts, tmpEdges, tmpNodeTypes, this);
-
-  std::vector<std::vector<float>> controlPoints(tmpVerts.size(), std::vector<float>(3, 0.0f));
-  for(MeshIndexType i = 0; i < controlPoints.size(); i++)
-  {
-    controlPoints[i][0] = tmpVerts[i][0];
-    controlPoints[i][1] = tmpVerts[i][1];
-    controlPoints[i][2] = tmpVerts[i][2];
-  }
-
-  std::vector<float> smoothPoints = computeBsplineInterpolation(controlPoints, 0, 1);
-  VertexGeom::Pointer vertex = VertexGeom::CreateGeometry(smoothPoints.size() / 3, SIMPL::Geometry::VertexGeometry);
-  MeshIndexType smoothNumVerts = vertex->getNumberOfVertices();
-  float* smoothPtr = vertex->getVertexPointer(0);
-  std::memcpy(smoothPtr, smoothPoints.data(), sizeof(float) * smoothNumVerts * 3);
-  DataContainer::Pointer dc = DataContainer::New("TEST_SMOOTHING");
-  dc->setGeometry(vertex);
-  getDataContainerArray()->addOrReplaceDataContainer(dc);
-
-  tripleLineEdge->resizeVertexList(tmpVerts.size());
-  tripleLineEdge->resizeEdgeList(tmpEdges.size());
-  vertPtr = tripleLineEdge->getVertexPointer(0);
-  edgePtr = tripleLineEdge->getEdgePointer(0);
-  for(MeshIndexType i = 0; i < tmpVerts.size(); i++)
-  {
-    vertPtr[3 * i + 0] = tmpVerts[i][0];
-    vertPtr[3 * i + 1] = tmpVerts[i][1];
-    vertPtr[3 * i + 2] = tmpVerts[i][2];
-  }
-  for(MeshIndexType i = 0; i < tmpEdges.size(); i++)
-  {
-    edgePtr[2 * i + 0] = tmpEdges[i][0];
-    edgePtr[2 * i + 1] = tmpEdges[i][1];
-  }
-
-  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getDataContainer(m_EdgeGeometry)->getAttributeMatrix(m_VertexAttributeMatrixName);
-  std::vector<size_t> tDims(1, tripleLineEdge->getNumberOfVertices());
-  attrMat->resizeAttributeArrays(tDims);
-  attrMat = getDataContainerArray()->getDataContainer(m_EdgeGeometry)->getAttributeMatrix(m_EdgeAttributeMatrixName);
-  tDims[0] = tripleLineEdge->getNumberOfEdges();
-  attrMat->resizeAttributeArrays(tDims);
+  MeshIndexType numEdges = tripleLineEdge->getNumberOfEdges();
 
   m_TripleLineNodeTypes = m_TripleLineNodeTypesPtr.lock()->getPointer(0);
-  std::memcpy(m_TripleLineNodeTypes, tmpNodeTypes.data(), sizeof(int8_t) * tripleLineEdge->getNumberOfVertices());
-}
+  int32_t* tripleLineIds = m_TripleLineIdsPtr.lock()->getPointer(0);
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-std::vector<float> ExtractTripleLinesFromTriangleGeometry::computeBsplineInterpolation(std::vector<std::vector<float>> points, float minVal, float maxVal)
-{
-  std::vector<float> result;
-  size_t counter = 1;
-  for(float value = minVal; value <= maxVal; value += 0.01f)
-  {
-    size_t degree = 4;
-    auto numKnots = points.size() + degree + 1;
-    std::vector<float> knots(numKnots);
-    std::vector<float> weights(points.size(), 1.0f);
-    std::iota(std::begin(knots), std::end(knots), 0);
-    float domainLow = static_cast<float>(degree);
-    float domainHigh = static_cast<float>(knots.size() - 1 - degree);
-    float low = knots[static_cast<size_t>(domainLow)];
-    float high = knots[static_cast<size_t>(domainHigh)];
-    float t = value * (high - low) + low;
-    size_t s;
-    for(s = domainLow; s < domainHigh; s++)
-    {
-      if(t >= knots[s] && t <= knots[s + 1])
-      {
-        break;
-      }
-    }
-
-    std::vector<std::vector<float>> v(points);
-    for(auto&& point : v)
-    {
-      point.push_back(1.0f);
-    }
-
-    float alpha;
-    for(size_t l = 1; l <= degree; l++)
-    {
-      for(size_t i = s; i > (s - degree - 1 + 1); i--)
-      {
-        alpha = (t - knots[i]) / (knots[i + degree + 1 - 1] - knots[i]);
-        for(size_t j = 0; j < (3 + 1); j++)
-        {
-          v[i][j] = (1 - alpha) * v[i - 1][j] + alpha * v[i][j];
-        }
-      }
-    }
+  TripleLineChains chains = FindTripleLineChains(edgePtr, numVerts, numEdges, m_TripleLineNodeTypes, tripleLineIds);
+  size_t numChains = chains.offsets.size() - 1;
 
-    for(size_t i = 0; i < 3; i++)
-    {
-      result.push_back(v[s][i] / v[s][3]);
-    }
+  QString ss = QObject::tr("Found %1 Triple Lines").arg(numChains);
+  notifyStatusMessage(ss);
 
-    QString ss = QObject::tr("Smoothing Triple Line || Iteration %1").arg(counter);
-    notifyStatusMessage(ss);
-    counter++;
+  if(!m_SmoothTripleLines)
+  {
+    return;
   }
 
-  return result;
+  // Every triple line reads the unsmoothed positions and only moves its own interior vertices, so the triple
+  // lines are smoothed independently of each other
+  std::vector<float> controlPoints(vertPtr, vertPtr + 3 * numVerts);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChains);
+  dataAlg.execute(SmoothTripleLinesImpl(chains, controlPoints, vertPtr));
 }
 
 // -----------------------------------------------------------------------------
@@ -845,10 +750,7 @@ void ExtractTripleLinesFromTriangleGeometry::execute()
     return;
   }
 
-  if(m_SmoothTripleLines)
-  {
-    smoothTripleLines();
-  }
+  findTripleLines();
 
   notifyStatusMessage("Complete");
 }
@@ -1025,3 +927,15 @@ bool ExtractTripleLinesFromTriangleGeometry::getSmoothTripleLines() const
 {
   return m_SmoothTripleLines;
 }
+
+// -----------------------------------------------------------------------------
+void ExtractTripleLinesFromTriangleGeometry::setTripleLineIdsArrayName(const QString& value)
+{
+  m_TripleLineIdsArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString ExtractTripleLinesFromTriangleGeometry::getTripleLineIdsArrayName() const
+{
+  return m_TripleLineIdsArrayName;
+}
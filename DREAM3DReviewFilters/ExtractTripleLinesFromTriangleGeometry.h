@@ -105,6 +105,17 @@ public:
   QString getNodeTypesArrayName() const;
   Q_PROPERTY(QString NodeTypesArrayName READ getNodeTypesArrayName WRITE setNodeTypesArrayName)
 
+  /**
+   * @brief Setter property for TripleLineIdsArrayName
+   */
+  void setTripleLineIdsArrayName(const QString& value);
+  /**
+   * @brief Getter property for TripleLineIdsArrayName
+   * @return Value of TripleLineIdsArrayName
+   */
+  QString getTripleLineIdsArrayName() const;
+  Q_PROPERTY(QString TripleLineIdsArrayName READ getTripleLineIdsArrayName WRITE setTripleLineIdsArrayName)
+
   /**
    * @brief Setter property for SmoothTripleLines
    */
@@ -176,9 +187,12 @@ protected:
 
   void extractTripleLines();
 
-  void smoothTripleLines();
-
-  std::vector<float> computeBsplineInterpolation(std::vector<std::vector<float>> points, float minVal, float maxVal);
+  /**
+   * @brief findTripleLines Splits the extracted edges into triple lines, the chains of edges running between
+   * quad points or other junctions, labels each edge with its triple line and, if requested, smooths the
+   * interior vertices of every triple line with a B-spline through its vertices
+   */
+  void findTripleLines();
 
   /**
    * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
@@ -195,12 +209,14 @@ private:
   int8_t* m_NodeTypes = nullptr;
   std::weak_ptr<DataArray<int8_t>> m_TripleLineNodeTypesPtr;
   int8_t* m_TripleLineNodeTypes = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_TripleLineIdsPtr;
 
   DataArrayPath m_NodeTypesArrayPath = {SIMPL::Defaults::TriangleDataContainerName, SIMPL::Defaults::VertexAttributeMatrixName, SIMPL::VertexData::SurfaceMeshNodeType};
   QString m_EdgeGeometry = {SIMPL::Defaults::EdgeDataContainerName};
   QString m_VertexAttributeMatrixName = {SIMPL::Defaults::VertexAttributeMatrixName};
   QString m_EdgeAttributeMatrixName = {SIMPL::Defaults::EdgeAttributeMatrixName};
   QString m_NodeTypesArrayName = {SIMPL::VertexData::SurfaceMeshNodeType};
+  QString m_TripleLineIdsArrayName = {"TripleLineIds"};
   bool m_SmoothTripleLines = false;
 
 public:
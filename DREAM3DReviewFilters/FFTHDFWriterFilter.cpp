@@ -4,6 +4,8 @@
 
 #include "FFTHDFWriterFilter.h"
 
+#include <algorithm>
+
 #include <QtCore/QDir>
 #include <QtCore/QTextStream>
 
@@ -13,12 +15,15 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
 
+#include "H5Support/H5Lite.h"
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Utilities.h"
 
@@ -37,6 +42,96 @@ FFTHDFWriterFilter::FFTHDFWriterFilter() = default;
 // -----------------------------------------------------------------------------
 FFTHDFWriterFilter::~FFTHDFWriterFilter() = default;
 
+namespace
+{
+/**
+ * @brief Writes a cell array as a chunked HDF5 dataset with optional shuffle and deflate
+ * filters. The dataset layout and attributes match DataArray::writeH5Data so the output
+ * remains readable by the DREAM3D reader and by the MASSIF solver.
+ */
+template <typename T>
+int32_t writeChunkedDataArray(hid_t gid, DataArray<T>& dataArray, const std::vector<size_t>& tDims, const IntVec3Type& chunkDims, int compressionLevel, bool useShuffle)
+{
+  std::vector<size_t> cDims = dataArray.getComponentDimensions();
+
+  // HDF5 is row major, so the slowest varying tuple dimension leads and the components trail
+  std::vector<hsize_t> h5Dims;
+  std::vector<hsize_t> h5ChunkDims;
+  for(size_t i = tDims.size(); i > 0; i--)
+  {
+    size_t dim = tDims[i - 1];
+    size_t chunk = (i - 1) < 3 ? std::min(static_cast<size_t>(chunkDims[i - 1]), dim) : dim;
+    h5Dims.push_back(static_cast<hsize_t>(dim));
+    h5ChunkDims.push_back(static_cast<hsize_t>(std::max(chunk, static_cast<size_t>(1))));
+  }
+  for(const auto& cDim : cDims)
+  {
+    h5Dims.push_back(static_cast<hsize_t>(cDim));
+    h5ChunkDims.push_back(static_cast<hsize_t>(cDim));
+  }
+  int32_t rank = static_cast<int32_t>(h5Dims.size());
+
+  hid_t dataType = H5Lite::HDFTypeForPrimitive(static_cast<T>(0));
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  herr_t err = H5Pset_chunk(dcpl, rank, h5ChunkDims.data());
+  if(err >= 0 && useShuffle)
+  {
+    err = H5Pset_shuffle(dcpl);
+  }
+  if(err >= 0 && compressionLevel > 0)
+  {
+    err = H5Pset_deflate(dcpl, static_cast<uint32_t>(compressionLevel));
+  }
+  if(err < 0)
+  {
+    H5Pclose(dcpl);
+    return err;
+  }
+
+  std::string name = dataArray.getName().toStdString();
+  hid_t spaceId = H5Screate_simple(rank, h5Dims.data(), nullptr);
+  hid_t did = H5Dcreate(gid, name.c_str(), dataType, spaceId, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+  if(did < 0)
+  {
+    H5Sclose(spaceId);
+    H5Pclose(dcpl);
+    return -1;
+  }
+  // A single write over the full extent lets HDF5 visit every chunk exactly once, so each
+  // chunk is shuffled and deflated once without round trips through the chunk cache
+  err = H5Dwrite(did, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, dataArray.getPointer(0));
+  H5Dclose(did);
+  H5Sclose(spaceId);
+  H5Pclose(dcpl);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  std::vector<hsize_t> attrDims(1, 0);
+  std::vector<uint64_t> tupleDims(tDims.begin(), tDims.end());
+  attrDims[0] = static_cast<hsize_t>(tupleDims.size());
+  err = QH5Lite::writeVectorAttribute(gid, dataArray.getName(), SIMPL::HDF5::TupleDimensions, attrDims, tupleDims);
+  if(err < 0)
+  {
+    return err;
+  }
+  std::vector<uint64_t> compDims(cDims.begin(), cDims.end());
+  attrDims[0] = static_cast<hsize_t>(compDims.size());
+  err = QH5Lite::writeVectorAttribute(gid, dataArray.getName(), SIMPL::HDF5::ComponentDimensions, attrDims, compDims);
+  if(err < 0)
+  {
+    return err;
+  }
+  err = QH5Lite::writeScalarAttribute(gid, dataArray.getName(), SIMPL::HDF5::DataArrayVersion, dataArray.getClassVersion());
+  if(err < 0)
+  {
+    return err;
+  }
+  return QH5Lite::writeStringAttribute(gid, dataArray.getName(), SIMPL::HDF5::ObjectType, dataArray.getNameOfClass());
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -56,6 +151,12 @@ void FFTHDFWriterFilter::setupFilterParameters()
                                                          SIMPL_BIND_SETTER(FFTHDFWriterFilter, this, EigenstrainsOutputFile), SIMPL_BIND_GETTER(FFTHDFWriterFilter, this, EigenstrainsOutputFile),
                                                          "*.dream3d", ""));
 
+  std::vector<QString> chunkedProps = {"ChunkDimensions", "CompressionLevel", "UseShuffleFilter"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Chunked Compression", UseChunkedCompression, FilterParameter::Category::Parameter, FFTHDFWriterFilter, chunkedProps));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Chunk Dimensions (Voxels)", ChunkDimensions, FilterParameter::Category::Parameter, FFTHDFWriterFilter));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Compression Level (0-9)", CompressionLevel, FilterParameter::Category::Parameter, FFTHDFWriterFilter));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Use Shuffle Filter", UseShuffleFilter, FilterParameter::Category::Parameter, FFTHDFWriterFilter));
+
   //--------------
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
@@ -95,6 +196,10 @@ void FFTHDFWriterFilter::readFilterParameters(AbstractFilterParametersReader* re
   setOutputFile(reader->readString("OutputFile", getOutputFile()));
   setWriteEigenstrains(reader->readValue("WriteEigenstrains", getWriteEigenstrains()));
   setEigenstrainsOutputFile(reader->readString("EigenstrainsOutputFile", getEigenstrainsOutputFile()));
+  setUseChunkedCompression(reader->readValue("UseChunkedCompression", getUseChunkedCompression()));
+  setChunkDimensions(reader->readIntVec3("ChunkDimensions", getChunkDimensions()));
+  setCompressionLevel(reader->readValue("CompressionLevel", getCompressionLevel()));
+  setUseShuffleFilter(reader->readValue("UseShuffleFilter", getUseShuffleFilter()));
   //----------------------------
   setCellEulerAnglesArrayPath(reader->readDataArrayPath("CellEulerAnglesArrayPath", getCellEulerAnglesArrayPath()));
   setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath()));
@@ -132,6 +237,20 @@ void FFTHDFWriterFilter::dataCheck()
     FileSystemPathHelper::CheckOutputFile(this, "Eigenstrains Output File Name", getEigenstrainsOutputFile(), true);
   }
 
+  if(m_UseChunkedCompression)
+  {
+    if(m_ChunkDimensions[0] < 1 || m_ChunkDimensions[1] < 1 || m_ChunkDimensions[2] < 1)
+    {
+      ss = QObject::tr("All chunk dimensions must be at least 1 (%1, %2, %3)").arg(m_ChunkDimensions[0]).arg(m_ChunkDimensions[1]).arg(m_ChunkDimensions[2]);
+      setErrorCondition(-11115, ss);
+    }
+    if(m_CompressionLevel < 0 || m_CompressionLevel > 9)
+    {
+      ss = QObject::tr("The compression level must be between 0 and 9 (%1)").arg(m_CompressionLevel);
+      setErrorCondition(-11116, ss);
+    }
+  }
+
   QVector<DataArrayPath> dataArrayPaths;
 
   std::vector<size_t> cDims(1, 1);
@@ -233,17 +352,24 @@ void FFTHDFWriterFilter::execute()
 
   AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(m_FeatureIdsArrayPath);
   std::vector<size_t> tDims = attrMat->getTupleDimensions();
-  m_FeatureIdsPtr.lock()->writeH5Data(dcaGid, tDims);
-  //     H5Lite::writePointerDataset;
+  if(writeDataArray(dcaGid, m_FeatureIdsPtr.lock(), tDims) < 0)
+  {
+    return;
+  }
 
   attrMat = getDataContainerArray()->getAttributeMatrix(m_CellPhasesArrayPath);
   tDims = attrMat->getTupleDimensions();
-  m_CellPhasesPtr.lock()->writeH5Data(dcaGid, tDims);
+  if(writeDataArray(dcaGid, m_CellPhasesPtr.lock(), tDims) < 0)
+  {
+    return;
+  }
 
   attrMat = getDataContainerArray()->getAttributeMatrix(m_CellEulerAnglesArrayPath);
   tDims = attrMat->getTupleDimensions();
-  m_CellEulerAnglesPtr.lock()->writeH5Data(dcaGid, tDims);
-  H5GroupAutoCloser groupCloser(dcaGid);
+  if(writeDataArray(dcaGid, m_CellEulerAnglesPtr.lock(), tDims) < 0)
+  {
+    return;
+  }
 
   // MASSIF Eigenstrains file
   if(m_WriteEigenstrains)
@@ -281,12 +407,17 @@ void FFTHDFWriterFilter::execute()
 
     attrMat = getDataContainerArray()->getAttributeMatrix(m_FeatureIdsArrayPath);
     tDims = attrMat->getTupleDimensions();
-    m_FeatureIdsPtr.lock()->writeH5Data(dcaGidEig, tDims);
+    if(writeDataArray(dcaGidEig, m_FeatureIdsPtr.lock(), tDims) < 0)
+    {
+      return;
+    }
 
     attrMat = getDataContainerArray()->getAttributeMatrix(m_CellEigenstrainsArrayPath);
     tDims = attrMat->getTupleDimensions();
-    m_CellEigenstrainsPtr.lock()->writeH5Data(dcaGidEig, tDims);
-    H5GroupAutoCloser groupCloser(dcaGidEig);
+    if(writeDataArray(dcaGidEig, m_CellEigenstrainsPtr.lock(), tDims) < 0)
+    {
+      return;
+    }
   }
 
   // DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getFeatureIdsArrayPath().getDataContainerName());
@@ -303,6 +434,33 @@ void FFTHDFWriterFilter::execute()
   //       dcaGid = -1;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t FFTHDFWriterFilter::writeDataArray(hid_t gid, const IDataArray::Pointer& dataArray, const std::vector<size_t>& tDims)
+{
+  int32_t err = -1;
+  if(!m_UseChunkedCompression)
+  {
+    err = dataArray->writeH5Data(gid, tDims);
+  }
+  else if(Int32ArrayType::Pointer int32Array = std::dynamic_pointer_cast<Int32ArrayType>(dataArray))
+  {
+    err = writeChunkedDataArray<int32_t>(gid, *int32Array, tDims, m_ChunkDimensions, m_CompressionLevel, m_UseShuffleFilter);
+  }
+  else if(FloatArrayType::Pointer floatArray = std::dynamic_pointer_cast<FloatArrayType>(dataArray))
+  {
+    err = writeChunkedDataArray<float>(gid, *floatArray, tDims, m_ChunkDimensions, m_CompressionLevel, m_UseShuffleFilter);
+  }
+
+  if(err < 0)
+  {
+    QString ss = QObject::tr("Error writing array '%1' to the HDF5 file").arg(dataArray->getName());
+    setErrorCondition(-11114, ss);
+  }
+  return err;
+}
+
 //--------------------------------------------------------------
 
 void FFTHDFWriterFilter::writeXdmfHeader(QTextStream& xdmf)
@@ -553,3 +711,51 @@ DataArrayPath FFTHDFWriterFilter::getCellEigenstrainsArrayPath() const
 {
   return m_CellEigenstrainsArrayPath;
 }
+
+// -----------------------------------------------------------------------------
+void FFTHDFWriterFilter::setUseChunkedCompression(bool value)
+{
+  m_UseChunkedCompression = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FFTHDFWriterFilter::getUseChunkedCompression() const
+{
+  return m_UseChunkedCompression;
+}
+
+// -----------------------------------------------------------------------------
+void FFTHDFWriterFilter::setChunkDimensions(const IntVec3Type& value)
+{
+  m_ChunkDimensions = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type FFTHDFWriterFilter::getChunkDimensions() const
+{
+  return m_ChunkDimensions;
+}
+
+// -----------------------------------------------------------------------------
+void FFTHDFWriterFilter::setCompressionLevel(int value)
+{
+  m_CompressionLevel = value;
+}
+
+// -----------------------------------------------------------------------------
+int FFTHDFWriterFilter::getCompressionLevel() const
+{
+  return m_CompressionLevel;
+}
+
+// -----------------------------------------------------------------------------
+void FFTHDFWriterFilter::setUseShuffleFilter(bool value)
+{
+  m_UseShuffleFilter = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FFTHDFWriterFilter::getUseShuffleFilter() const
+{
+  return m_UseShuffleFilter;
+}
@@ -11,6 +11,7 @@
 #include "H5Support/H5SupportTypeDefs.h"
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLArray.hpp"
 #include "SIMPLib/CoreFilters/FileWriter.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
@@ -37,6 +38,10 @@ class DREAM3DReview_EXPORT FFTHDFWriterFilter : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath CellPhasesArrayPath READ getCellPhasesArrayPath WRITE setCellPhasesArrayPath)
   PYB11_PROPERTY(DataArrayPath CellEulerAnglesArrayPath READ getCellEulerAnglesArrayPath WRITE setCellEulerAnglesArrayPath)
   PYB11_PROPERTY(DataArrayPath CellEigenstrainsArrayPath READ getCellEigenstrainsArrayPath WRITE setCellEigenstrainsArrayPath)
+  PYB11_PROPERTY(bool UseChunkedCompression READ getUseChunkedCompression WRITE setUseChunkedCompression)
+  PYB11_PROPERTY(IntVec3Type ChunkDimensions READ getChunkDimensions WRITE setChunkDimensions)
+  PYB11_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+  PYB11_PROPERTY(bool UseShuffleFilter READ getUseShuffleFilter WRITE setUseShuffleFilter)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -160,6 +165,50 @@ public:
   DataArrayPath getCellEigenstrainsArrayPath() const;
   Q_PROPERTY(DataArrayPath CellEigenstrainsArrayPath READ getCellEigenstrainsArrayPath WRITE setCellEigenstrainsArrayPath)
 
+  /**
+   * @brief Setter property for UseChunkedCompression
+   */
+  void setUseChunkedCompression(bool value);
+  /**
+   * @brief Getter property for UseChunkedCompression
+   * @return Value of UseChunkedCompression
+   */
+  bool getUseChunkedCompression() const;
+  Q_PROPERTY(bool UseChunkedCompression READ getUseChunkedCompression WRITE setUseChunkedCompression)
+
+  /**
+   * @brief Setter property for ChunkDimensions
+   */
+  void setChunkDimensions(const IntVec3Type& value);
+  /**
+   * @brief Getter property for ChunkDimensions
+   * @return Value of ChunkDimensions
+   */
+  IntVec3Type getChunkDimensions() const;
+  Q_PROPERTY(IntVec3Type ChunkDimensions READ getChunkDimensions WRITE setChunkDimensions)
+
+  /**
+   * @brief Setter property for CompressionLevel
+   */
+  void setCompressionLevel(int value);
+  /**
+   * @brief Getter property for CompressionLevel
+   * @return Value of CompressionLevel
+   */
+  int getCompressionLevel() const;
+  Q_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+
+  /**
+   * @brief Setter property for UseShuffleFilter
+   */
+  void setUseShuffleFilter(bool value);
+  /**
+   * @brief Getter property for UseShuffleFilter
+   * @return Value of UseShuffleFilter
+   */
+  bool getUseShuffleFilter() const;
+  Q_PROPERTY(bool UseShuffleFilter READ getUseShuffleFilter WRITE setUseShuffleFilter)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -235,6 +284,16 @@ protected:
    */
   void openFile(QString file, hid_t& fileId, bool append = false);
 
+  /**
+   * @brief writeDataArray Writes a cell array into the given group, either through the
+   * default contiguous DataArray writer or as a chunked, filtered dataset
+   * @param gid Parent HDF5 group
+   * @param dataArray Array to write
+   * @param tDims Tuple dimensions of the owning AttributeMatrix
+   * @return Negative value on error
+   */
+  int32_t writeDataArray(hid_t gid, const IDataArray::Pointer& dataArray, const std::vector<size_t>& tDims);
+
   /**
    * @brief writePipeline Writes the existing pipeline to the HDF5 file
    * @return
@@ -272,6 +331,10 @@ private:
   DataArrayPath m_CellPhasesArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::Phases};
   DataArrayPath m_CellEulerAnglesArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::EulerAngles};
   DataArrayPath m_CellEigenstrainsArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, "Eigenstrains"};
+  bool m_UseChunkedCompression = {false};
+  IntVec3Type m_ChunkDimensions = {64, 64, 64};
+  int m_CompressionLevel = {1};
+  bool m_UseShuffleFilter = {true};
 
   hid_t m_FileId = -1;
   hid_t m_FileIdEig = -2;
@@ -37,7 +37,7 @@
 #include <cmath>
 #include <cstring>
 #include <functional>
-#include <unordered_map>
+#include <optional>
 
 #include <QtCore/QTextStream>
 
@@ -53,6 +53,7 @@
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
@@ -60,9 +61,16 @@
 #define STATISTICS_FILTER_CLASS_NAME FindArrayStatistics
 #include "util/StatisticsHelpers.hpp"
 
+namespace
+{
+// Number of bins used by the approximate median/percentile sketch
+constexpr size_t k_QuantileSketchBins = 65536;
+} // namespace
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
 #include <tbb/partitioner.h>
 #endif
 
@@ -115,6 +123,12 @@ void FindArrayStatistics::setupFilterParameters()
   linkedProps.push_back("SummationArrayName");
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Find Summation", FindSummation, FilterParameter::Category::Parameter, FindArrayStatistics, linkedProps));
   linkedProps.clear();
+  linkedProps.push_back("Percentiles");
+  linkedProps.push_back("PercentilesArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Find Percentiles", FindPercentiles, FilterParameter::Category::Parameter, FindArrayStatistics, linkedProps));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Percentiles (Comma Delimited)", Percentiles, FilterParameter::Category::Parameter, FindArrayStatistics));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Approximate Median/Percentiles", UseApproximateQuantiles, FilterParameter::Category::Parameter, FindArrayStatistics));
+  linkedProps.clear();
 
   parameters.push_back(SeparatorFilterParameter::Create("Algorithm Options", FilterParameter::Category::Parameter));
   linkedProps.push_back("MaskArrayPath");
@@ -150,6 +164,8 @@ void FindArrayStatistics::setupFilterParameters()
                                                       FindArrayStatistics));
   parameters.push_back(
       SIMPL_NEW_DA_WITH_LINKED_AM_FP("Summation", SummationArrayName, DestinationAttributeMatrix, DestinationAttributeMatrix, FilterParameter::Category::CreatedArray, FindArrayStatistics));
+  parameters.push_back(
+      SIMPL_NEW_DA_WITH_LINKED_AM_FP("Percentiles", PercentilesArrayName, DestinationAttributeMatrix, DestinationAttributeMatrix, FilterParameter::Category::CreatedArray, FindArrayStatistics));
   parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Standardized Data", StandardizedArrayName, SelectedArrayPath, SelectedArrayPath, FilterParameter::Category::CreatedArray, FindArrayStatistics));
 
   setFilterParameters(parameters);
@@ -170,7 +186,7 @@ void FindArrayStatistics::dataCheck()
   clearErrorCode();
   clearWarningCode();
 
-  if(!getFindHistogram() && !getFindMin() && !getFindMax() && !getFindMean() && !getFindMedian() && !getFindStdDeviation() && !getFindSummation() && !getFindLength())
+  if(!getFindHistogram() && !getFindMin() && !getFindMax() && !getFindMean() && !getFindMedian() && !getFindStdDeviation() && !getFindSummation() && !getFindLength() && !getFindPercentiles())
   {
     QString ss = QObject::tr("No statistics have been selected, so this filter will perform no operations");
     setWarningCondition(-701, ss);
@@ -255,6 +271,38 @@ void FindArrayStatistics::dataCheck()
     }
   }
 
+  m_PercentileValues.clear();
+  if(m_FindPercentiles)
+  {
+    QStringList tokens = getPercentiles().split(',', QString::SkipEmptyParts);
+    for(const QString& token : tokens)
+    {
+      bool ok = false;
+      float percentile = token.trimmed().toFloat(&ok);
+      if(!ok || percentile < 0.0f || percentile > 100.0f)
+      {
+        QString ss = QObject::tr("Percentile '%1' is not a number between 0 and 100").arg(token.trimmed());
+        setErrorCondition(-11004, ss);
+        return;
+      }
+      m_PercentileValues.push_back(percentile);
+    }
+    if(m_PercentileValues.empty())
+    {
+      QString ss = QObject::tr("At least one percentile must be given when \"Find Percentiles\" is checked");
+      setErrorCondition(-11005, ss);
+      return;
+    }
+
+    std::vector<size_t> cDims_List = {m_PercentileValues.size()};
+    DataArrayPath path(getDestinationAttributeMatrix().getDataContainerName(), getDestinationAttributeMatrix().getAttributeMatrixName(), getPercentilesArrayName());
+    m_PercentilesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<FloatArrayType>(this, path, 0, cDims_List, "", DataArrayID38);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+  }
+
   if(getUseMask())
   {
     m_MaskPtr = getDataContainerArray()->getPrereqArrayFromPath<BoolArrayType>(this, getMaskArrayPath(), cDims);
@@ -290,10 +338,10 @@ void FindArrayStatistics::dataCheck()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-std::vector<float> findHistogram(C<T, Ts...>& source, float histmin, float histmax, bool histfullrange, int32_t numBins)
+template <typename Iterator>
+std::vector<float> findHistogram(Iterator first, Iterator last, float histmin, float histmax, bool histfullrange, int32_t numBins)
 {
-  if(source.empty())
+  if(first == last)
   {
     return std::vector<float>(numBins, 0);
   }
@@ -303,8 +351,9 @@ std::vector<float> findHistogram(C<T, Ts...>& source, float histmin, float histm
 
   if(histfullrange)
   {
-    min = static_cast<float>(StatisticsHelpers::findMin(source));
-    max = static_cast<float>(StatisticsHelpers::findMax(source));
+    auto minMax = std::minmax_element(first, last);
+    min = static_cast<float>(*minMax.first);
+    max = static_cast<float>(*minMax.second);
   }
   else
   {
@@ -322,13 +371,13 @@ std::vector<float> findHistogram(C<T, Ts...>& source, float histmin, float histm
 
   if(numBins == 1) // if one bin, just set the first element to total number of points
   {
-    Histogram[0] = static_cast<float>(source.size());
+    Histogram[0] = static_cast<float>(std::distance(first, last));
   }
   else
   {
-    for(const auto s : source)
+    for(; first != last; ++first)
     {
-      float value = static_cast<float>(s);
+      float value = static_cast<float>(*first);
       size_t bin = static_cast<size_t>((value - min) / increment); // find bin for this input array value
       if((bin >= 0) && (bin < numBins))                            // make certain bin is in range
       {
@@ -344,6 +393,39 @@ std::vector<float> findHistogram(C<T, Ts...>& source, float histmin, float histm
   return Histogram;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+float findMeanValue(const StatisticsHelpers::RangeStatistics<T>& stats)
+{
+  if constexpr(std::is_same_v<T, bool>)
+  {
+    // The "mean" of a boolean range is its majority value
+    return stats.sum >= (stats.count - stats.sum) ? 1.0f : 0.0f;
+  }
+  else
+  {
+    return static_cast<float>(stats.mean);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+float findStdDeviationValue(const StatisticsHelpers::RangeStatistics<T>& stats)
+{
+  if constexpr(std::is_same_v<T, bool>)
+  {
+    return findMeanValue(stats);
+  }
+  else
+  {
+    return static_cast<float>(stats.stdDeviation());
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -436,9 +518,9 @@ template <typename T>
 class FindArrayStatisticsByIndexImpl
 {
 public:
-  FindArrayStatisticsByIndexImpl(std::unordered_map<int32_t, std::list<T>>& featureDataMap, bool length, bool min, bool max, bool mean, bool median, bool stdDeviation, bool summation,
-                                 std::vector<IDataArray::Pointer>& arrays, bool hist, float histmin, float histmax, bool histfullrange, int32_t numBins)
-  : m_FeatureDataMap(featureDataMap)
+  FindArrayStatisticsByIndexImpl(StatisticsHelpers::FeatureBuckets<T>& buckets, bool length, bool min, bool max, bool mean, bool median, bool stdDeviation, bool summation,
+                                 std::vector<IDataArray::Pointer>& arrays, bool hist, float histmin, float histmax, bool histfullrange, int32_t numBins, const std::vector<float>& percentiles)
+  : m_Buckets(buckets)
   , m_Length(length)
   , m_Min(min)
   , m_Max(max)
@@ -452,6 +534,7 @@ public:
   , m_HistFullRange(histfullrange)
   , m_NumBins(numBins)
   , m_Arrays(arrays)
+  , m_Percentiles(percentiles)
   {
   }
 
@@ -459,17 +542,24 @@ public:
 
   void compute(size_t start, size_t end) const
   {
+    std::vector<float> percentileValues(m_Percentiles.size(), 0.0f);
     for(size_t i = start; i < end; i++)
     {
-      if(m_FeatureDataMap.find(i) == m_FeatureDataMap.end())
+      if(m_Buckets.size(i) == 0)
       {
         continue;
       }
+      // Each feature's bucket is only ever touched by one thread, so the selection based
+      // statistics below may reorder it in place
+      auto first = m_Buckets.begin(i);
+      auto last = m_Buckets.end(i);
+      StatisticsHelpers::RangeStatistics<T> stats = StatisticsHelpers::computeRangeStatistics<T>(first, last);
+
       if(m_Length)
       {
         if(m_Arrays[0])
         {
-          int64_t val = static_cast<int64_t>(m_FeatureDataMap[i].size());
+          int64_t val = static_cast<int64_t>(stats.count);
           m_Arrays[0]->initializeTuple(i, &val);
         }
       }
@@ -477,7 +567,7 @@ public:
       {
         if(m_Arrays[1])
         {
-          T val = StatisticsHelpers::findMin(m_FeatureDataMap[i]);
+          T val = stats.min;
           m_Arrays[1]->initializeTuple(i, &val);
         }
       }
@@ -485,7 +575,7 @@ public:
       {
         if(m_Arrays[2])
         {
-          T val = StatisticsHelpers::findMax(m_FeatureDataMap[i]);
+          T val = stats.max;
           m_Arrays[2]->initializeTuple(i, &val);
         }
       }
@@ -493,7 +583,7 @@ public:
       {
         if(m_Arrays[3])
         {
-          float val = StatisticsHelpers::findMean(m_FeatureDataMap[i]);
+          float val = findMeanValue(stats);
           m_Arrays[3]->initializeTuple(i, &val);
         }
       }
@@ -501,7 +591,7 @@ public:
       {
         if(m_Arrays[4])
         {
-          float val = StatisticsHelpers::findMedian(m_FeatureDataMap[i]);
+          float val = StatisticsHelpers::findPercentileInPlace(first, last, 50.0f);
           m_Arrays[4]->initializeTuple(i, &val);
         }
       }
@@ -509,7 +599,7 @@ public:
       {
         if(m_Arrays[5])
         {
-          float val = StatisticsHelpers::findStdDeviation(m_FeatureDataMap[i]);
+          float val = findStdDeviationValue(stats);
           m_Arrays[5]->initializeTuple(i, &val);
         }
       }
@@ -517,7 +607,7 @@ public:
       {
         if(m_Arrays[6])
         {
-          float val = StatisticsHelpers::findSummation(m_FeatureDataMap[i]);
+          float val = static_cast<float>(stats.sum);
           m_Arrays[6]->initializeTuple(i, &val);
         }
       }
@@ -526,11 +616,21 @@ public:
       {
         if(m_Arrays[7])
         {
-          std::vector<float> vals = findHistogram(m_FeatureDataMap[i], m_HistMin, m_HistMax, m_HistFullRange, m_NumBins);
+          std::vector<float> vals = findHistogram(first, last, m_HistMin, m_HistMax, m_HistFullRange, m_NumBins);
           std::shared_ptr<FloatArrayType> histArray = std::dynamic_pointer_cast<FloatArrayType>(m_Arrays[7]);
           histArray->setTuple(i, vals);
         }
       }
+
+      if(m_Arrays[8])
+      {
+        for(size_t p = 0; p < m_Percentiles.size(); p++)
+        {
+          percentileValues[p] = StatisticsHelpers::findPercentileInPlace(first, last, m_Percentiles[p]);
+        }
+        std::shared_ptr<FloatArrayType> percentileArray = std::dynamic_pointer_cast<FloatArrayType>(m_Arrays[8]);
+        percentileArray->setTuple(i, percentileValues);
+      }
     }
   }
 
@@ -542,7 +642,7 @@ public:
 #endif
 
 private:
-  std::unordered_map<int32_t, std::list<T>>& m_FeatureDataMap;
+  StatisticsHelpers::FeatureBuckets<T>& m_Buckets;
   bool m_Length;
   bool m_Min;
   bool m_Max;
@@ -556,20 +656,182 @@ private:
   bool m_HistFullRange;
   int32_t m_NumBins;
   std::vector<IDataArray::Pointer>& m_Arrays;
+  const std::vector<float>& m_Percentiles;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+class FindArrayStatisticsReduceImpl
+{
+public:
+  FindArrayStatisticsReduceImpl(const T* data, const bool* mask, bool statistics, bool histogram, float histmin, float histmax, int32_t numBins, bool sketch, T sketchMin, T sketchMax)
+  : m_Data(data)
+  , m_Mask(mask)
+  , m_ComputeStatistics(statistics)
+  , m_ComputeHistogram(histogram)
+  , m_HistMin(histmin)
+  , m_HistMax(histmax)
+  , m_NumBins(numBins)
+  , m_ComputeSketch(sketch)
+  , m_SketchMin(sketchMin)
+  , m_SketchMax(sketchMax)
+  {
+    initializeAccumulators();
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  FindArrayStatisticsReduceImpl(const FindArrayStatisticsReduceImpl& other, tbb::split)
+  : m_Data(other.m_Data)
+  , m_Mask(other.m_Mask)
+  , m_ComputeStatistics(other.m_ComputeStatistics)
+  , m_ComputeHistogram(other.m_ComputeHistogram)
+  , m_HistMin(other.m_HistMin)
+  , m_HistMax(other.m_HistMax)
+  , m_NumBins(other.m_NumBins)
+  , m_ComputeSketch(other.m_ComputeSketch)
+  , m_SketchMin(other.m_SketchMin)
+  , m_SketchMax(other.m_SketchMax)
+  {
+    initializeAccumulators();
+  }
+#endif
+
+  virtual ~FindArrayStatisticsReduceImpl() = default;
+
+  void compute(size_t start, size_t end)
+  {
+    const float increment = (m_HistMax - m_HistMin) / static_cast<float>(m_NumBins);
+    const bool singleBin = std::abs(increment) < 1E-10;
+    for(size_t i = start; i < end; i++)
+    {
+      if(nullptr != m_Mask && !m_Mask[i])
+      {
+        continue;
+      }
+      const T value = m_Data[i];
+      if(m_ComputeStatistics)
+      {
+        m_Statistics.add(value);
+      }
+      if(m_ComputeHistogram)
+      {
+        if(singleBin) // if one bin, the first element is the total number of points
+        {
+          m_HistogramCounts[0]++;
+        }
+        else
+        {
+          float fvalue = static_cast<float>(value);
+          float bin = (fvalue - m_HistMin) / increment;     // find bin for this input array value
+          if(bin > -1.0f && bin < static_cast<float>(m_NumBins)) // make certain bin is in range
+          {
+            m_HistogramCounts[static_cast<size_t>(bin)]++;
+          }
+          else if(fvalue == m_HistMax)
+          {
+            m_HistogramCounts[m_NumBins - 1]++;
+          }
+        }
+      }
+      if(m_ComputeSketch)
+      {
+        m_Sketch->add(value);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r)
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+  void join(const FindArrayStatisticsReduceImpl& other)
+  {
+    m_Statistics.merge(other.m_Statistics);
+    std::transform(m_HistogramCounts.begin(), m_HistogramCounts.end(), other.m_HistogramCounts.begin(), m_HistogramCounts.begin(), std::plus<uint64_t>());
+    if(m_ComputeSketch)
+    {
+      m_Sketch->merge(*other.m_Sketch);
+    }
+  }
+
+  const StatisticsHelpers::RangeStatistics<T>& getStatistics() const
+  {
+    return m_Statistics;
+  }
+
+  std::vector<float> getHistogram() const
+  {
+    return std::vector<float>(m_HistogramCounts.begin(), m_HistogramCounts.end());
+  }
+
+  const StatisticsHelpers::HistogramQuantileSketch<T>& getSketch() const
+  {
+    return *m_Sketch;
+  }
+
+private:
+  const T* m_Data = nullptr;
+  const bool* m_Mask = nullptr;
+  bool m_ComputeStatistics;
+  bool m_ComputeHistogram;
+  float m_HistMin;
+  float m_HistMax;
+  int32_t m_NumBins;
+  bool m_ComputeSketch;
+  T m_SketchMin;
+  T m_SketchMax;
+
+  StatisticsHelpers::RangeStatistics<T> m_Statistics;
+  std::vector<uint64_t> m_HistogramCounts;
+  std::optional<StatisticsHelpers::HistogramQuantileSketch<T>> m_Sketch;
+
+  void initializeAccumulators()
+  {
+    m_HistogramCounts.assign(m_ComputeHistogram ? static_cast<size_t>(m_NumBins) : 0, 0);
+    if(m_ComputeSketch)
+    {
+      m_Sketch.emplace(m_SketchMin, m_SketchMax, k_QuantileSketchBins);
+    }
+  }
 };
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void findStatisticsImpl(bool length, bool min, bool max, bool mean, bool median, bool stdDeviation, bool summation, std::vector<IDataArray::Pointer>& arrays, std::vector<T>& data, bool hist,
-                        float histmin, float histmax, bool histfullrange, int32_t numBins)
+void runReduction(FindArrayStatisticsReduceImpl<T>& reduction, size_t numTuples)
 {
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_reduce(tbb::blocked_range<size_t>(0, numTuples), reduction, tbb::auto_partitioner());
+#else
+  reduction.compute(0, numTuples);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+void findStatisticsImpl(const T* data, const bool* mask, size_t numTuples, bool length, bool min, bool max, bool mean, bool median, bool stdDeviation, bool summation,
+                        std::vector<IDataArray::Pointer>& arrays, bool hist, float histmin, float histmax, bool histfullrange, int32_t numBins, const std::vector<float>& percentiles,
+                        bool approximateQuantiles)
+{
+  // Fused pass over the source: count, min, max, sum and variance, plus the histogram when its range is fixed
+  const bool histogram = hist && arrays[7];
+  FindArrayStatisticsReduceImpl<T> reduction(data, mask, true, histogram && !histfullrange, histmin, histmax, numBins, false, T(), T());
+  runReduction(reduction, numTuples);
+  const StatisticsHelpers::RangeStatistics<T>& stats = reduction.getStatistics();
+
   if(length)
   {
     if(arrays[0])
     {
-      int64_t val = static_cast<int64_t>(data.size());
+      int64_t val = static_cast<int64_t>(stats.count);
       arrays[0]->initializeTuple(0, &val);
     }
   }
@@ -577,7 +839,7 @@ void findStatisticsImpl(bool length, bool min, bool max, bool mean, bool median,
   {
     if(arrays[1])
     {
-      T val = StatisticsHelpers::findMin(data);
+      T val = stats.min;
       arrays[1]->initializeTuple(0, &val);
     }
   }
@@ -585,7 +847,7 @@ void findStatisticsImpl(bool length, bool min, bool max, bool mean, bool median,
   {
     if(arrays[2])
     {
-      T val = StatisticsHelpers::findMax(data);
+      T val = stats.max;
       arrays[2]->initializeTuple(0, &val);
     }
   }
@@ -593,23 +855,15 @@ void findStatisticsImpl(bool length, bool min, bool max, bool mean, bool median,
   {
     if(arrays[3])
     {
-      float val = StatisticsHelpers::findMean(data);
+      float val = findMeanValue(stats);
       arrays[3]->initializeTuple(0, &val);
     }
   }
-  if(median)
-  {
-    if(arrays[4])
-    {
-      float val = StatisticsHelpers::findMedian(data);
-      arrays[4]->initializeTuple(0, &val);
-    }
-  }
   if(stdDeviation)
   {
     if(arrays[5])
     {
-      float val = StatisticsHelpers::findStdDeviation(data);
+      float val = findStdDeviationValue(stats);
       arrays[5]->initializeTuple(0, &val);
     }
   }
@@ -617,19 +871,74 @@ void findStatisticsImpl(bool length, bool min, bool max, bool mean, bool median,
   {
     if(arrays[6])
     {
-      float val = StatisticsHelpers::findSummation(data);
+      float val = static_cast<float>(stats.sum);
       arrays[6]->initializeTuple(0, &val);
     }
   }
 
-  if(hist)
+  if(histogram)
   {
-    if(arrays[7])
+    std::vector<float> vals;
+    if(histfullrange)
     {
-      std::vector<float> vals = findHistogram(data, histmin, histmax, histfullrange, numBins);
-      std::shared_ptr<FloatArrayType> histArray = std::dynamic_pointer_cast<FloatArrayType>(arrays[7]);
-      histArray->setTuple(0, vals);
+      // The full range is only known after the first pass
+      FindArrayStatisticsReduceImpl<T> histogramPass(data, mask, false, true, static_cast<float>(stats.min), static_cast<float>(stats.max), numBins, false, T(), T());
+      runReduction(histogramPass, numTuples);
+      vals = histogramPass.getHistogram();
     }
+    else
+    {
+      vals = reduction.getHistogram();
+    }
+    std::shared_ptr<FloatArrayType> histArray = std::dynamic_pointer_cast<FloatArrayType>(arrays[7]);
+    histArray->setTuple(0, vals);
+  }
+
+  const bool findMedian = median && arrays[4];
+  if((!findMedian && !arrays[8]) || stats.count == 0)
+  {
+    return;
+  }
+
+  std::function<float(float)> quantile;
+  StatisticsHelpers::HistogramQuantileSketch<T> sketch(stats.min, stats.max, 1);
+  using StorageType = typename StatisticsHelpers::FeatureBuckets<T>::StorageType;
+  std::vector<StorageType> values;
+  if(approximateQuantiles)
+  {
+    // Estimate the quantiles from a binned sketch instead of copying the source
+    FindArrayStatisticsReduceImpl<T> sketchPass(data, mask, false, false, 0.0f, 0.0f, 1, true, stats.min, stats.max);
+    runReduction(sketchPass, numTuples);
+    sketch = sketchPass.getSketch();
+    quantile = [&sketch](float percentile) { return sketch.quantile(percentile); };
+  }
+  else
+  {
+    values.reserve(stats.count);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      if(nullptr == mask || mask[i])
+      {
+        values.push_back(static_cast<StorageType>(data[i]));
+      }
+    }
+    quantile = [&values](float percentile) { return StatisticsHelpers::findPercentileInPlace(values.begin(), values.end(), percentile); };
+  }
+
+  if(findMedian)
+  {
+    float val = quantile(50.0f);
+    arrays[4]->initializeTuple(0, &val);
+  }
+  if(arrays[8])
+  {
+    std::vector<float> vals(percentiles.size(), 0.0f);
+    for(size_t p = 0; p < percentiles.size(); p++)
+    {
+      vals[p] = quantile(percentiles[p]);
+    }
+    std::shared_ptr<FloatArrayType> percentileArray = std::dynamic_pointer_cast<FloatArrayType>(arrays[8]);
+    percentileArray->setTuple(0, vals);
   }
 }
 
@@ -638,7 +947,8 @@ void findStatisticsImpl(bool length, bool min, bool max, bool mean, bool median,
 // -----------------------------------------------------------------------------
 template <typename T>
 void findStatistics(IDataArray::Pointer source, Int32ArrayType::Pointer featureIds, bool useMask, bool* mask, bool length, bool min, bool max, bool mean, bool median, bool stdDeviation,
-                    bool summation, std::vector<IDataArray::Pointer>& arrays, int32_t numFeatures, bool computeByIndex, bool hist, float histmin, float histmax, bool histfullrange, int32_t numBins)
+                    bool summation, std::vector<IDataArray::Pointer>& arrays, int32_t numFeatures, bool computeByIndex, bool hist, float histmin, float histmax, bool histfullrange, int32_t numBins,
+                    const std::vector<float>& percentiles, bool approximateQuantiles)
 {
   size_t numTuples = source->getNumberOfTuples();
   typename DataArray<T>::Pointer sourcePtr = std::dynamic_pointer_cast<DataArray<T>>(source);
@@ -646,23 +956,8 @@ void findStatistics(IDataArray::Pointer source, Int32ArrayType::Pointer featureI
 
   if(computeByIndex)
   {
-    int32_t* featureIdsPtr = featureIds->getPointer(0);
-    std::unordered_map<int32_t, std::list<T>> featureValueMap;
-
-    for(size_t i = 0; i < numTuples; i++)
-    {
-      if(useMask)
-      {
-        if(mask[i])
-        {
-          featureValueMap[featureIdsPtr[i]].push_back(dataPtr[i]);
-        }
-      }
-      else
-      {
-        featureValueMap[featureIdsPtr[i]].push_back(dataPtr[i]);
-      }
-    }
+    // Group the values by feature into one flat buffer instead of a heap node per value
+    StatisticsHelpers::FeatureBuckets<T> featureBuckets(dataPtr, featureIds->getPointer(0), useMask ? mask : nullptr, numTuples, static_cast<size_t>(numFeatures));
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
     bool doParallel = true;
@@ -672,38 +967,20 @@ void findStatistics(IDataArray::Pointer source, Int32ArrayType::Pointer featureI
     if(doParallel)
     {
       tbb::parallel_for(tbb::blocked_range<size_t>(0, numFeatures),
-                        FindArrayStatisticsByIndexImpl<T>(featureValueMap, length, min, max, mean, median, stdDeviation, summation, arrays, hist, histmin, histmax, histfullrange, numBins),
+                        FindArrayStatisticsByIndexImpl<T>(featureBuckets, length, min, max, mean, median, stdDeviation, summation, arrays, hist, histmin, histmax, histfullrange, numBins, percentiles),
                         tbb::auto_partitioner());
     }
     else
 #endif
     {
-      FindArrayStatisticsByIndexImpl<T> serial(featureValueMap, length, min, max, mean, median, stdDeviation, summation, arrays, hist, histmin, histmax, histfullrange, numBins);
+      FindArrayStatisticsByIndexImpl<T> serial(featureBuckets, length, min, max, mean, median, stdDeviation, summation, arrays, hist, histmin, histmax, histfullrange, numBins, percentiles);
       serial.compute(0, numFeatures);
     }
   }
   else
   {
-    std::vector<T> data;
-    data.reserve(numTuples);
-    for(size_t i = 0; i < numTuples; i++)
-    {
-      if(useMask)
-      {
-        if(mask[i])
-        {
-          data.push_back(dataPtr[i]);
-        }
-      }
-      else
-      {
-        data.push_back(dataPtr[i]);
-      }
-    }
-
-    data.shrink_to_fit();
-
-    findStatisticsImpl(length, min, max, mean, median, stdDeviation, summation, arrays, data, hist, histmin, histmax, histfullrange, numBins);
+    findStatisticsImpl(dataPtr, useMask ? mask : nullptr, numTuples, length, min, max, mean, median, stdDeviation, summation, arrays, hist, histmin, histmax, histfullrange, numBins, percentiles,
+                       approximateQuantiles);
   }
 }
 
@@ -718,7 +995,7 @@ void FindArrayStatistics::execute()
     return;
   }
 
-  if(!m_FindHistogram && !m_FindMin && !m_FindMax && !m_FindMean && !m_FindMedian && !m_FindStdDeviation && !m_FindSummation && !m_FindLength)
+  if(!m_FindHistogram && !m_FindMin && !m_FindMax && !m_FindMean && !m_FindMedian && !m_FindStdDeviation && !m_FindSummation && !m_FindLength && !m_FindPercentiles)
   {
     return;
   }
@@ -759,7 +1036,7 @@ void FindArrayStatistics::execute()
     }
   }
 
-  std::vector<IDataArray::Pointer> arrays(8, nullptr);
+  std::vector<IDataArray::Pointer> arrays(9, nullptr);
 
   for(size_t i = 0; i < arrays.size(); i++)
   {
@@ -803,10 +1080,16 @@ void FindArrayStatistics::execute()
       arrays[7] = m_HistogramListPtr.lock();
       arrays[7]->initializeWithZeros();
     }
+    if(m_FindPercentiles)
+    {
+      arrays[8] = m_PercentilesPtr.lock();
+      arrays[8]->initializeWithZeros();
+    }
   }
 
   EXECUTE_FUNCTION_TEMPLATE(this, findStatistics, m_InputArrayPtr.lock(), m_InputArrayPtr.lock(), m_FeatureIdsPtr.lock(), m_UseMask, m_Mask, m_FindLength, m_FindMin, m_FindMax, m_FindMean,
-                            m_FindMedian, m_FindStdDeviation, m_FindSummation, arrays, numFeatures, m_ComputeByIndex, m_FindHistogram, m_MinRange, m_MaxRange, m_UseFullRange, m_NumBins)
+                            m_FindMedian, m_FindStdDeviation, m_FindSummation, arrays, numFeatures, m_ComputeByIndex, m_FindHistogram, m_MinRange, m_MaxRange, m_UseFullRange, m_NumBins,
+                            m_PercentileValues, m_UseApproximateQuantiles)
 
   if(m_StandardizeData)
   {
@@ -1063,6 +1346,42 @@ bool FindArrayStatistics::getFindSummation() const
   return m_FindSummation;
 }
 
+// -----------------------------------------------------------------------------
+void FindArrayStatistics::setFindPercentiles(bool value)
+{
+  m_FindPercentiles = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindArrayStatistics::getFindPercentiles() const
+{
+  return m_FindPercentiles;
+}
+
+// -----------------------------------------------------------------------------
+void FindArrayStatistics::setPercentiles(const QString& value)
+{
+  m_Percentiles = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindArrayStatistics::getPercentiles() const
+{
+  return m_Percentiles;
+}
+
+// -----------------------------------------------------------------------------
+void FindArrayStatistics::setUseApproximateQuantiles(bool value)
+{
+  m_UseApproximateQuantiles = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindArrayStatistics::getUseApproximateQuantiles() const
+{
+  return m_UseApproximateQuantiles;
+}
+
 // -----------------------------------------------------------------------------
 void FindArrayStatistics::setUseMask(bool value)
 {
@@ -1219,6 +1538,18 @@ QString FindArrayStatistics::getSummationArrayName() const
   return m_SummationArrayName;
 }
 
+// -----------------------------------------------------------------------------
+void FindArrayStatistics::setPercentilesArrayName(const QString& value)
+{
+  m_PercentilesArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindArrayStatistics::getPercentilesArrayName() const
+{
+  return m_PercentilesArrayName;
+}
+
 // -----------------------------------------------------------------------------
 void FindArrayStatistics::setStandardizedArrayName(const QString& value)
 {
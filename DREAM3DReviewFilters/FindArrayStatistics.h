@@ -36,6 +36,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -68,6 +69,9 @@ class DREAM3DReview_EXPORT FindArrayStatistics : public AbstractFilter
   PYB11_PROPERTY(bool FindMedian READ getFindMedian WRITE setFindMedian)
   PYB11_PROPERTY(bool FindStdDeviation READ getFindStdDeviation WRITE setFindStdDeviation)
   PYB11_PROPERTY(bool FindSummation READ getFindSummation WRITE setFindSummation)
+  PYB11_PROPERTY(bool FindPercentiles READ getFindPercentiles WRITE setFindPercentiles)
+  PYB11_PROPERTY(QString Percentiles READ getPercentiles WRITE setPercentiles)
+  PYB11_PROPERTY(bool UseApproximateQuantiles READ getUseApproximateQuantiles WRITE setUseApproximateQuantiles)
   PYB11_PROPERTY(bool UseMask READ getUseMask WRITE setUseMask)
   PYB11_PROPERTY(bool StandardizeData READ getStandardizeData WRITE setStandardizeData)
   PYB11_PROPERTY(bool ComputeByIndex READ getComputeByIndex WRITE setComputeByIndex)
@@ -80,6 +84,7 @@ class DREAM3DReview_EXPORT FindArrayStatistics : public AbstractFilter
   PYB11_PROPERTY(QString MedianArrayName READ getMedianArrayName WRITE setMedianArrayName)
   PYB11_PROPERTY(QString StdDeviationArrayName READ getStdDeviationArrayName WRITE setStdDeviationArrayName)
   PYB11_PROPERTY(QString SummationArrayName READ getSummationArrayName WRITE setSummationArrayName)
+  PYB11_PROPERTY(QString PercentilesArrayName READ getPercentilesArrayName WRITE setPercentilesArrayName)
   PYB11_PROPERTY(QString StandardizedArrayName READ getStandardizedArrayName WRITE setStandardizedArrayName)
   PYB11_PROPERTY(DataArrayPath SelectedArrayPath READ getSelectedArrayPath WRITE setSelectedArrayPath)
   PYB11_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
@@ -242,6 +247,39 @@ public:
   bool getFindSummation() const;
   Q_PROPERTY(bool FindSummation READ getFindSummation WRITE setFindSummation)
 
+  /**
+   * @brief Setter property for FindPercentiles
+   */
+  void setFindPercentiles(bool value);
+  /**
+   * @brief Getter property for FindPercentiles
+   * @return Value of FindPercentiles
+   */
+  bool getFindPercentiles() const;
+  Q_PROPERTY(bool FindPercentiles READ getFindPercentiles WRITE setFindPercentiles)
+
+  /**
+   * @brief Setter property for Percentiles
+   */
+  void setPercentiles(const QString& value);
+  /**
+   * @brief Getter property for Percentiles
+   * @return Value of Percentiles
+   */
+  QString getPercentiles() const;
+  Q_PROPERTY(QString Percentiles READ getPercentiles WRITE setPercentiles)
+
+  /**
+   * @brief Setter property for UseApproximateQuantiles
+   */
+  void setUseApproximateQuantiles(bool value);
+  /**
+   * @brief Getter property for UseApproximateQuantiles
+   * @return Value of UseApproximateQuantiles
+   */
+  bool getUseApproximateQuantiles() const;
+  Q_PROPERTY(bool UseApproximateQuantiles READ getUseApproximateQuantiles WRITE setUseApproximateQuantiles)
+
   /**
    * @brief Setter property for UseMask
    */
@@ -385,6 +423,17 @@ public:
   QString getSummationArrayName() const;
   Q_PROPERTY(QString SummationArrayName READ getSummationArrayName WRITE setSummationArrayName)
 
+  /**
+   * @brief Setter property for PercentilesArrayName
+   */
+  void setPercentilesArrayName(const QString& value);
+  /**
+   * @brief Getter property for PercentilesArrayName
+   * @return Value of PercentilesArrayName
+   */
+  QString getPercentilesArrayName() const;
+  Q_PROPERTY(QString PercentilesArrayName READ getPercentilesArrayName WRITE setPercentilesArrayName)
+
   /**
    * @brief Setter property for StandardizedArrayName
    */
@@ -505,6 +554,8 @@ private:
   std::weak_ptr<BoolArrayType> m_MaskPtr;
   bool* m_Mask = nullptr;
   std::weak_ptr<FloatArrayType> m_HistogramListPtr;
+  std::weak_ptr<FloatArrayType> m_PercentilesPtr;
+  std::vector<float> m_PercentileValues;
 
   // Histogram Related Parameters
   double m_MinRange = {};
@@ -520,6 +571,8 @@ private:
   bool m_FindMedian = false;
   bool m_FindStdDeviation = false;
   bool m_FindSummation = false;
+  bool m_FindPercentiles = false;
+  bool m_UseApproximateQuantiles = false;
   bool m_UseMask = false;
   bool m_StandardizeData = false;
   bool m_ComputeByIndex = false;
@@ -535,6 +588,8 @@ private:
   QString m_MedianArrayName = {"Median"};
   QString m_StdDeviationArrayName = {"StandardDeviation"};
   QString m_SummationArrayName = {"Summation"};
+  QString m_Percentiles = {"25, 75"};
+  QString m_PercentilesArrayName = {"Percentiles"};
   QString m_StandardizedArrayName = {"Standardized"};
 
   DataArrayPath m_SelectedArrayPath = {};
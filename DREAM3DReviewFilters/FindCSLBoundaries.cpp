@@ -37,170 +37,377 @@
 
 #include "FindCSLBoundaries.h"
 
+#include <algorithm>
+#include <array>
+#include <utility>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/SIMPLRange.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-#include <tbb/blocked_range.h>
-#include <tbb/parallel_for.h>
-#include <tbb/partitioner.h>
-#endif
-
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
 {
   DataArrayID30 = 30,
   DataArrayID31 = 31,
   DataArrayID32 = 32,
+  DataArrayID33 = 33,
 };
 
-class CalculateCSLBoundaryImpl
+namespace
 {
-  int m_CSLIndex;
-  float m_AxisTol;
-  float m_AngTol;
-  int32_t* m_Labels = nullptr;
-  double* m_Normals = nullptr;
-  int32_t* m_Phases = nullptr;
-  float* m_Quats = nullptr;
-  bool* m_CSLBoundary = nullptr;
-  float* m_CSLBoundaryIncoherence = nullptr;
-  unsigned int* m_CrystalStructures = nullptr;
-  LaueOpsContainer m_OrientationOps;
+constexpr int32_t k_CSLListParseError = -5560;
+constexpr int32_t k_UnknownCSLError = -5561;
+constexpr size_t k_NumCSLs = 21;
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief FindCSLIndex Returns the row of TransformationPhaseConstants::CSLAxisAngle whose sigma matches the
+ * integer part of csl, or -1 if there is none
+ */
+int32_t FindCSLIndex(float csl)
+{
+  for(size_t i = 0; i < k_NumCSLs; ++i)
+  {
+    if(static_cast<int>(TransformationPhaseConstants::CSLAxisAngle[i][0]) == static_cast<int>(csl))
+    {
+      return static_cast<int32_t>(i);
+    }
+  }
+  return -1;
+}
 
+/**
+ * @brief The FeaturePairTable class is a flat open addressing hash table assigning a dense index to each
+ * ordered (feature1, feature2) pair; feature IDs must be positive
+ */
+class FeaturePairTable
+{
 public:
-  CalculateCSLBoundaryImpl(int cslindex, float angtol, float axistol, int32_t* Labels, double* Normals, float* Quats, int32_t* Phases, unsigned int* CrystalStructures, bool* CSLBoundary,
-                           float* CSLBoundaryIncoherence)
-  : m_CSLIndex(cslindex)
-  , m_AxisTol(axistol)
+  FeaturePairTable()
+  {
+    rehash(1024);
+  }
+
+  /**
+   * @brief findOrInsert Returns the index of the pair, adding it if it is new
+   */
+  int32_t findOrInsert(int32_t feature1, int32_t feature2)
+  {
+    const uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(feature1)) << 32) | static_cast<uint32_t>(feature2);
+    size_t slot = hash(key) & m_Mask;
+    while(m_Keys[slot] != 0)
+    {
+      if(m_Keys[slot] == key)
+      {
+        return m_Values[slot];
+      }
+      slot = (slot + 1) & m_Mask;
+    }
+    const int32_t index = static_cast<int32_t>(m_Pairs.size());
+    m_Keys[slot] = key;
+    m_Values[slot] = index;
+    m_Pairs.emplace_back(feature1, feature2);
+    if(2 * m_Pairs.size() > m_Keys.size())
+    {
+      rehash(2 * m_Keys.size());
+    }
+    return index;
+  }
+
+  const std::vector<std::pair<int32_t, int32_t>>& pairs() const
+  {
+    return m_Pairs;
+  }
+
+private:
+  std::vector<uint64_t> m_Keys;
+  std::vector<int32_t> m_Values;
+  size_t m_Mask = 0;
+  std::vector<std::pair<int32_t, int32_t>> m_Pairs;
+
+  static size_t hash(uint64_t key)
+  {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return static_cast<size_t>(key);
+  }
+
+  void rehash(size_t capacity)
+  {
+    m_Keys.assign(capacity, 0);
+    m_Values.assign(capacity, -1);
+    m_Mask = capacity - 1;
+    for(size_t p = 0; p < m_Pairs.size(); p++)
+    {
+      const uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(m_Pairs[p].first)) << 32) | static_cast<uint32_t>(m_Pairs[p].second);
+      size_t slot = hash(key) & m_Mask;
+      while(m_Keys[slot] != 0)
+      {
+        slot = (slot + 1) & m_Mask;
+      }
+      m_Keys[slot] = key;
+      m_Values[slot] = static_cast<int32_t>(p);
+    }
+  }
+};
+
+/**
+ * @brief The CSLMatch struct holds one pair of symmetry operators that brings a misorientation within
+ * tolerance of a CSL: the operator applied to the crystal direction of the face normal and the resulting
+ * misorientation axis
+ */
+struct CSLMatch
+{
+  int32_t symOp = 0;
+  double axis[3] = {0.0, 0.0, 0.0};
+};
+
+/**
+ * @brief The FeaturePairCSL struct holds the CSL classification of one ordered feature pair: the first CSL
+ * of the list that matches (-1 if none), the symmetry operators that achieve it and the orientation matrix
+ * of the first feature, so only the face normal dependent incoherence is left per face
+ */
+struct FeaturePairCSL
+{
+  int32_t cslSlot = -1;
+  uint32_t crystalStructure = 0;
+  double g1[3][3] = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+  std::vector<CSLMatch> matches;
+};
+
+/**
+ * @brief The ClassifyFeaturePairsImpl class evaluates the symmetric misorientations of each unique feature
+ * pair once, testing every misorientation against all requested CSLs in the same pass. Runs in parallel over
+ * feature pairs.
+ */
+class ClassifyFeaturePairsImpl
+{
+public:
+  ClassifyFeaturePairsImpl(const std::vector<std::pair<int32_t, int32_t>>& pairs, const std::vector<int32_t>& cslIndices, float angtol, float axistol, const float* quats, const int32_t* phases,
+                           const unsigned int* crystalStructures, std::vector<FeaturePairCSL>& results)
+  : m_Pairs(pairs)
+  , m_CSLIndices(cslIndices)
   , m_AngTol(angtol)
-  , m_Labels(Labels)
-  , m_Normals(Normals)
-  , m_Phases(Phases)
-  , m_Quats(Quats)
-  , m_CSLBoundary(CSLBoundary)
-  , m_CSLBoundaryIncoherence(CSLBoundaryIncoherence)
-  , m_CrystalStructures(CrystalStructures)
+  , m_AxisTol(axistol)
+  , m_Quats(quats)
+  , m_Phases(phases)
+  , m_CrystalStructures(crystalStructures)
+  , m_Results(results)
   {
     m_OrientationOps = LaueOps::GetAllOrientationOps();
+    m_CSLAxisNorms.resize(m_CSLIndices.size());
+    for(size_t s = 0; s < m_CSLIndices.size(); s++)
+    {
+      const float* csl = TransformationPhaseConstants::CSLAxisAngle[m_CSLIndices[s]];
+      const double cslAxisNormDenom = sqrtf(csl[2] + csl[3] + csl[4]);
+      for(size_t i = 0; i < 3; ++i)
+      {
+        m_CSLAxisNorms[s][i] = csl[i + 2] / cslAxisNormDenom;
+      }
+    }
   }
 
-  virtual ~CalculateCSLBoundaryImpl() = default;
+  void classify(size_t start, size_t end) const
+  {
+    double w = 0.0;
+    double n1 = 0.0, n2 = 0.0, n3 = 0.0;
+    std::vector<std::pair<size_t, CSLMatch>> candidates;
+    for(size_t p = start; p < end; p++)
+    {
+      const int32_t feature1 = m_Pairs[p].first;
+      const int32_t feature2 = m_Pairs[p].second;
+      FeaturePairCSL& result = m_Results[p];
+
+      const float* quatPtr = m_Quats + feature1 * 4;
+      QuatD q1(quatPtr[0], quatPtr[1], quatPtr[2], quatPtr[3]);
+      quatPtr = m_Quats + feature2 * 4;
+      QuatD q2(quatPtr[0], quatPtr[1], quatPtr[2], quatPtr[3]);
+
+      const unsigned int phase1 = m_CrystalStructures[m_Phases[feature1]];
+      result.crystalStructure = phase1;
+      const int nsym = m_OrientationOps[phase1]->getNumSymOps();
+      const QuatD misq = q1 * (q2.conjugate());
+      OrientationTransformation::qu2om<QuatD, OrientationD>(q1).toGMatrix(result.g1);
+
+      candidates.clear();
+      size_t bestSlot = m_CSLIndices.size();
+      for(int j = 0; j < nsym; j++)
+      {
+        QuatD sym_q = m_OrientationOps[phase1]->getQuatSymOp(j);
+        const QuatD s1_misq = misq * sym_q;
+        for(int k = 0; k < nsym; k++)
+        {
+          // calculate the symmetric misorienation
+          sym_q = m_OrientationOps[phase1]->getQuatSymOp(k);
+          const QuatD s2_misq = sym_q.conjugate() * s1_misq;
+          OrientationTransformation::qu2ax<QuatD, OrientationD>(s2_misq).toAxisAngle(n1, n2, n3, w);
+          w = w * 180.0 / SIMPLib::Constants::k_PiD;
+          for(size_t s = 0; s < bestSlot + 1 && s < m_CSLIndices.size(); s++)
+          {
+            const std::array<double, 3>& cslAxisNorm = m_CSLAxisNorms[s];
+            const double axisdiffCSL = std::acos(std::fabs(n1) * cslAxisNorm[0] + std::fabs(n2) * cslAxisNorm[1] + std::fabs(n3) * cslAxisNorm[2]);
+            const double angdiffCSL = std::fabs(w - TransformationPhaseConstants::CSLAxisAngle[m_CSLIndices[s]][1]);
+            if(axisdiffCSL < m_AxisTol && angdiffCSL < m_AngTol)
+            {
+              CSLMatch match;
+              match.symOp = j;
+              match.axis[0] = n1;
+              match.axis[1] = n2;
+              match.axis[2] = n3;
+              candidates.emplace_back(s, match);
+              bestSlot = std::min(bestSlot, s);
+              break;
+            }
+          }
+        }
+      }
 
-  void generate(size_t start, size_t end) const
+      // Only the first CSL of the list that matches is kept
+      result.cslSlot = (bestSlot < m_CSLIndices.size()) ? static_cast<int32_t>(bestSlot) : -1;
+      result.matches.clear();
+      for(const std::pair<size_t, CSLMatch>& candidate : candidates)
+      {
+        if(candidate.first == bestSlot)
+        {
+          result.matches.push_back(candidate.second);
+        }
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
   {
-    int feature1, feature2;
-    double normal[3];
-    double g1[3][3];
-    double w;
-    unsigned int phase1, phase2;
+    classify(range.min(), range.max());
+  }
 
-    double axisdiffCSL, angdiffCSL;
-    double n[3];
-    double incoherence;
-    double n1 = 0.0, n2 = 0.0, n3 = 0.0;
+private:
+  const std::vector<std::pair<int32_t, int32_t>>& m_Pairs;
+  const std::vector<int32_t>& m_CSLIndices;
+  std::vector<std::array<double, 3>> m_CSLAxisNorms;
+  float m_AngTol;
+  float m_AxisTol;
+  const float* m_Quats;
+  const int32_t* m_Phases;
+  const unsigned int* m_CrystalStructures;
+  std::vector<FeaturePairCSL>& m_Results;
+  LaueOpsContainer m_OrientationOps;
+};
 
-    QuatD misq;
-    QuatD sym_q;
-    QuatD s1_misq;
-    QuatD s2_misq;
+/**
+ * @brief The CalculateCSLBoundaryImpl class flags the faces whose feature pair matched a CSL and computes
+ * their incoherence, the smallest angle between a matching misorientation axis and the crystal direction
+ * parallel to the face normal. Runs in parallel over faces.
+ */
+class CalculateCSLBoundaryImpl
+{
+public:
+  CalculateCSLBoundaryImpl(const std::vector<int32_t>& facePairs, const std::vector<FeaturePairCSL>& pairResults, const std::vector<int32_t>& cslIndices, const double* normals, bool* cslBoundary,
+                           float* cslBoundaryIncoherence, float* cslSigma)
+  : m_FacePairs(facePairs)
+  , m_PairResults(pairResults)
+  , m_CSLIndices(cslIndices)
+  , m_Normals(normals)
+  , m_CSLBoundary(cslBoundary)
+  , m_CSLBoundaryIncoherence(cslBoundaryIncoherence)
+  , m_CSLSigma(cslSigma)
+  {
+    m_OrientationOps = LaueOps::GetAllOrientationOps();
+  }
 
+  void generate(size_t start, size_t end) const
+  {
+    double normal[3];
+    double g1[3][3];
     double xstl_norm[3];
-    std::array<double, 3> s_xstl_norm;
-    double cslAxisNorm[3];
-    double cslAxisNormDenom = 0.0;
-    cslAxisNormDenom =
-        sqrtf(TransformationPhaseConstants::CSLAxisAngle[m_CSLIndex][2] + TransformationPhaseConstants::CSLAxisAngle[m_CSLIndex][3] + TransformationPhaseConstants::CSLAxisAngle[m_CSLIndex][4]);
-    for(int i = 0; i < 3; ++i)
-    {
-      cslAxisNorm[i] = TransformationPhaseConstants::CSLAxisAngle[m_CSLIndex][i + 2] / cslAxisNormDenom;
-    }
+    double n[3];
+    std::array<double, 3> s_xstl_norm = {0.0, 0.0, 0.0};
     for(size_t i = start; i < end; i++)
     {
-      feature1 = m_Labels[2 * i];
-      feature2 = m_Labels[2 * i + 1];
+      if(m_FacePairs[i] < 0)
+      {
+        continue;
+      }
+      const FeaturePairCSL& pair = m_PairResults[m_FacePairs[i]];
+      if(pair.cslSlot < 0)
+      {
+        continue;
+      }
+      m_CSLBoundary[i] = true;
+      if(nullptr != m_CSLSigma)
+      {
+        m_CSLSigma[i] = TransformationPhaseConstants::CSLAxisAngle[m_CSLIndices[pair.cslSlot]][0];
+      }
+
       normal[0] = m_Normals[3 * i];
       normal[1] = m_Normals[3 * i + 1];
       normal[2] = m_Normals[3 * i + 2];
-      // different than Find Twin Boundaries here because will only compare if
-      // the features are different phases
-      if(feature1 > 0 && feature2 > 0) // && m_Phases[feature1] != m_Phases[feature2])
+      std::copy(&pair.g1[0][0], &pair.g1[0][0] + 9, &g1[0][0]);
+      MatrixMath::Multiply3x3with3x1(g1, normal, xstl_norm);
+
+      // calculate crystal direction parallel to normal once per symmetry operator
+      int32_t symOp = -1;
+      for(const CSLMatch& match : pair.matches)
       {
-        w = 10000.0;
-        float* quatPtr = m_Quats + feature1 * 4;
-        QuatD q1(quatPtr[0], quatPtr[1], quatPtr[2], quatPtr[3]);
-        quatPtr = m_Quats + feature2 * 4;
-        QuatD q2(quatPtr[0], quatPtr[1], quatPtr[2], quatPtr[3]);
-
-        phase1 = m_CrystalStructures[m_Phases[feature1]];
-        phase2 = m_CrystalStructures[m_Phases[feature2]];
-        if(phase1 == phase2)
+        if(match.symOp != symOp)
         {
-          int nsym = m_OrientationOps[phase1]->getNumSymOps();
-          misq = q1 * (q2.conjugate());
-          OrientationTransformation::qu2om<QuatD, OrientationD>(q1).toGMatrix(g1);
-          MatrixMath::Multiply3x3with3x1(g1, normal, xstl_norm);
-          for(int j = 0; j < nsym; j++)
-          {
-            sym_q = m_OrientationOps[phase1]->getQuatSymOp(j);
-            // calculate crystal direction parallel to normal
-            s1_misq = misq * sym_q;
-            s_xstl_norm = sym_q.multiplyByVector(xstl_norm);
-            for(int k = 0; k < nsym; k++)
-            {
-              // calculate the symmetric misorienation
-              sym_q = m_OrientationOps[phase1]->getQuatSymOp(k);
-              s2_misq = sym_q.conjugate() * s1_misq;
-
-              OrientationTransformation::qu2ax<QuatD, OrientationD>(s2_misq).toAxisAngle(n1, n2, n3, w);
-              w = w * 180.0 / SIMPLib::Constants::k_PiD;
-              axisdiffCSL = std::acos(std::fabs(n1) * cslAxisNorm[0] + std::fabs(n2) * cslAxisNorm[1] + std::fabs(n3) * cslAxisNorm[2]);
-              angdiffCSL = std::fabs(w - TransformationPhaseConstants::CSLAxisAngle[m_CSLIndex][1]);
-              if(axisdiffCSL < m_AxisTol && angdiffCSL < m_AngTol)
-              {
-                n[0] = n1;
-                n[1] = n2;
-                n[2] = n3;
-                m_CSLBoundary[i] = true;
-                incoherence = 180.0 * std::acos(GeometryMath::CosThetaBetweenVectors(n, s_xstl_norm.data())) / SIMPLib::Constants::k_PiD;
-                if(incoherence > 90.0)
-                {
-                  incoherence = 180.0 - incoherence;
-                }
-                if(incoherence < m_CSLBoundaryIncoherence[i])
-                {
-                  m_CSLBoundaryIncoherence[i] = incoherence;
-                }
-              }
-            }
-          }
+          symOp = match.symOp;
+          QuatD sym_q = m_OrientationOps[pair.crystalStructure]->getQuatSymOp(symOp);
+          s_xstl_norm = sym_q.multiplyByVector(xstl_norm);
+        }
+        n[0] = match.axis[0];
+        n[1] = match.axis[1];
+        n[2] = match.axis[2];
+        double incoherence = 180.0 * std::acos(GeometryMath::CosThetaBetweenVectors(n, s_xstl_norm.data())) / SIMPLib::Constants::k_PiD;
+        if(incoherence > 90.0)
+        {
+          incoherence = 180.0 - incoherence;
+        }
+        if(incoherence < m_CSLBoundaryIncoherence[i])
+        {
+          m_CSLBoundaryIncoherence[i] = incoherence;
         }
       }
     }
   }
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  void operator()(const tbb::blocked_range<size_t>& r) const
+  void operator()(const SIMPLRange& range) const
   {
-    generate(r.begin(), r.end());
+    generate(range.min(), range.max());
   }
-#endif
+
+private:
+  const std::vector<int32_t>& m_FacePairs;
+  const std::vector<FeaturePairCSL>& m_PairResults;
+  const std::vector<int32_t>& m_CSLIndices;
+  const double* m_Normals;
+  bool* m_CSLBoundary;
+  float* m_CSLBoundaryIncoherence;
+  float* m_CSLSigma;
+  LaueOpsContainer m_OrientationOps;
 };
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -220,7 +427,26 @@ FindCSLBoundaries::~FindCSLBoundaries() = default;
 void FindCSLBoundaries::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
-  parameters.push_back(SIMPL_NEW_FLOAT_FP("CSL (Sigma)", CSL, FilterParameter::Category::Parameter, FindCSLBoundaries));
+  {
+    // A linked boolean can only reveal its linked properties, so the choice between the single CSL field and
+    // the CSL list is made with a linked choice bound to ClassifySeveralCSLs (0 = single CSL, 1 = several CSLs)
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Classify Several CSLs");
+    parameter->setPropertyName("ClassifySeveralCSLs");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(FindCSLBoundaries, this, ClassifySeveralCSLs));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(FindCSLBoundaries, this, ClassifySeveralCSLs));
+    std::vector<QString> choices;
+    choices.push_back("Single CSL");
+    choices.push_back("Several CSLs");
+    parameter->setChoices(choices);
+    std::vector<QString> linkedProps = {"CSL", "CSLList", "SurfaceMeshCSLSigmaArrayName"};
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_FLOAT_FP("CSL (Sigma)", CSL, FilterParameter::Category::Parameter, FindCSLBoundaries, 0));
+  parameters.push_back(SIMPL_NEW_STRING_FP("CSL List (Sigma)", CSLList, FilterParameter::Category::Parameter, FindCSLBoundaries, 1));
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Axis Tolerance (Degrees)", AxisTolerance, FilterParameter::Category::Parameter, FindCSLBoundaries));
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Angle Tolerance (Degrees)", AngleTolerance, FilterParameter::Category::Parameter, FindCSLBoundaries));
   parameters.push_back(SeparatorFilterParameter::Create("Cell Feature Data", FilterParameter::Category::RequiredArray));
@@ -255,6 +481,8 @@ void FindCSLBoundaries::setupFilterParameters()
                                                       FilterParameter::Category::CreatedArray, FindCSLBoundaries));
   parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("CSL Boundary Incoherence", SurfaceMeshCSLBoundaryIncoherenceArrayName, SurfaceMeshFaceLabelsArrayPath, SurfaceMeshFaceLabelsArrayPath,
                                                       FilterParameter::Category::CreatedArray, FindCSLBoundaries));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("CSL Sigma", SurfaceMeshCSLSigmaArrayName, SurfaceMeshFaceLabelsArrayPath, SurfaceMeshFaceLabelsArrayPath, FilterParameter::Category::CreatedArray,
+                                                      FindCSLBoundaries, 1));
   setFilterParameters(parameters);
 }
 // -----------------------------------------------------------------------------
@@ -271,6 +499,9 @@ void FindCSLBoundaries::readFilterParameters(AbstractFilterParametersReader* rea
   setCSL(reader->readValue("CSL", getCSL()));
   setAxisTolerance(reader->readValue("AxisTolerance", getAxisTolerance()));
   setAngleTolerance(reader->readValue("AngleTolerance", getAngleTolerance()));
+  setClassifySeveralCSLs(reader->readValue("ClassifySeveralCSLs", getClassifySeveralCSLs()));
+  setCSLList(reader->readString("CSLList", getCSLList()));
+  setSurfaceMeshCSLSigmaArrayName(reader->readString("SurfaceMeshCSLSigmaArrayName", getSurfaceMeshCSLSigmaArrayName()));
   reader->closeFilterGroup();
 }
 
@@ -340,6 +571,50 @@ void FindCSLBoundaries::dataCheckSurfaceMesh()
   {
     m_SurfaceMeshCSLBoundaryIncoherence = m_SurfaceMeshCSLBoundaryIncoherencePtr.lock()->getPointer(0);
   } /* Now assign the raw pointer to data from the DataArray<T> object */
+
+  m_CSLIndices.clear();
+  m_SurfaceMeshCSLSigma = nullptr;
+  if(m_ClassifySeveralCSLs)
+  {
+    QStringList tokens = getCSLList().split(',', QString::SkipEmptyParts);
+    for(const QString& token : tokens)
+    {
+      bool ok = false;
+      float csl = token.trimmed().toFloat(&ok);
+      if(!ok)
+      {
+        QString ss = QObject::tr("CSL '%1' is not a number").arg(token.trimmed());
+        setErrorCondition(k_CSLListParseError, ss);
+        return;
+      }
+      int32_t cslIndex = FindCSLIndex(csl);
+      if(cslIndex < 0)
+      {
+        QString ss = QObject::tr("CSL '%1' is not one of the tabulated CSLs").arg(token.trimmed());
+        setErrorCondition(k_UnknownCSLError, ss);
+        return;
+      }
+      m_CSLIndices.push_back(cslIndex);
+    }
+    if(m_CSLIndices.empty())
+    {
+      QString ss = QObject::tr("At least one CSL must be given when \"Classify Several CSLs\" is checked");
+      setErrorCondition(k_CSLListParseError, ss);
+      return;
+    }
+
+    tempPath.update(m_SurfaceMeshFaceLabelsArrayPath.getDataContainerName(), m_SurfaceMeshFaceLabelsArrayPath.getAttributeMatrixName(), getSurfaceMeshCSLSigmaArrayName());
+    m_SurfaceMeshCSLSigmaPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0.0f, dims, "", DataArrayID33);
+    if(nullptr != m_SurfaceMeshCSLSigmaPtr.lock())
+    {
+      m_SurfaceMeshCSLSigma = m_SurfaceMeshCSLSigmaPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
+  else
+  {
+    // An unknown CSL falls back to the first tabulated CSL
+    m_CSLIndices.push_back(std::max(FindCSLIndex(m_CSL), 0));
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -372,34 +647,49 @@ void FindCSLBoundaries::execute()
     return;
   }
 
-  int64_t numTriangles = m_SurfaceMeshFaceLabelsPtr.lock()->getNumberOfTuples();
+  size_t numTriangles = m_SurfaceMeshFaceLabelsPtr.lock()->getNumberOfTuples();
+
+  float angtol = m_AngleTolerance;
+  float axistol = static_cast<float>(m_AxisTolerance * M_PI / 180.0f);
 
-  int cslindex = 0;
-  for(int i = 0; i < 21; ++i)
+  // All faces between the same two features share a misorientation, so each feature pair is classified once
+  FeaturePairTable pairTable;
+  std::vector<int32_t> facePairs(numTriangles, -1);
+  for(size_t i = 0; i < numTriangles; i++)
   {
-    if(static_cast<int>(TransformationPhaseConstants::CSLAxisAngle[i][0]) == static_cast<int>(m_CSL))
+    int32_t feature1 = m_SurfaceMeshFaceLabels[2 * i];
+    int32_t feature2 = m_SurfaceMeshFaceLabels[2 * i + 1];
+    // different than Find Twin Boundaries here because will only compare if
+    // the features are different phases
+    if(feature1 > 0 && feature2 > 0 && m_CrystalStructures[m_FeaturePhases[feature1]] == m_CrystalStructures[m_FeaturePhases[feature2]])
     {
-      cslindex = i;
-      break;
+      facePairs[i] = pairTable.findOrInsert(feature1, feature2);
     }
   }
-  float angtol = m_AngleTolerance;
-  float axistol = static_cast<float>(m_AxisTolerance * M_PI / 180.0f);
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  if(true)
+  if(getCancel())
   {
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, numTriangles),
-                      CalculateCSLBoundaryImpl(cslindex, angtol, axistol, m_SurfaceMeshFaceLabels, m_SurfaceMeshFaceNormals, m_AvgQuats, m_FeaturePhases, m_CrystalStructures, m_SurfaceMeshCSLBoundary,
-                                               m_SurfaceMeshCSLBoundaryIncoherence),
-                      tbb::auto_partitioner());
+    return;
   }
-  else
-#endif
+
+  const std::vector<std::pair<int32_t, int32_t>>& pairs = pairTable.pairs();
+  std::vector<FeaturePairCSL> pairResults(pairs.size());
   {
-    CalculateCSLBoundaryImpl serial(cslindex, angtol, axistol, m_SurfaceMeshFaceLabels, m_SurfaceMeshFaceNormals, m_AvgQuats, m_FeaturePhases, m_CrystalStructures, m_SurfaceMeshCSLBoundary,
-                                    m_SurfaceMeshCSLBoundaryIncoherence);
-    serial.generate(0, numTriangles);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, pairs.size());
+    dataAlg.execute(ClassifyFeaturePairsImpl(pairs, m_CSLIndices, angtol, axistol, m_AvgQuats, m_FeaturePhases, m_CrystalStructures, pairResults));
+  }
+
+  if(getCancel())
+  {
+    return;
+  }
+
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numTriangles);
+    dataAlg.execute(
+        CalculateCSLBoundaryImpl(facePairs, pairResults, m_CSLIndices, m_SurfaceMeshFaceNormals, m_SurfaceMeshCSLBoundary, m_SurfaceMeshCSLBoundaryIncoherence, m_SurfaceMeshCSLSigma));
   }
 
   notifyStatusMessage("FindCSLBoundaries Completed");
@@ -625,3 +915,39 @@ QString FindCSLBoundaries::getSurfaceMeshCSLBoundaryIncoherenceArrayName() const
 {
   return m_SurfaceMeshCSLBoundaryIncoherenceArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void FindCSLBoundaries::setClassifySeveralCSLs(bool value)
+{
+  m_ClassifySeveralCSLs = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindCSLBoundaries::getClassifySeveralCSLs() const
+{
+  return m_ClassifySeveralCSLs;
+}
+
+// -----------------------------------------------------------------------------
+void FindCSLBoundaries::setCSLList(const QString& value)
+{
+  m_CSLList = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindCSLBoundaries::getCSLList() const
+{
+  return m_CSLList;
+}
+
+// -----------------------------------------------------------------------------
+void FindCSLBoundaries::setSurfaceMeshCSLSigmaArrayName(const QString& value)
+{
+  m_SurfaceMeshCSLSigmaArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindCSLBoundaries::getSurfaceMeshCSLSigmaArrayName() const
+{
+  return m_SurfaceMeshCSLSigmaArrayName;
+}
@@ -77,6 +77,8 @@ class DREAM3DReview_EXPORT FindCSLBoundaries : public AbstractFilter
   PYB11_SHARED_POINTERS(FindCSLBoundaries)
   PYB11_FILTER_NEW_MACRO(FindCSLBoundaries)
   PYB11_PROPERTY(float CSL READ getCSL WRITE setCSL)
+  PYB11_PROPERTY(bool ClassifySeveralCSLs READ getClassifySeveralCSLs WRITE setClassifySeveralCSLs)
+  PYB11_PROPERTY(QString CSLList READ getCSLList WRITE setCSLList)
   PYB11_PROPERTY(float AxisTolerance READ getAxisTolerance WRITE setAxisTolerance)
   PYB11_PROPERTY(float AngleTolerance READ getAngleTolerance WRITE setAngleTolerance)
   PYB11_PROPERTY(DataArrayPath AvgQuatsArrayPath READ getAvgQuatsArrayPath WRITE setAvgQuatsArrayPath)
@@ -86,6 +88,7 @@ class DREAM3DReview_EXPORT FindCSLBoundaries : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath SurfaceMeshFaceNormalsArrayPath READ getSurfaceMeshFaceNormalsArrayPath WRITE setSurfaceMeshFaceNormalsArrayPath)
   PYB11_PROPERTY(QString SurfaceMeshCSLBoundaryArrayName READ getSurfaceMeshCSLBoundaryArrayName WRITE setSurfaceMeshCSLBoundaryArrayName)
   PYB11_PROPERTY(QString SurfaceMeshCSLBoundaryIncoherenceArrayName READ getSurfaceMeshCSLBoundaryIncoherenceArrayName WRITE setSurfaceMeshCSLBoundaryIncoherenceArrayName)
+  PYB11_PROPERTY(QString SurfaceMeshCSLSigmaArrayName READ getSurfaceMeshCSLSigmaArrayName WRITE setSurfaceMeshCSLSigmaArrayName)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -141,6 +144,28 @@ public:
   float getAngleTolerance() const;
   Q_PROPERTY(float AngleTolerance READ getAngleTolerance WRITE setAngleTolerance)
 
+  /**
+   * @brief Setter property for ClassifySeveralCSLs
+   */
+  void setClassifySeveralCSLs(bool value);
+  /**
+   * @brief Getter property for ClassifySeveralCSLs
+   * @return Value of ClassifySeveralCSLs
+   */
+  bool getClassifySeveralCSLs() const;
+  Q_PROPERTY(bool ClassifySeveralCSLs READ getClassifySeveralCSLs WRITE setClassifySeveralCSLs)
+
+  /**
+   * @brief Setter property for CSLList
+   */
+  void setCSLList(const QString& value);
+  /**
+   * @brief Getter property for CSLList
+   * @return Value of CSLList
+   */
+  QString getCSLList() const;
+  Q_PROPERTY(QString CSLList READ getCSLList WRITE setCSLList)
+
   /**
    * @brief Setter property for AvgQuatsArrayPath
    */
@@ -218,6 +243,17 @@ public:
   QString getSurfaceMeshCSLBoundaryIncoherenceArrayName() const;
   Q_PROPERTY(QString SurfaceMeshCSLBoundaryIncoherenceArrayName READ getSurfaceMeshCSLBoundaryIncoherenceArrayName WRITE setSurfaceMeshCSLBoundaryIncoherenceArrayName)
 
+  /**
+   * @brief Setter property for SurfaceMeshCSLSigmaArrayName
+   */
+  void setSurfaceMeshCSLSigmaArrayName(const QString& value);
+  /**
+   * @brief Getter property for SurfaceMeshCSLSigmaArrayName
+   * @return Value of SurfaceMeshCSLSigmaArrayName
+   */
+  QString getSurfaceMeshCSLSigmaArrayName() const;
+  Q_PROPERTY(QString SurfaceMeshCSLSigmaArrayName READ getSurfaceMeshCSLSigmaArrayName WRITE setSurfaceMeshCSLSigmaArrayName)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -301,10 +337,14 @@ private:
   bool* m_SurfaceMeshCSLBoundary = nullptr;
   std::weak_ptr<DataArray<float>> m_SurfaceMeshCSLBoundaryIncoherencePtr;
   float* m_SurfaceMeshCSLBoundaryIncoherence = nullptr;
+  std::weak_ptr<DataArray<float>> m_SurfaceMeshCSLSigmaPtr;
+  float* m_SurfaceMeshCSLSigma = nullptr;
 
   float m_CSL = {3.0f};
   float m_AxisTolerance = {0.0f};
   float m_AngleTolerance = {0.0f};
+  bool m_ClassifySeveralCSLs = {false};
+  QString m_CSLList = {"3, 9, 27"};
   DataArrayPath m_AvgQuatsArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, SIMPL::FeatureData::AvgQuats};
   DataArrayPath m_FeaturePhasesArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, SIMPL::FeatureData::Phases};
   DataArrayPath m_CrystalStructuresArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellEnsembleAttributeMatrixName, SIMPL::EnsembleData::CrystalStructures};
@@ -312,6 +352,9 @@ private:
   DataArrayPath m_SurfaceMeshFaceNormalsArrayPath = {SIMPL::Defaults::TriangleDataContainerName, SIMPL::Defaults::FaceAttributeMatrixName, SIMPL::FaceData::SurfaceMeshFaceNormals};
   QString m_SurfaceMeshCSLBoundaryArrayName = {TransformationPhaseConstants::SurfaceMeshCSLBoundary};
   QString m_SurfaceMeshCSLBoundaryIncoherenceArrayName = {TransformationPhaseConstants::SurfaceMeshCSLBoundaryIncoherence};
+  QString m_SurfaceMeshCSLSigmaArrayName = {TransformationPhaseConstants::SurfaceMeshCSLSigma};
+
+  std::vector<int32_t> m_CSLIndices;
 
   LaueOpsContainer m_OrientationOps;
   CubicOps::Pointer m_CubicOps;
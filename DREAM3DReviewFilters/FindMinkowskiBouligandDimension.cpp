@@ -14,21 +14,420 @@
 
 #include "FindMinkowskiBouligandDimension.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <mutex>
+#include <numeric>
 
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
+namespace
+{
+constexpr size_t k_BitsPerWord = 64;
+
+/**
+ * @brief The BitGrid struct is a bit-packed occupancy grid. Each row along X is padded to a whole number of
+ * 64 bit words, and the bits past the end of a row are always 0.
+ */
+struct BitGrid
+{
+  size_t dims[3] = {0, 0, 0};
+  size_t rowWords = 0;
+  std::vector<uint64_t> words;
+
+  void resize(const size_t newDims[3])
+  {
+    dims[0] = newDims[0];
+    dims[1] = newDims[1];
+    dims[2] = newDims[2];
+    rowWords = (dims[0] + k_BitsPerWord - 1) / k_BitsPerWord;
+    words.assign(rowWords * dims[1] * dims[2], 0);
+  }
+
+  uint64_t* row(size_t y, size_t z)
+  {
+    return words.data() + (z * dims[1] + y) * rowWords;
+  }
+
+  const uint64_t* row(size_t y, size_t z) const
+  {
+    return words.data() + (z * dims[1] + y) * rowWords;
+  }
+};
+
+// -----------------------------------------------------------------------------
+inline size_t CountBits(uint64_t word)
+{
+  word = word - ((word >> 1) & 0x5555555555555555ULL);
+  word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+  word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief ReducePairs ORs each pair of adjacent bits (2i, 2i + 1) of a word and packs the 32 results into the
+ * low half of the word
+ */
+inline uint64_t ReducePairs(uint64_t word)
+{
+  word = (word | (word >> 1)) & 0x5555555555555555ULL;
+  word = (word | (word >> 1)) & 0x3333333333333333ULL;
+  word = (word | (word >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+  word = (word | (word >> 4)) & 0x00FF00FF00FF00FFULL;
+  word = (word | (word >> 8)) & 0x0000FFFF0000FFFFULL;
+  word = (word | (word >> 16)) & 0x00000000FFFFFFFFULL;
+  return word;
+}
+
+/**
+ * @brief The PackOccupancyImpl class fills a bit grid from the voxels of a box of the image for which the
+ * predicate is true, in parallel over Z slices of the box
+ */
+template <typename Predicate>
+class PackOccupancyImpl
+{
+public:
+  PackOccupancyImpl(const size_t* imageDims, const size_t* boxMin, Predicate occupied, BitGrid& grid)
+  : m_ImageDims(imageDims)
+  , m_BoxMin(boxMin)
+  , m_Occupied(occupied)
+  , m_Grid(grid)
+  {
+  }
+
+  void pack(size_t zStart, size_t zEnd) const
+  {
+    for(size_t z = zStart; z < zEnd; z++)
+    {
+      for(size_t y = 0; y < m_Grid.dims[1]; y++)
+      {
+        size_t index = ((z + m_BoxMin[2]) * m_ImageDims[1] + (y + m_BoxMin[1])) * m_ImageDims[0] + m_BoxMin[0];
+        uint64_t* row = m_Grid.row(y, z);
+        for(size_t x = 0; x < m_Grid.dims[0]; x++, index++)
+        {
+          if(m_Occupied(index))
+          {
+            row[x / k_BitsPerWord] |= uint64_t(1) << (x % k_BitsPerWord);
+          }
+        }
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    pack(range.min(), range.max());
+  }
+
+private:
+  const size_t* m_ImageDims;
+  const size_t* m_BoxMin;
+  Predicate m_Occupied;
+  BitGrid& m_Grid;
+};
+
+/**
+ * @brief The ReduceLevelImpl class builds the next coarser level of a box counting pyramid. Along each axis,
+ * coarse box b covers fine boxes 2b - shift and 2b - shift + 1, where shift is 1 when the first fine box sits
+ * at an odd position of the (virtual) power of two grid, so the input never needs to be padded. Rows are
+ * ORed a word at a time, and each task writes whole Z slices of the coarse level and counts their occupied boxes.
+ */
+class ReduceLevelImpl
+{
+public:
+  ReduceLevelImpl(const BitGrid& fine, const size_t* shift, BitGrid& coarse, std::vector<size_t>& sliceCounts)
+  : m_Fine(fine)
+  , m_Shift(shift)
+  , m_Coarse(coarse)
+  , m_SliceCounts(sliceCounts)
+  {
+  }
+
+  void reduce(size_t zStart, size_t zEnd) const
+  {
+    std::vector<uint64_t> merged(2 * m_Coarse.rowWords, 0);
+    for(size_t z = zStart; z < zEnd; z++)
+    {
+      size_t count = 0;
+      for(size_t y = 0; y < m_Coarse.dims[1]; y++)
+      {
+        std::fill(merged.begin(), merged.end(), 0);
+        for(size_t dz = 0; dz < 2; dz++)
+        {
+          const size_t fz = 2 * z + dz - m_Shift[2];
+          if(2 * z + dz < m_Shift[2] || fz >= m_Fine.dims[2])
+          {
+            continue;
+          }
+          for(size_t dy = 0; dy < 2; dy++)
+          {
+            const size_t fy = 2 * y + dy - m_Shift[1];
+            if(2 * y + dy < m_Shift[1] || fy >= m_Fine.dims[1])
+            {
+              continue;
+            }
+            const uint64_t* in = m_Fine.row(fy, fz);
+            for(size_t w = 0; w < m_Fine.rowWords; w++)
+            {
+              merged[w] |= in[w];
+            }
+          }
+        }
+
+        if(m_Shift[0] != 0)
+        {
+          for(size_t w = merged.size() - 1; w > 0; w--)
+          {
+            merged[w] = (merged[w] << 1) | (merged[w - 1] >> (k_BitsPerWord - 1));
+          }
+          merged[0] <<= 1;
+        }
+
+        uint64_t* out = m_Coarse.row(y, z);
+        for(size_t w = 0; w < m_Coarse.rowWords; w++)
+        {
+          out[w] = ReducePairs(merged[2 * w]) | (ReducePairs(merged[2 * w + 1]) << 32);
+          count += CountBits(out[w]);
+        }
+      }
+      m_SliceCounts[z] = count;
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    reduce(range.min(), range.max());
+  }
+
+private:
+  const BitGrid& m_Fine;
+  const size_t* m_Shift;
+  BitGrid& m_Coarse;
+  std::vector<size_t>& m_SliceCounts;
+};
+
+// -----------------------------------------------------------------------------
+size_t NextPow2(size_t x)
+{
+  size_t pow2 = 1;
+  while(pow2 < x)
+  {
+    pow2 <<= 1;
+  }
+  return pow2;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief BoxCountDimension Box counts an occupancy grid and returns the slope of
+ * ln(number of boxes) against ln(1 / box size). The grid is treated as centered in a cube (a square for 2D
+ * grids) with a power of two edge, and each level halves the number of boxes along every edge.
+ * @param grid Occupancy of the finest level; consumed by the computation
+ * @param parallel Whether to build each level in parallel over Z slices
+ */
+double BoxCountDimension(BitGrid grid, bool parallel)
+{
+  const size_t maxDim = NextPow2(std::max({grid.dims[0], grid.dims[1], grid.dims[2]}));
+  size_t exponent = 0;
+  while((size_t(1) << exponent) < maxDim)
+  {
+    exponent++;
+  }
+  size_t first[3] = {(maxDim - grid.dims[0]) / 2, (maxDim - grid.dims[1]) / 2, (maxDim - grid.dims[2]) / 2};
+  if(grid.dims[2] == 1)
+  {
+    first[2] = 0;
+  }
+
+  std::vector<size_t> covering(exponent + 1, 0);
+  for(const uint64_t& word : grid.words)
+  {
+    covering[0] += CountBits(word);
+  }
+
+  BitGrid coarse;
+  for(size_t level = 1; level + 1 < covering.size(); level++)
+  {
+    size_t shift[3] = {0, 0, 0};
+    size_t coarseDims[3] = {0, 0, 0};
+    for(size_t a = 0; a < 3; a++)
+    {
+      shift[a] = first[a] & 1;
+      coarseDims[a] = (grid.dims[a] + shift[a] - 1) / 2 + 1;
+      first[a] >>= 1;
+    }
+    coarse.resize(coarseDims);
+
+    std::vector<size_t> sliceCounts(coarseDims[2], 0);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, coarseDims[2]);
+    dataAlg.setParallelizationEnabled(parallel);
+    dataAlg.execute(ReduceLevelImpl(grid, shift, coarse, sliceCounts));
+    covering[level] = std::accumulate(sliceCounts.begin(), sliceCounts.end(), size_t(0));
+
+    std::swap(grid, coarse);
+  }
+
+  covering.back() = 1;
+
+  // Pair ln(1 / box size) with the count of the level that has boxes of that size
+  std::vector<double> LnNumBoxes(covering.size(), 0);
+  std::vector<double> LnOneOverE(covering.size(), 0);
+  for(size_t i = 0; i < covering.size(); i++)
+  {
+    LnNumBoxes[i] = std::log(static_cast<double>(covering[covering.size() - 1 - i]));
+    LnOneOverE[i] = std::log(1.0 / static_cast<double>(maxDim >> i));
+  }
+
+  double xmean = std::accumulate(std::begin(LnOneOverE), std::end(LnOneOverE), 0.0);
+  double ymean = std::accumulate(std::begin(LnNumBoxes), std::end(LnNumBoxes), 0.0);
+  xmean /= LnOneOverE.size();
+  ymean /= LnNumBoxes.size();
+
+  double sumxx = std::inner_product(std::begin(LnOneOverE), std::end(LnOneOverE), std::begin(LnOneOverE), 0.0);
+  double ssxx = sumxx - (LnOneOverE.size() * xmean * xmean);
+  double sumxy = std::inner_product(std::begin(LnOneOverE), std::end(LnOneOverE), std::begin(LnNumBoxes), 0.0);
+  double ssxy = sumxy - (LnOneOverE.size() * xmean * ymean);
+
+  return ssxy / ssxx;
+}
+
+/**
+ * @brief The FindFeatureBoundsImpl class finds the bounding box of the voxels of each Feature, in parallel
+ * over Z slices; each task merges its boxes into the shared ones once at the end
+ */
+class FindFeatureBoundsImpl
+{
+public:
+  FindFeatureBoundsImpl(const size_t* dims, const int32_t* featureIds, size_t numFeatures, std::vector<size_t>& bounds, int32_t& maxFeatureId, std::mutex& mutex)
+  : m_Dims(dims)
+  , m_FeatureIds(featureIds)
+  , m_NumFeatures(numFeatures)
+  , m_Bounds(bounds)
+  , m_MaxFeatureId(maxFeatureId)
+  , m_Mutex(mutex)
+  {
+  }
+
+  void findBounds(size_t zStart, size_t zEnd) const
+  {
+    std::vector<size_t> bounds(6 * m_NumFeatures, 0);
+    for(size_t f = 0; f < m_NumFeatures; f++)
+    {
+      bounds[6 * f + 0] = bounds[6 * f + 2] = bounds[6 * f + 4] = std::numeric_limits<size_t>::max();
+    }
+    int32_t maxFeatureId = 0;
+    for(size_t z = zStart; z < zEnd; z++)
+    {
+      for(size_t y = 0; y < m_Dims[1]; y++)
+      {
+        size_t index = (z * m_Dims[1] + y) * m_Dims[0];
+        for(size_t x = 0; x < m_Dims[0]; x++, index++)
+        {
+          const int32_t feature = m_FeatureIds[index];
+          maxFeatureId = std::max(maxFeatureId, feature);
+          if(feature <= 0 || static_cast<size_t>(feature) >= m_NumFeatures)
+          {
+            continue;
+          }
+          size_t* box = bounds.data() + 6 * feature;
+          box[0] = std::min(box[0], x);
+          box[1] = std::max(box[1], x);
+          box[2] = std::min(box[2], y);
+          box[3] = std::max(box[3], y);
+          box[4] = std::min(box[4], z);
+          box[5] = std::max(box[5], z);
+        }
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_MaxFeatureId = std::max(m_MaxFeatureId, maxFeatureId);
+    for(size_t i = 0; i < bounds.size(); i += 2)
+    {
+      m_Bounds[i] = std::min(m_Bounds[i], bounds[i]);
+      m_Bounds[i + 1] = std::max(m_Bounds[i + 1], bounds[i + 1]);
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    findBounds(range.min(), range.max());
+  }
+
+private:
+  const size_t* m_Dims;
+  const int32_t* m_FeatureIds;
+  size_t m_NumFeatures;
+  std::vector<size_t>& m_Bounds;
+  int32_t& m_MaxFeatureId;
+  std::mutex& m_Mutex;
+};
+
+/**
+ * @brief The FindFeatureDimensionsImpl class computes the Minkowski-Bouligand dimension of each Feature from
+ * the masked voxels inside its bounding box, in parallel over Features
+ */
+class FindFeatureDimensionsImpl
+{
+public:
+  FindFeatureDimensionsImpl(const size_t* dims, const bool* mask, const int32_t* featureIds, const std::vector<size_t>& bounds, double* dimensions)
+  : m_Dims(dims)
+  , m_Mask(mask)
+  , m_FeatureIds(featureIds)
+  , m_Bounds(bounds)
+  , m_Dimensions(dimensions)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t f = range.min(); f < range.max(); f++)
+    {
+      const size_t* box = m_Bounds.data() + 6 * f;
+      if(box[0] > box[1])
+      {
+        continue;
+      }
+      const size_t boxMin[3] = {box[0], box[2], box[4]};
+      const size_t boxDims[3] = {box[1] - box[0] + 1, box[3] - box[2] + 1, box[5] - box[4] + 1};
+      const bool* mask = m_Mask;
+      const int32_t* featureIds = m_FeatureIds;
+      const int32_t feature = static_cast<int32_t>(f);
+      auto occupied = [mask, featureIds, feature](size_t index) { return mask[index] && featureIds[index] == feature; };
+
+      BitGrid grid;
+      grid.resize(boxDims);
+      PackOccupancyImpl<decltype(occupied)>(m_Dims, boxMin, occupied, grid).pack(0, boxDims[2]);
+      m_Dimensions[f] = BoxCountDimension(std::move(grid), false);
+    }
+  }
+
+private:
+  const size_t* m_Dims;
+  const bool* m_Mask;
+  const int32_t* m_FeatureIds;
+  const std::vector<size_t>& m_Bounds;
+  double* m_Dimensions;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -63,6 +462,14 @@ void FindMinkowskiBouligandDimension::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_AM_WITH_LINKED_DC_FP("Fractal Attribute Matrix", AttributeMatrixName, MaskArrayPath, FilterParameter::Category::CreatedArray, FindMinkowskiBouligandDimension));
   parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Minkowski-Bouligand Dimension", MinkowskiBouligandDimensionArrayName, MaskArrayPath, AttributeMatrixName,
                                                       FilterParameter::Category::CreatedArray, FindMinkowskiBouligandDimension));
+  std::vector<QString> linkedProps = {"FeatureIdsArrayPath", "CellFeatureAttributeMatrixPath", "FeatureMinkowskiBouligandDimensionsArrayName"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Find Dimension per Feature", FindPerFeature, FilterParameter::Category::Parameter, FindMinkowskiBouligandDimension, linkedProps));
+  dasReq = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+  parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Feature Ids", FeatureIdsArrayPath, FilterParameter::Category::RequiredArray, FindMinkowskiBouligandDimension, dasReq));
+  AttributeMatrixSelectionFilterParameter::RequirementType amReq = AttributeMatrixSelectionFilterParameter::CreateRequirement(AttributeMatrix::Type::CellFeature, IGeometry::Type::Image);
+  parameters.push_back(SIMPL_NEW_AM_SELECTION_FP("Cell Feature Attribute Matrix", CellFeatureAttributeMatrixPath, FilterParameter::Category::RequiredArray, FindMinkowskiBouligandDimension, amReq));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Feature Minkowski-Bouligand Dimensions", FeatureMinkowskiBouligandDimensionsArrayName, CellFeatureAttributeMatrixPath, CellFeatureAttributeMatrixPath,
+                                                      FilterParameter::Category::CreatedArray, FindMinkowskiBouligandDimension));
   setFilterParameters(parameters);
 }
 
@@ -112,28 +519,67 @@ void FindMinkowskiBouligandDimension::dataCheck()
   {
     m_MinkowskiBouligandDimension = m_MinkowskiBouligandDimensionPtr.lock()->getPointer(0);
   }
+
+  if(getFindPerFeature())
+  {
+    m_FeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getFeatureIdsArrayPath(), cDims);
+    if(nullptr != m_FeatureIdsPtr.lock())
+    {
+      m_FeatureIds = m_FeatureIdsPtr.lock()->getPointer(0);
+    }
+
+    getDataContainerArray()->getPrereqAttributeMatrixFromPath(this, getCellFeatureAttributeMatrixPath(), -301);
+
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+
+    QVector<IDataArray::Pointer> dataArrays = {m_MaskPtr.lock(), m_FeatureIdsPtr.lock()};
+    getDataContainerArray()->validateNumberOfTuples(this, dataArrays);
+
+    path = DataArrayPath(getCellFeatureAttributeMatrixPath().getDataContainerName(), getCellFeatureAttributeMatrixPath().getAttributeMatrixName(), getFeatureMinkowskiBouligandDimensionsArrayName());
+    m_FeatureMinkowskiBouligandDimensionsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, path, 0, cDims);
+    if(nullptr != m_FeatureMinkowskiBouligandDimensionsPtr.lock())
+    {
+      m_FeatureMinkowskiBouligandDimensions = m_FeatureMinkowskiBouligandDimensionsPtr.lock()->getPointer(0);
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void FindMinkowskiBouligandDimension::findSourceIndices(std::vector<size_t>& indices, size_t sourceDim, size_t index, size_t box[3], size_t imageDim)
+void FindMinkowskiBouligandDimension::findFeatureDimensions(const size_t dims[3])
 {
-  size_t zloop = imageDim == 3 ? 2 : 1;
-  for(size_t z = 0; z < zloop; z++)
+  size_t numFeatures = m_FeatureMinkowskiBouligandDimensionsPtr.lock()->getNumberOfTuples();
+
+  std::vector<size_t> bounds(6 * numFeatures, 0);
+  for(size_t f = 0; f < numFeatures; f++)
   {
-    size_t zStride = (z * sourceDim * sourceDim) + (box[2] * sourceDim * sourceDim * 2);
-    for(size_t y = 0; y < 2; y++)
-    {
-      size_t yStride = (y * sourceDim) + (box[1] * sourceDim * 2);
-      for(size_t x = 0; x < 2; x++)
-      {
-        size_t idx = (z * 2 * 2) + (y * 2) + x;
-        size_t mov_idx = zStride + yStride + x + (box[0] * 2);
-        indices[idx] = mov_idx;
-      }
-    }
+    bounds[6 * f + 0] = bounds[6 * f + 2] = bounds[6 * f + 4] = std::numeric_limits<size_t>::max();
   }
+  int32_t maxFeatureId = 0;
+  std::mutex mutex;
+  ParallelDataAlgorithm boundsAlg;
+  boundsAlg.setRange(0, dims[2]);
+  boundsAlg.execute(FindFeatureBoundsImpl(dims, m_FeatureIds, numFeatures, bounds, maxFeatureId, mutex));
+
+  if(static_cast<size_t>(maxFeatureId) >= numFeatures)
+  {
+    QString ss = QObject::tr("The Feature Ids array contains a value (%1) larger than the number of Features (%2)").arg(maxFeatureId).arg(numFeatures);
+    setErrorCondition(-5555, ss);
+    return;
+  }
+
+  notifyStatusMessage(QObject::tr("Box counting %1 Features").arg(numFeatures - 1));
+
+  std::fill(m_FeatureMinkowskiBouligandDimensions, m_FeatureMinkowskiBouligandDimensions + numFeatures, 0.0);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, numFeatures);
+  // Feature sizes vary widely, so let each task take a single Feature
+  dataAlg.setGrain(1);
+  dataAlg.execute(FindFeatureDimensionsImpl(dims, m_Mask, m_FeatureIds, bounds, m_FeatureMinkowskiBouligandDimensions));
 }
 
 // -----------------------------------------------------------------------------
@@ -149,15 +595,12 @@ void FindMinkowskiBouligandDimension::execute()
   }
 
   ImageGeom::Pointer image = getDataContainerArray()->getDataContainer(m_MaskArrayPath.getDataContainerName())->getGeometryAs<ImageGeom>();
-  SizeVec3Type dims = image->getDimensions();
-  // FloatVec3Type res = image->getSpacing();
-
-  size_t maxDim = std::max({dims[0], dims[1], dims[2]});
-  size_t imageDim = 3;
+  SizeVec3Type imageDims = image->getDimensions();
+  size_t dims[3] = {imageDims[0], imageDims[1], imageDims[2]};
 
+  // A 2D image keeps its memory layout when its unit dimension is moved to Z
   if(std::find(std::begin(dims), std::end(dims), 1) != std::end(dims))
   {
-    imageDim = 2;
     if(dims[0] == 1)
     {
       dims[0] = dims[1];
@@ -170,170 +613,27 @@ void FindMinkowskiBouligandDimension::execute()
     dims[2] = 1;
   }
 
-  auto is_pow_2 = [](size_t x) -> bool { return (x & (x - 1)) == 0u; };
-
-  auto next_pow_2 = [&](size_t x) -> size_t {
-    if(is_pow_2(x))
-    {
-      return x;
-    }
-    x |= x >> 1;
-    x |= x >> 2;
-    x |= x >> 4;
-    x |= x >> 8;
-    x |= x >> 16;
-    x |= x >> 32;
-    return x + 1;
-  };
-
-  auto floor_log2 = [](size_t x) -> size_t {
-    size_t exp = 0;
-    while(x >>= 1 != 0u)
-    {
-      ++exp;
-    }
-    return exp;
-  };
-
-  maxDim = next_pow_2(maxDim);
-  size_t exponent = floor_log2(maxDim);
-  size_t totalSize = std::pow(maxDim, imageDim);
-
-  std::vector<bool> source(totalSize, 0);
-  size_t offsets[3] = {(maxDim - dims[0]) / 2, (maxDim - dims[1]) / 2, (maxDim - dims[2]) / 2};
-
-  if(imageDim == 2)
-  {
-    offsets[2] = 0;
-  }
-
-  for(size_t z = 0; z < dims[2]; z++)
-  {
-    size_t zStride = (z * dims[1] * dims[0]);
-    for(size_t y = 0; y < dims[1]; y++)
-    {
-      size_t yStride = (y * dims[0]);
-      for(size_t x = 0; x < dims[0]; x++)
-      {
-        size_t index = zStride + yStride + x;
-        size_t gridIndex = ((z + offsets[2]) * maxDim * maxDim) + ((y + offsets[1]) * maxDim) + (x + offsets[0]);
-        source[gridIndex] = m_Mask[index];
-      }
-    }
-  }
-
-  size_t edgeLength = maxDim;
-  std::vector<size_t> boxDims(exponent + 1, edgeLength);
-  std::generate(std::next(std::begin(boxDims)), std::end(boxDims), [&edgeLength]() {
-    edgeLength /= 2;
-    return edgeLength;
-  });
+  const size_t origin[3] = {0, 0, 0};
+  const bool* mask = m_Mask;
+  auto occupied = [mask](size_t index) { return mask[index]; };
 
-  std::vector<size_t> covering(exponent + 1, 0);
-  size_t nextDim = *std::next(std::begin(boxDims));
-  std::vector<bool> sink;
-  sink.reserve(std::pow(nextDim, imageDim));
-  std::vector<size_t> indices(std::pow(2, imageDim), 0);
-  auto dimsIter = std::next(std::begin(boxDims));
-  auto coverIter = std::next(std::begin(covering));
-  size_t box[3] = {0, 0, 0};
+  BitGrid grid;
+  grid.resize(dims);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, dims[2]);
+  dataAlg.execute(PackOccupancyImpl<decltype(occupied)>(dims, origin, occupied, grid));
 
-  for(auto&& box : source)
-  {
-    if(box)
-    {
-      (*std::begin(covering))++;
-    }
-  }
+  m_MinkowskiBouligandDimension[0] = BoxCountDimension(std::move(grid), true);
 
-  for(; dimsIter != std::prev(std::end(boxDims)); ++dimsIter, ++coverIter)
+  if(m_FindPerFeature)
   {
-    sink.resize(std::pow(*dimsIter, imageDim));
-
-    size_t zloop = imageDim == 3 ? *dimsIter : 1;
-    for(size_t z = 0; z < zloop; z++)
+    findFeatureDimensions(dims);
+    if(getErrorCode() < 0)
     {
-      for(size_t y = 0; y < *dimsIter; y++)
-      {
-        for(size_t x = 0; x < *dimsIter; x++)
-        {
-          size_t index = (z * (*dimsIter) * (*dimsIter)) + (y * (*dimsIter)) + x;
-          box[0] = x;
-          box[1] = y;
-          box[2] = z;
-          findSourceIndices(indices, *std::prev(dimsIter), index, box, imageDim);
-          for(auto&& ind : indices)
-          {
-            if(source[ind])
-            {
-              sink[index] = true;
-              break;
-            }
-          }
-        }
-      }
-    }
-    for(auto&& box : sink)
-    {
-      if(box)
-      {
-        (*coverIter)++;
-      }
+      return;
     }
-
-    source = sink;
   }
 
-  covering.back() = 1;
-
-  std::vector<double> LnNumBoxes(covering.size(), 0);
-  std::vector<double> LnOneOverE(boxDims.size(), 0);
-#if 0
-  std::transform(std::rbegin(covering), std::rend(covering), std::begin(LnNumBoxes), [](size_t& x) -> double {
-    return std::log(x);
-  });
-#else
-  typedef std::vector<size_t>::iterator iter_type;
-  // ? 0 1 2 3 4 5 6 7 8 9 ?
-  iter_type from(covering.begin());                 //   ^
-                                                    //         ------>
-  iter_type until(covering.end());                  //                       ^
-                                                    //
-  std::reverse_iterator<iter_type> rev_until(from); // ^
-                                                    //         <------
-  std::reverse_iterator<iter_type> rev_from(until); //                     ^
-  std::vector<double>::size_type lnIdx = 0;
-  while(rev_from != rev_until)
-  {
-    LnNumBoxes[lnIdx] = static_cast<double>(std::log(*rev_from));
-    lnIdx++;
-    rev_from++;
-  }
-#endif
-
-  std::transform(std::begin(boxDims), std::end(boxDims), std::begin(LnOneOverE), [](size_t& x) -> double { return std::log(1.0 / x); });
-
-  auto linear_regression_slope = [&]() -> double {
-    double xmean = std::accumulate(std::begin(LnOneOverE), std::end(LnOneOverE), 0.0);
-    double ymean = std::accumulate(std::begin(LnNumBoxes), std::end(LnNumBoxes), 0.0);
-    xmean /= LnOneOverE.size();
-    ymean /= LnNumBoxes.size();
-
-    std::vector<double> xx;
-    std::transform(std::begin(LnOneOverE), std::end(LnOneOverE), std::begin(LnOneOverE), std::back_inserter(xx), std::multiplies<double>());
-    double sumxx = std::accumulate(std::begin(xx), std::end(xx), 0.0);
-    double ssxx = sumxx - (xx.size() * xmean * xmean);
-
-    std::vector<double> xy;
-    std::transform(std::begin(LnOneOverE), std::end(LnOneOverE), std::begin(LnNumBoxes), std::back_inserter(xy), std::multiplies<double>());
-    double sumxy = std::accumulate(std::begin(xy), std::end(xy), 0.0);
-    double ssxy = sumxy - (xy.size() * xmean * ymean);
-
-    return ssxy / ssxx;
-  };
-
-  m_MinkowskiBouligandDimension[0] = linear_regression_slope();
-
   notifyStatusMessage("Complete");
 }
 
@@ -473,3 +773,51 @@ QString FindMinkowskiBouligandDimension::getMinkowskiBouligandDimensionArrayName
 {
   return m_MinkowskiBouligandDimensionArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void FindMinkowskiBouligandDimension::setFindPerFeature(bool value)
+{
+  m_FindPerFeature = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindMinkowskiBouligandDimension::getFindPerFeature() const
+{
+  return m_FindPerFeature;
+}
+
+// -----------------------------------------------------------------------------
+void FindMinkowskiBouligandDimension::setFeatureIdsArrayPath(const DataArrayPath& value)
+{
+  m_FeatureIdsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindMinkowskiBouligandDimension::getFeatureIdsArrayPath() const
+{
+  return m_FeatureIdsArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindMinkowskiBouligandDimension::setCellFeatureAttributeMatrixPath(const DataArrayPath& value)
+{
+  m_CellFeatureAttributeMatrixPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindMinkowskiBouligandDimension::getCellFeatureAttributeMatrixPath() const
+{
+  return m_CellFeatureAttributeMatrixPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindMinkowskiBouligandDimension::setFeatureMinkowskiBouligandDimensionsArrayName(const QString& value)
+{
+  m_FeatureMinkowskiBouligandDimensionsArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindMinkowskiBouligandDimension::getFeatureMinkowskiBouligandDimensionsArrayName() const
+{
+  return m_FeatureMinkowskiBouligandDimensionsArrayName;
+}
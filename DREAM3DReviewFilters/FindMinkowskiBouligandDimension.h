@@ -82,6 +82,50 @@ public:
   QString getMinkowskiBouligandDimensionArrayName() const;
   Q_PROPERTY(QString MinkowskiBouligandDimensionArrayName READ getMinkowskiBouligandDimensionArrayName WRITE setMinkowskiBouligandDimensionArrayName)
 
+  /**
+   * @brief Setter property for FindPerFeature
+   */
+  void setFindPerFeature(bool value);
+  /**
+   * @brief Getter property for FindPerFeature
+   * @return Value of FindPerFeature
+   */
+  bool getFindPerFeature() const;
+  Q_PROPERTY(bool FindPerFeature READ getFindPerFeature WRITE setFindPerFeature)
+
+  /**
+   * @brief Setter property for FeatureIdsArrayPath
+   */
+  void setFeatureIdsArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for FeatureIdsArrayPath
+   * @return Value of FeatureIdsArrayPath
+   */
+  DataArrayPath getFeatureIdsArrayPath() const;
+  Q_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
+
+  /**
+   * @brief Setter property for CellFeatureAttributeMatrixPath
+   */
+  void setCellFeatureAttributeMatrixPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for CellFeatureAttributeMatrixPath
+   * @return Value of CellFeatureAttributeMatrixPath
+   */
+  DataArrayPath getCellFeatureAttributeMatrixPath() const;
+  Q_PROPERTY(DataArrayPath CellFeatureAttributeMatrixPath READ getCellFeatureAttributeMatrixPath WRITE setCellFeatureAttributeMatrixPath)
+
+  /**
+   * @brief Setter property for FeatureMinkowskiBouligandDimensionsArrayName
+   */
+  void setFeatureMinkowskiBouligandDimensionsArrayName(const QString& value);
+  /**
+   * @brief Getter property for FeatureMinkowskiBouligandDimensionsArrayName
+   * @return Value of FeatureMinkowskiBouligandDimensionsArrayName
+   */
+  QString getFeatureMinkowskiBouligandDimensionsArrayName() const;
+  Q_PROPERTY(QString FeatureMinkowskiBouligandDimensionsArrayName READ getFeatureMinkowskiBouligandDimensionsArrayName WRITE setFeatureMinkowskiBouligandDimensionsArrayName)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -155,12 +199,24 @@ private:
   bool* m_Mask = nullptr;
   std::weak_ptr<DataArray<double>> m_MinkowskiBouligandDimensionPtr;
   double* m_MinkowskiBouligandDimension = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_FeatureIdsPtr;
+  int32_t* m_FeatureIds = nullptr;
+  std::weak_ptr<DataArray<double>> m_FeatureMinkowskiBouligandDimensionsPtr;
+  double* m_FeatureMinkowskiBouligandDimensions = nullptr;
 
   DataArrayPath m_MaskArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::Mask};
   QString m_AttributeMatrixName = {"FractalData"};
   QString m_MinkowskiBouligandDimensionArrayName = {"MinkowskiBouligandDimension"};
+  bool m_FindPerFeature = {false};
+  DataArrayPath m_FeatureIdsArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::FeatureIds};
+  DataArrayPath m_CellFeatureAttributeMatrixPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, ""};
+  QString m_FeatureMinkowskiBouligandDimensionsArrayName = {"MinkowskiBouligandDimensions"};
 
-  void findSourceIndices(std::vector<size_t>& indices, size_t sourceDim, size_t index, size_t box[3], size_t imageDim);
+  /**
+   * @brief findFeatureDimensions Computes the Minkowski-Bouligand dimension of each Feature within its bounding box
+   * @param dims Image dimensions, with a unit dimension moved to Z for 2D images
+   */
+  void findFeatureDimensions(const size_t dims[3]);
 
 public:
   FindMinkowskiBouligandDimension(const FindMinkowskiBouligandDimension&) = delete;            // Copy Constructor Not Implemented
@@ -14,21 +14,342 @@
 
 #include "FindSurfaceRoughness.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <limits>
+#include <mutex>
+
+#include <Eigen/Dense>
 
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
+namespace
+{
+/**
+ * @brief The CellCenters struct gives the center of each cell of the image relative to the image origin
+ */
+struct CellCenters
+{
+  size_t dims[3] = {0, 0, 0};
+  double spacing[3] = {1.0, 1.0, 1.0};
+
+  void center(size_t x, size_t y, size_t z, double point[3]) const
+  {
+    point[0] = (static_cast<double>(x) + 0.5) * spacing[0];
+    point[1] = (static_cast<double>(y) + 0.5) * spacing[1];
+    point[2] = (static_cast<double>(z) + 0.5) * spacing[2];
+  }
+};
+
+/**
+ * @brief The RoughnessMoments struct holds the sums needed to fit a reference line (Y against X) and a
+ * reference plane to the boundary cells of a region
+ */
+struct RoughnessMoments
+{
+  double count = 0.0;
+  double sum[3] = {0.0, 0.0, 0.0};
+  // xx, yy, zz, xy, xz, yz
+  double sumProducts[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+  void add(const double point[3])
+  {
+    count += 1.0;
+    sum[0] += point[0];
+    sum[1] += point[1];
+    sum[2] += point[2];
+    sumProducts[0] += point[0] * point[0];
+    sumProducts[1] += point[1] * point[1];
+    sumProducts[2] += point[2] * point[2];
+    sumProducts[3] += point[0] * point[1];
+    sumProducts[4] += point[0] * point[2];
+    sumProducts[5] += point[1] * point[2];
+  }
+
+  void merge(const RoughnessMoments& other)
+  {
+    count += other.count;
+    for(size_t i = 0; i < 3; i++)
+    {
+      sum[i] += other.sum[i];
+    }
+    for(size_t i = 0; i < 6; i++)
+    {
+      sumProducts[i] += other.sumProducts[i];
+    }
+  }
+};
+
+/**
+ * @brief The RoughnessFit struct holds the reference line and plane fitted to a region. The line is the least
+ * squares fit of Y against X; the plane is the orthogonal least squares fit through the centroid.
+ */
+struct RoughnessFit
+{
+  bool lineValid = false;
+  double lineIntercept = 0.0;
+  double lineSlope = 0.0;
+  bool planeValid = false;
+  double centroid[3] = {0.0, 0.0, 0.0};
+  double normal[3] = {0.0, 0.0, 1.0};
+
+  double lineDistance(const double point[3]) const
+  {
+    return (point[1] - (lineIntercept + lineSlope * point[0])) / std::sqrt(1.0 + lineSlope * lineSlope);
+  }
+
+  double planeDistance(const double point[3]) const
+  {
+    return (point[0] - centroid[0]) * normal[0] + (point[1] - centroid[1]) * normal[1] + (point[2] - centroid[2]) * normal[2];
+  }
+};
+
+/**
+ * @brief The RoughnessResiduals struct accumulates the signed distances of the boundary cells of a region to
+ * its reference line and plane
+ */
+struct RoughnessResiduals
+{
+  double lineAbs = 0.0;
+  double lineSquared = 0.0;
+  double lineMin = std::numeric_limits<double>::max();
+  double lineMax = std::numeric_limits<double>::lowest();
+  double planeAbs = 0.0;
+  double planeSquared = 0.0;
+  double planeMin = std::numeric_limits<double>::max();
+  double planeMax = std::numeric_limits<double>::lowest();
+
+  void add(double lineDistance, double planeDistance)
+  {
+    lineAbs += std::abs(lineDistance);
+    lineSquared += lineDistance * lineDistance;
+    lineMin = std::min(lineMin, lineDistance);
+    lineMax = std::max(lineMax, lineDistance);
+    planeAbs += std::abs(planeDistance);
+    planeSquared += planeDistance * planeDistance;
+    planeMin = std::min(planeMin, planeDistance);
+    planeMax = std::max(planeMax, planeDistance);
+  }
+
+  void merge(const RoughnessResiduals& other)
+  {
+    lineAbs += other.lineAbs;
+    lineSquared += other.lineSquared;
+    lineMin = std::min(lineMin, other.lineMin);
+    lineMax = std::max(lineMax, other.lineMax);
+    planeAbs += other.planeAbs;
+    planeSquared += other.planeSquared;
+    planeMin = std::min(planeMin, other.planeMin);
+    planeMax = std::max(planeMax, other.planeMax);
+  }
+};
+
+/**
+ * @brief The RoughnessResult struct holds the roughness parameters of a region: the reference line
+ * (intercept, slope) relative to the image origin, the profile parameters Ra, Rq and Rz measured from the
+ * line, and the areal parameters Sa, Sq and Sz measured from the plane
+ */
+struct RoughnessResult
+{
+  double lineIntercept = 0.0;
+  double lineSlope = 0.0;
+  double profile[3] = {0.0, 0.0, 0.0};
+  double areal[3] = {0.0, 0.0, 0.0};
+};
+
+/**
+ * @brief The AccumulateRoughnessImpl class makes one pass over the boundary cells of the image, in parallel over
+ * rows, and either sums the fitting moments of each region or, once the fits are known, the residuals of each
+ * region. regionOf(index) returns the region of a cell, or a negative value to skip it. Each task accumulates
+ * privately and merges into the shared totals once.
+ */
+template <typename RegionOf>
+class AccumulateRoughnessImpl
+{
+public:
+  AccumulateRoughnessImpl(const CellCenters& cells, const int8_t* boundaryCells, RegionOf regionOf, size_t numRegions, const std::vector<RoughnessFit>* fits, std::vector<RoughnessMoments>& moments,
+                          std::vector<RoughnessResiduals>& residuals, std::mutex& mutex)
+  : m_Cells(cells)
+  , m_BoundaryCells(boundaryCells)
+  , m_RegionOf(regionOf)
+  , m_NumRegions(numRegions)
+  , m_Fits(fits)
+  , m_Moments(moments)
+  , m_Residuals(residuals)
+  , m_Mutex(mutex)
+  {
+  }
+
+  void accumulate(size_t rowStart, size_t rowEnd) const
+  {
+    std::vector<RoughnessMoments> moments(m_Fits == nullptr ? m_NumRegions : 0);
+    std::vector<RoughnessResiduals> residuals(m_Fits == nullptr ? 0 : m_NumRegions);
+    double point[3] = {0.0, 0.0, 0.0};
+    for(size_t row = rowStart; row < rowEnd; row++)
+    {
+      const size_t y = row % m_Cells.dims[1];
+      const size_t z = row / m_Cells.dims[1];
+      size_t index = row * m_Cells.dims[0];
+      for(size_t x = 0; x < m_Cells.dims[0]; x++, index++)
+      {
+        if(m_BoundaryCells[index] <= 0)
+        {
+          continue;
+        }
+        const int64_t region = m_RegionOf(index);
+        if(region < 0)
+        {
+          continue;
+        }
+        m_Cells.center(x, y, z, point);
+        if(m_Fits == nullptr)
+        {
+          moments[region].add(point);
+        }
+        else
+        {
+          const RoughnessFit& fit = (*m_Fits)[region];
+          residuals[region].add(fit.lineValid ? fit.lineDistance(point) : 0.0, fit.planeValid ? fit.planeDistance(point) : 0.0);
+        }
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for(size_t r = 0; r < moments.size(); r++)
+    {
+      m_Moments[r].merge(moments[r]);
+    }
+    for(size_t r = 0; r < residuals.size(); r++)
+    {
+      m_Residuals[r].merge(residuals[r]);
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    accumulate(range.min(), range.max());
+  }
+
+private:
+  const CellCenters& m_Cells;
+  const int8_t* m_BoundaryCells;
+  RegionOf m_RegionOf;
+  size_t m_NumRegions;
+  const std::vector<RoughnessFit>* m_Fits;
+  std::vector<RoughnessMoments>& m_Moments;
+  std::vector<RoughnessResiduals>& m_Residuals;
+  std::mutex& m_Mutex;
+};
+
+// -----------------------------------------------------------------------------
+RoughnessFit FitReferences(const RoughnessMoments& moments)
+{
+  RoughnessFit fit;
+  const double n = moments.count;
+  if(n < 2.0)
+  {
+    return fit;
+  }
+
+  double mean[3] = {moments.sum[0] / n, moments.sum[1] / n, moments.sum[2] / n};
+
+  double ssxx = moments.sumProducts[0] - n * mean[0] * mean[0];
+  double ssxy = moments.sumProducts[3] - n * mean[0] * mean[1];
+  if(ssxx > 0.0)
+  {
+    fit.lineValid = true;
+    fit.lineSlope = ssxy / ssxx;
+    fit.lineIntercept = mean[1] - fit.lineSlope * mean[0];
+  }
+
+  if(n >= 3.0)
+  {
+    Eigen::Matrix3d covariance;
+    covariance(0, 0) = moments.sumProducts[0] / n - mean[0] * mean[0];
+    covariance(1, 1) = moments.sumProducts[1] / n - mean[1] * mean[1];
+    covariance(2, 2) = moments.sumProducts[2] / n - mean[2] * mean[2];
+    covariance(0, 1) = covariance(1, 0) = moments.sumProducts[3] / n - mean[0] * mean[1];
+    covariance(0, 2) = covariance(2, 0) = moments.sumProducts[4] / n - mean[0] * mean[2];
+    covariance(1, 2) = covariance(2, 1) = moments.sumProducts[5] / n - mean[1] * mean[2];
+
+    // The plane normal is the direction of least variance
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(covariance);
+    if(solver.info() == Eigen::Success)
+    {
+      fit.planeValid = true;
+      for(size_t i = 0; i < 3; i++)
+      {
+        fit.centroid[i] = mean[i];
+        fit.normal[i] = solver.eigenvectors()(i, 0);
+      }
+    }
+  }
+
+  return fit;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief FindRoughness Computes the roughness parameters of every region in two streaming passes over the
+ * image: the first sums the moments that fix each region's reference line and plane, the second sums the
+ * distances of the boundary cells to them. Regions without enough boundary cells for a fit get zeros.
+ */
+template <typename RegionOf>
+std::vector<RoughnessResult> FindRoughness(const CellCenters& cells, const int8_t* boundaryCells, RegionOf regionOf, size_t numRegions)
+{
+  std::vector<RoughnessMoments> moments(numRegions);
+  std::vector<RoughnessResiduals> residuals(numRegions);
+  std::mutex mutex;
+
+  ParallelDataAlgorithm momentsAlg;
+  momentsAlg.setRange(0, cells.dims[1] * cells.dims[2]);
+  momentsAlg.execute(AccumulateRoughnessImpl<RegionOf>(cells, boundaryCells, regionOf, numRegions, nullptr, moments, residuals, mutex));
+
+  std::vector<RoughnessFit> fits(numRegions);
+  std::transform(moments.begin(), moments.end(), fits.begin(), FitReferences);
+
+  ParallelDataAlgorithm residualsAlg;
+  residualsAlg.setRange(0, cells.dims[1] * cells.dims[2]);
+  residualsAlg.execute(AccumulateRoughnessImpl<RegionOf>(cells, boundaryCells, regionOf, numRegions, &fits, moments, residuals, mutex));
+
+  std::vector<RoughnessResult> results(numRegions);
+  for(size_t r = 0; r < numRegions; r++)
+  {
+    const double n = moments[r].count;
+    const RoughnessResiduals& res = residuals[r];
+    if(fits[r].lineValid)
+    {
+      results[r].lineIntercept = fits[r].lineIntercept;
+      results[r].lineSlope = fits[r].lineSlope;
+      results[r].profile[0] = res.lineAbs / n;
+      results[r].profile[1] = std::sqrt(res.lineSquared / n);
+      results[r].profile[2] = res.lineMax - res.lineMin;
+    }
+    if(fits[r].planeValid)
+    {
+      results[r].areal[0] = res.planeAbs / n;
+      results[r].areal[1] = std::sqrt(res.planeSquared / n);
+      results[r].areal[2] = res.planeMax - res.planeMin;
+    }
+  }
+  return results;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -58,10 +379,18 @@ void FindSurfaceRoughness::initialize()
 void FindSurfaceRoughness::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
+  std::vector<QString> linkedProps = {"FeatureIdsArrayPath", "CellFeatureAttributeMatrixPath"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Find Roughness per Feature", FindPerFeature, FilterParameter::Category::Parameter, FindSurfaceRoughness, linkedProps));
   DataArraySelectionFilterParameter::RequirementType dasReq = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Int8, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Boundary Cells", BoundaryCellsArrayPath, FilterParameter::Category::RequiredArray, FindSurfaceRoughness, dasReq));
+  dasReq = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+  parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Feature Ids", FeatureIdsArrayPath, FilterParameter::Category::RequiredArray, FindSurfaceRoughness, dasReq));
+  AttributeMatrixSelectionFilterParameter::RequirementType amReq = AttributeMatrixSelectionFilterParameter::CreateRequirement(AttributeMatrix::Type::CellFeature, IGeometry::Type::Image);
+  parameters.push_back(SIMPL_NEW_AM_SELECTION_FP("Cell Feature Attribute Matrix", CellFeatureAttributeMatrixPath, FilterParameter::Category::RequiredArray, FindSurfaceRoughness, amReq));
   parameters.push_back(SIMPL_NEW_STRING_FP("Roughness Attribute Matrix", AttributeMatrixName, FilterParameter::Category::CreatedArray, FindSurfaceRoughness));
   parameters.push_back(SIMPL_NEW_STRING_FP("Roughness Parameters", RoughnessParamsArrayName, FilterParameter::Category::CreatedArray, FindSurfaceRoughness));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Profile Roughness", ProfileRoughnessArrayName, FilterParameter::Category::CreatedArray, FindSurfaceRoughness));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Areal Roughness", ArealRoughnessArrayName, FilterParameter::Category::CreatedArray, FindSurfaceRoughness));
   setFilterParameters(parameters);
 }
 
@@ -106,6 +435,55 @@ void FindSurfaceRoughness::dataCheck()
   {
     m_RoughnessParams = m_RoughnessParamsPtr.lock()->getPointer(0);
   }
+
+  path.setDataArrayName(getProfileRoughnessArrayName());
+  m_ProfileRoughnessPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, path, 0, cDims);
+  if(nullptr != m_ProfileRoughnessPtr.lock())
+  {
+    m_ProfileRoughness = m_ProfileRoughnessPtr.lock()->getPointer(0);
+  }
+
+  path.setDataArrayName(getArealRoughnessArrayName());
+  m_ArealRoughnessPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, path, 0, cDims);
+  if(nullptr != m_ArealRoughnessPtr.lock())
+  {
+    m_ArealRoughness = m_ArealRoughnessPtr.lock()->getPointer(0);
+  }
+
+  if(getFindPerFeature())
+  {
+    cDims[0] = 1;
+    m_FeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getFeatureIdsArrayPath(), cDims);
+    if(nullptr != m_FeatureIdsPtr.lock())
+    {
+      m_FeatureIds = m_FeatureIdsPtr.lock()->getPointer(0);
+    }
+
+    getDataContainerArray()->getPrereqAttributeMatrixFromPath(this, getCellFeatureAttributeMatrixPath(), -301);
+
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+
+    QVector<IDataArray::Pointer> dataArrays = {m_BoundaryCellsPtr.lock(), m_FeatureIdsPtr.lock()};
+    getDataContainerArray()->validateNumberOfTuples(this, dataArrays);
+
+    cDims[0] = 3;
+    path = DataArrayPath(getCellFeatureAttributeMatrixPath().getDataContainerName(), getCellFeatureAttributeMatrixPath().getAttributeMatrixName(), getProfileRoughnessArrayName());
+    m_FeatureProfileRoughnessPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, path, 0, cDims);
+    if(nullptr != m_FeatureProfileRoughnessPtr.lock())
+    {
+      m_FeatureProfileRoughness = m_FeatureProfileRoughnessPtr.lock()->getPointer(0);
+    }
+
+    path.setDataArrayName(getArealRoughnessArrayName());
+    m_FeatureArealRoughnessPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, path, 0, cDims);
+    if(nullptr != m_FeatureArealRoughnessPtr.lock())
+    {
+      m_FeatureArealRoughness = m_FeatureArealRoughnessPtr.lock()->getPointer(0);
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -122,70 +500,44 @@ void FindSurfaceRoughness::execute()
 
   ImageGeom::Pointer image = getDataContainerArray()->getDataContainer(m_BoundaryCellsArrayPath.getDataContainerName())->getGeometryAs<ImageGeom>();
   SizeVec3Type dims = image->getDimensions();
-  // FloatVec3Type res = image->getSpacing();
-  std::vector<double> xs;
-  std::vector<double> ys;
-  double coords[3] = {0.0, 0.0, 0.0};
+  FloatVec3Type spacing = image->getSpacing();
+  FloatVec3Type origin = image->getOrigin();
 
-  for(size_t z = 0; z < dims[2]; z++)
+  CellCenters cells;
+  for(size_t i = 0; i < 3; i++)
   {
-    size_t zStride = (z * dims[1] * dims[0]);
-    for(size_t y = 0; y < dims[1]; y++)
-    {
-      size_t yStride = (y * dims[0]);
-      for(size_t x = 0; x < dims[0]; x++)
-      {
-        size_t index = zStride + yStride + x;
-        if(m_BoundaryCells[index] > 0)
-        {
-          image->getCoords(index, coords);
-          xs.push_back(coords[0]);
-          ys.push_back(coords[1]);
-        }
-      }
-    }
+    cells.dims[i] = dims[i];
+    cells.spacing[i] = spacing[i];
   }
 
-  using LineParams = std::pair<double, double>;
-
-  auto linear_regression_slope = [&]() -> LineParams {
-    double xmean = std::accumulate(std::begin(xs), std::end(xs), 0.0);
-    double ymean = std::accumulate(std::begin(ys), std::end(ys), 0.0);
-    xmean /= xs.size();
-    ymean /= ys.size();
-
-    std::vector<double> xx;
-    std::transform(std::begin(xs), std::end(xs), std::begin(xs), std::back_inserter(xx), std::multiplies<double>());
-    double sumxx = std::accumulate(std::begin(xx), std::end(xx), 0.0);
-    double ssxx = sumxx - (xx.size() * xmean * xmean);
-
-    std::vector<double> xy;
-    std::transform(std::begin(xs), std::end(xs), std::begin(ys), std::back_inserter(xy), std::multiplies<double>());
-    double sumxy = std::accumulate(std::begin(xy), std::end(xy), 0.0);
-    double ssxy = sumxy - (xy.size() * xmean * ymean);
+  auto wholeImage = [](size_t) -> int64_t { return 0; };
+  RoughnessResult result = FindRoughness(cells, m_BoundaryCells, wholeImage, 1)[0];
 
-    double b = ssxy / ssxx;
-    double a = ymean - (b * xmean);
+  // Cell centers are relative to the origin, so move the line intercept back into image coordinates
+  m_RoughnessParams[0] = result.profile[0];
+  m_RoughnessParams[1] = result.lineIntercept + origin[1] - result.lineSlope * origin[0];
+  m_RoughnessParams[2] = result.lineSlope;
+  std::copy(result.profile, result.profile + 3, m_ProfileRoughness);
+  std::copy(result.areal, result.areal + 3, m_ArealRoughness);
 
-    return std::make_pair(a, b);
-  };
-
-  LineParams line = linear_regression_slope();
-  m_RoughnessParams[1] = line.first;
-  m_RoughnessParams[2] = line.second;
-
-  double distance = 0.0;
-  for(auto i = 0; i < xs.size(); i++)
+  if(m_FindPerFeature)
   {
-    double numerator = std::abs(ys[i] - (line.first + (line.second * xs[i])));
-    double denominator = std::sqrt(1 + (line.second * line.second));
-    distance += (numerator / denominator);
+    size_t numFeatures = m_FeatureProfileRoughnessPtr.lock()->getNumberOfTuples();
+    const int32_t* featureIds = m_FeatureIds;
+    auto featureOf = [featureIds, numFeatures](size_t index) -> int64_t {
+      const int32_t feature = featureIds[index];
+      return (feature > 0 && static_cast<size_t>(feature) < numFeatures) ? feature : -1;
+    };
+
+    notifyStatusMessage(QObject::tr("Finding roughness of %1 Features").arg(numFeatures - 1));
+    std::vector<RoughnessResult> results = FindRoughness(cells, m_BoundaryCells, featureOf, numFeatures);
+    for(size_t f = 0; f < numFeatures; f++)
+    {
+      std::copy(results[f].profile, results[f].profile + 3, m_FeatureProfileRoughness + 3 * f);
+      std::copy(results[f].areal, results[f].areal + 3, m_FeatureArealRoughness + 3 * f);
+    }
   }
 
-  distance /= static_cast<double>(xs.size());
-
-  m_RoughnessParams[0] = distance;
-
   notifyStatusMessage("Complete");
 }
 
@@ -325,3 +677,63 @@ QString FindSurfaceRoughness::getRoughnessParamsArrayName() const
 {
   return m_RoughnessParamsArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void FindSurfaceRoughness::setProfileRoughnessArrayName(const QString& value)
+{
+  m_ProfileRoughnessArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindSurfaceRoughness::getProfileRoughnessArrayName() const
+{
+  return m_ProfileRoughnessArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindSurfaceRoughness::setArealRoughnessArrayName(const QString& value)
+{
+  m_ArealRoughnessArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString FindSurfaceRoughness::getArealRoughnessArrayName() const
+{
+  return m_ArealRoughnessArrayName;
+}
+
+// -----------------------------------------------------------------------------
+void FindSurfaceRoughness::setFindPerFeature(bool value)
+{
+  m_FindPerFeature = value;
+}
+
+// -----------------------------------------------------------------------------
+bool FindSurfaceRoughness::getFindPerFeature() const
+{
+  return m_FindPerFeature;
+}
+
+// -----------------------------------------------------------------------------
+void FindSurfaceRoughness::setFeatureIdsArrayPath(const DataArrayPath& value)
+{
+  m_FeatureIdsArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindSurfaceRoughness::getFeatureIdsArrayPath() const
+{
+  return m_FeatureIdsArrayPath;
+}
+
+// -----------------------------------------------------------------------------
+void FindSurfaceRoughness::setCellFeatureAttributeMatrixPath(const DataArrayPath& value)
+{
+  m_CellFeatureAttributeMatrixPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath FindSurfaceRoughness::getCellFeatureAttributeMatrixPath() const
+{
+  return m_CellFeatureAttributeMatrixPath;
+}
@@ -83,6 +83,61 @@ public:
   QString getRoughnessParamsArrayName() const;
   Q_PROPERTY(QString RoughnessParamsArrayName READ getRoughnessParamsArrayName WRITE setRoughnessParamsArrayName)
 
+  /**
+   * @brief Setter property for ProfileRoughnessArrayName
+   */
+  void setProfileRoughnessArrayName(const QString& value);
+  /**
+   * @brief Getter property for ProfileRoughnessArrayName
+   * @return Value of ProfileRoughnessArrayName
+   */
+  QString getProfileRoughnessArrayName() const;
+  Q_PROPERTY(QString ProfileRoughnessArrayName READ getProfileRoughnessArrayName WRITE setProfileRoughnessArrayName)
+
+  /**
+   * @brief Setter property for ArealRoughnessArrayName
+   */
+  void setArealRoughnessArrayName(const QString& value);
+  /**
+   * @brief Getter property for ArealRoughnessArrayName
+   * @return Value of ArealRoughnessArrayName
+   */
+  QString getArealRoughnessArrayName() const;
+  Q_PROPERTY(QString ArealRoughnessArrayName READ getArealRoughnessArrayName WRITE setArealRoughnessArrayName)
+
+  /**
+   * @brief Setter property for FindPerFeature
+   */
+  void setFindPerFeature(bool value);
+  /**
+   * @brief Getter property for FindPerFeature
+   * @return Value of FindPerFeature
+   */
+  bool getFindPerFeature() const;
+  Q_PROPERTY(bool FindPerFeature READ getFindPerFeature WRITE setFindPerFeature)
+
+  /**
+   * @brief Setter property for FeatureIdsArrayPath
+   */
+  void setFeatureIdsArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for FeatureIdsArrayPath
+   * @return Value of FeatureIdsArrayPath
+   */
+  DataArrayPath getFeatureIdsArrayPath() const;
+  Q_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
+
+  /**
+   * @brief Setter property for CellFeatureAttributeMatrixPath
+   */
+  void setCellFeatureAttributeMatrixPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for CellFeatureAttributeMatrixPath
+   * @return Value of CellFeatureAttributeMatrixPath
+   */
+  DataArrayPath getCellFeatureAttributeMatrixPath() const;
+  Q_PROPERTY(DataArrayPath CellFeatureAttributeMatrixPath READ getCellFeatureAttributeMatrixPath WRITE setCellFeatureAttributeMatrixPath)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -156,10 +211,25 @@ private:
   int8_t* m_BoundaryCells = nullptr;
   std::weak_ptr<DataArray<double>> m_RoughnessParamsPtr;
   double* m_RoughnessParams = nullptr;
+  std::weak_ptr<DataArray<double>> m_ProfileRoughnessPtr;
+  double* m_ProfileRoughness = nullptr;
+  std::weak_ptr<DataArray<double>> m_ArealRoughnessPtr;
+  double* m_ArealRoughness = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_FeatureIdsPtr;
+  int32_t* m_FeatureIds = nullptr;
+  std::weak_ptr<DataArray<double>> m_FeatureProfileRoughnessPtr;
+  double* m_FeatureProfileRoughness = nullptr;
+  std::weak_ptr<DataArray<double>> m_FeatureArealRoughnessPtr;
+  double* m_FeatureArealRoughness = nullptr;
 
   DataArrayPath m_BoundaryCellsArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::BoundaryCells};
   QString m_AttributeMatrixName = {"RoughnessData"};
   QString m_RoughnessParamsArrayName = {"RougnessParameters"};
+  QString m_ProfileRoughnessArrayName = {"ProfileRoughness"};
+  QString m_ArealRoughnessArrayName = {"ArealRoughness"};
+  bool m_FindPerFeature = {false};
+  DataArrayPath m_FeatureIdsArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::FeatureIds};
+  DataArrayPath m_CellFeatureAttributeMatrixPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, ""};
 
 public:
   FindSurfaceRoughness(const FindSurfaceRoughness&) = delete;            // Copy Constructor Not Implemented
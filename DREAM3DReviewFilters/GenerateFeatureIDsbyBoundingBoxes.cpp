@@ -4,18 +4,28 @@
 
 #include "GenerateFeatureIDsbyBoundingBoxes.h"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/SIMPLRange.h"
 
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/IGeometry2D.h"
+#include "SIMPLib/Geometry/IGeometry3D.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
@@ -23,9 +33,347 @@
 namespace
 {
 constexpr int32_t k_AttributeMatrixTypeSelectionError = -5555;
+constexpr int32_t k_GeometryTypeError = -5556;
 
+/**
+ * @brief Largest number of grid cells along one axis of the box index
+ */
+constexpr int64_t k_MaxGridCellsPerAxis = 1024;
+
+/**
+ * @brief The Box struct holds the open bounds of one bounding box; a point lies in the box only if it is
+ * strictly inside along every axis
+ */
+struct Box
+{
+  float min[3] = {0.0f, 0.0f, 0.0f};
+  float max[3] = {0.0f, 0.0f, 0.0f};
+
+  bool contains(const float* point) const
+  {
+    return (point[0] < max[0]) && (point[0] > min[0]) && (point[1] < max[1]) && (point[1] > min[1]) && (point[2] < max[2]) && (point[2] > min[2]);
+  }
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief CreateBoxes Converts the box center and dimension arrays into box bounds
+ */
+std::vector<Box> CreateBoxes(const float* centers, const float* dims, size_t numBoxes)
+{
+  std::vector<Box> boxes(numBoxes);
+  for(size_t k = 0; k < numBoxes; k++)
+  {
+    for(size_t a = 0; a < 3; a++)
+    {
+      boxes[k].min[a] = centers[3 * k + a] - dims[3 * k + a] / 2.0;
+      boxes[k].max[a] = centers[3 * k + a] + dims[3 * k + a] / 2.0;
+    }
+  }
+  return boxes;
+}
+
+/**
+ * @brief The BoxGrid class is a uniform grid laid over the bounds of a set of boxes. Each grid cell lists the
+ * boxes that overlap it in increasing box order, so a point is tested only against the boxes near it and the
+ * first box found is the lowest numbered box that contains the point.
+ */
+class BoxGrid
+{
+public:
+  explicit BoxGrid(const std::vector<Box>& boxes)
+  : m_Boxes(boxes)
+  {
+    for(size_t a = 0; a < 3; a++)
+    {
+      m_Min[a] = std::numeric_limits<float>::max();
+      m_Max[a] = std::numeric_limits<float>::lowest();
+    }
+    std::array<double, 3> meanSize = {0.0, 0.0, 0.0};
+    size_t numValid = 0;
+    for(const Box& box : m_Boxes)
+    {
+      if(!isValid(box))
+      {
+        continue;
+      }
+      for(size_t a = 0; a < 3; a++)
+      {
+        m_Min[a] = std::min(m_Min[a], box.min[a]);
+        m_Max[a] = std::max(m_Max[a], box.max[a]);
+        meanSize[a] += static_cast<double>(box.max[a]) - static_cast<double>(box.min[a]);
+      }
+      numValid++;
+    }
+    if(numValid == 0)
+    {
+      return;
+    }
+
+    // Cells about the size of an average box, capped at a few cells per box overall
+    for(size_t a = 0; a < 3; a++)
+    {
+      const double extent = static_cast<double>(m_Max[a]) - static_cast<double>(m_Min[a]);
+      meanSize[a] /= static_cast<double>(numValid);
+      m_Dims[a] = 1;
+      if(extent > 0.0 && meanSize[a] > 0.0)
+      {
+        m_Dims[a] = std::clamp<int64_t>(static_cast<int64_t>(std::ceil(extent / meanSize[a])), 1, k_MaxGridCellsPerAxis);
+      }
+    }
+    const size_t maxCells = 4 * numValid + 64;
+    while(static_cast<size_t>(m_Dims[0] * m_Dims[1] * m_Dims[2]) > maxCells)
+    {
+      int64_t* largest = std::max_element(m_Dims.begin(), m_Dims.end());
+      *largest = (*largest + 1) / 2;
+    }
+    for(size_t a = 0; a < 3; a++)
+    {
+      const double extent = static_cast<double>(m_Max[a]) - static_cast<double>(m_Min[a]);
+      m_CellSize[a] = (extent > 0.0) ? extent / static_cast<double>(m_Dims[a]) : 1.0;
+    }
+
+    // Count the boxes per cell, then fill the lists in increasing box order
+    m_Offsets.assign(static_cast<size_t>(m_Dims[0] * m_Dims[1] * m_Dims[2]) + 1, 0);
+    forEachOverlappedCell([this](size_t cell, size_t) { m_Offsets[cell + 1]++; });
+    for(size_t c = 1; c < m_Offsets.size(); c++)
+    {
+      m_Offsets[c] += m_Offsets[c - 1];
+    }
+    m_Entries.resize(m_Offsets.back());
+    std::vector<size_t> fill(m_Offsets.begin(), m_Offsets.end() - 1);
+    forEachOverlappedCell([this, &fill](size_t cell, size_t k) { m_Entries[fill[cell]++] = k; });
+  }
+
+  /**
+   * @brief findBox Returns the lowest numbered box that contains the point, or -1 if no box does
+   */
+  int64_t findBox(const float* point) const
+  {
+    if(m_Entries.empty())
+    {
+      return -1;
+    }
+    size_t cell = 0;
+    size_t stride = 1;
+    for(size_t a = 0; a < 3; a++)
+    {
+      if(!(point[a] > m_Min[a] && point[a] < m_Max[a]))
+      {
+        return -1;
+      }
+      cell += static_cast<size_t>(cellIndex(point[a], a)) * stride;
+      stride *= static_cast<size_t>(m_Dims[a]);
+    }
+    for(size_t e = m_Offsets[cell]; e < m_Offsets[cell + 1]; e++)
+    {
+      if(m_Boxes[m_Entries[e]].contains(point))
+      {
+        return static_cast<int64_t>(m_Entries[e]);
+      }
+    }
+    return -1;
+  }
+
+private:
+  const std::vector<Box>& m_Boxes;
+  std::array<float, 3> m_Min = {0.0f, 0.0f, 0.0f};
+  std::array<float, 3> m_Max = {0.0f, 0.0f, 0.0f};
+  std::array<double, 3> m_CellSize = {1.0, 1.0, 1.0};
+  std::array<int64_t, 3> m_Dims = {1, 1, 1};
+  std::vector<size_t> m_Offsets;
+  std::vector<size_t> m_Entries;
+
+  static bool isValid(const Box& box)
+  {
+    for(size_t a = 0; a < 3; a++)
+    {
+      if(!(box.min[a] < box.max[a]))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  int64_t cellIndex(float value, size_t axis) const
+  {
+    const int64_t index = static_cast<int64_t>(std::floor((static_cast<double>(value) - static_cast<double>(m_Min[axis])) / m_CellSize[axis]));
+    return std::clamp<int64_t>(index, 0, m_Dims[axis] - 1);
+  }
+
+  template <typename Visitor>
+  void forEachOverlappedCell(Visitor&& visitor) const
+  {
+    for(size_t k = 0; k < m_Boxes.size(); k++)
+    {
+      const Box& box = m_Boxes[k];
+      if(!isValid(box))
+      {
+        continue;
+      }
+      std::array<int64_t, 3> lo = {0, 0, 0};
+      std::array<int64_t, 3> hi = {0, 0, 0};
+      for(size_t a = 0; a < 3; a++)
+      {
+        lo[a] = cellIndex(box.min[a], a);
+        hi[a] = cellIndex(box.max[a], a);
+      }
+      for(int64_t z = lo[2]; z <= hi[2]; z++)
+      {
+        for(int64_t y = lo[1]; y <= hi[1]; y++)
+        {
+          for(int64_t x = lo[0]; x <= hi[0]; x++)
+          {
+            visitor(static_cast<size_t>((z * m_Dims[1] + y) * m_Dims[0] + x), k);
+          }
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @brief The AssignPointsImpl class assigns each element the feature ID of the lowest numbered box containing
+ * the element's representative point, as returned by pointOf(i, point); elements outside every box are left
+ * unchanged. Runs in parallel over elements.
+ */
+template <typename PointOf>
+class AssignPointsImpl
+{
+public:
+  AssignPointsImpl(const BoxGrid& grid, PointOf pointOf, const int32_t* boxFeatureIds, int32_t* featureIds)
+  : m_Grid(grid)
+  , m_PointOf(pointOf)
+  , m_BoxFeatureIds(boxFeatureIds)
+  , m_FeatureIds(featureIds)
+  {
+  }
+
+  void assign(size_t start, size_t end) const
+  {
+    float point[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t i = start; i < end; i++)
+    {
+      m_PointOf(i, point);
+      const int64_t k = m_Grid.findBox(point);
+      if(k >= 0)
+      {
+        m_FeatureIds[i] = m_BoxFeatureIds[k];
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    assign(range.min(), range.max());
+  }
+
+private:
+  const BoxGrid& m_Grid;
+  PointOf m_PointOf;
+  const int32_t* m_BoxFeatureIds;
+  int32_t* m_FeatureIds;
+};
+
+/**
+ * @brief The CellRange struct holds the half open range of image indices a box covers along each axis
+ */
+struct CellRange
+{
+  size_t box = 0;
+  std::array<int64_t, 3> begin = {0, 0, 0};
+  std::array<int64_t, 3> end = {0, 0, 0};
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief FindCoveredRange Returns the half open range of indices i in [0, dim) whose coordinate
+ * origin + spacing * i lies strictly between min and max, evaluated with the same float expression used to
+ * place the cells
+ */
+std::pair<int64_t, int64_t> FindCoveredRange(float min, float max, float origin, float spacing, int64_t dim)
+{
+  auto coordinate = [origin, spacing](int64_t i) -> float { return origin + spacing * static_cast<float>(i); };
+  if(dim <= 0 || !(spacing > 0.0f))
+  {
+    return {0, 0};
+  }
+
+  int64_t begin = static_cast<int64_t>(std::clamp(std::floor((static_cast<double>(min) - origin) / spacing), -1.0, static_cast<double>(dim)));
+  begin = std::max<int64_t>(begin, 0);
+  while(begin > 0 && coordinate(begin - 1) > min)
+  {
+    begin--;
+  }
+  while(begin < dim && !(coordinate(begin) > min))
+  {
+    begin++;
+  }
+
+  int64_t end = static_cast<int64_t>(std::clamp(std::ceil((static_cast<double>(max) - origin) / spacing), 0.0, static_cast<double>(dim)));
+  end = std::max(end, begin);
+  while(end > begin && !(coordinate(end - 1) < max))
+  {
+    end--;
+  }
+  while(end < dim && coordinate(end) < max)
+  {
+    end++;
+  }
+  return {begin, end};
 }
 
+/**
+ * @brief The RasterizeBoxesImpl class writes box feature IDs into the covered index range of each box on an
+ * image. Boxes are written in decreasing order so the lowest numbered box containing a cell wins, and each
+ * task owns a range of Z slices, so it runs in parallel over Z.
+ */
+class RasterizeBoxesImpl
+{
+public:
+  RasterizeBoxesImpl(const std::vector<CellRange>& ranges, const int64_t* dims, const int32_t* boxFeatureIds, int32_t* featureIds)
+  : m_Ranges(ranges)
+  , m_BoxFeatureIds(boxFeatureIds)
+  , m_FeatureIds(featureIds)
+  {
+    m_Dims[0] = dims[0];
+    m_Dims[1] = dims[1];
+    m_Dims[2] = dims[2];
+  }
+
+  void rasterize(int64_t zStart, int64_t zEnd) const
+  {
+    for(auto iter = m_Ranges.rbegin(); iter != m_Ranges.rend(); ++iter)
+    {
+      const CellRange& range = *iter;
+      const int64_t z0 = std::max(zStart, range.begin[2]);
+      const int64_t z1 = std::min(zEnd, range.end[2]);
+      const int32_t featureId = m_BoxFeatureIds[range.box];
+      for(int64_t z = z0; z < z1; z++)
+      {
+        for(int64_t y = range.begin[1]; y < range.end[1]; y++)
+        {
+          int32_t* row = m_FeatureIds + (z * m_Dims[1] + y) * m_Dims[0];
+          std::fill(row + range.begin[0], row + range.end[0], featureId);
+        }
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    rasterize(static_cast<int64_t>(range.min()), static_cast<int64_t>(range.max()));
+  }
+
+private:
+  const std::vector<CellRange>& m_Ranges;
+  int64_t m_Dims[3] = {0, 0, 0};
+  const int32_t* m_BoxFeatureIds;
+  int32_t* m_FeatureIds;
+};
+} // namespace
+
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -66,7 +414,7 @@ void GenerateFeatureIDsbyBoundingBoxes::setupFilterParameters()
 {
   FilterParameterVectorType parameters;
   DataArrayCreationFilterParameter::RequirementType dacReq;
-  dacReq.amTypes = {AttributeMatrix::Type::Vertex, AttributeMatrix::Type::Cell};
+  dacReq.amTypes = {AttributeMatrix::Type::Vertex, AttributeMatrix::Type::Edge, AttributeMatrix::Type::Cell};
   parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Feature IDs", FeatureIDsArrayPath, FilterParameter::Category::CreatedArray, GenerateFeatureIDsbyBoundingBoxes, dacReq));
   AttributeMatrixCreationFilterParameter::RequirementType amcReq;
   parameters.push_back(SIMPL_NEW_AM_CREATION_FP("Feature Attribute Matrix", FeatureAttributeMatrixArrayPath, FilterParameter::Category::CreatedArray, GenerateFeatureIDsbyBoundingBoxes, amcReq));
@@ -109,18 +457,45 @@ void GenerateFeatureIDsbyBoundingBoxes::dataCheck()
   {
     m_DestAttributeMatrixType = AttributeMatrix::Type::CellFeature;
   }
-  // else if (attrMatType == AttributeMatrix::Type::Edge)
-  //{
-  //  m_DestAttributeMatrixType = AttributeMatrix::Type::EdgeFeature;
-  //}
+  else if(attrMatType == AttributeMatrix::Type::Edge)
+  {
+    m_DestAttributeMatrixType = AttributeMatrix::Type::EdgeFeature;
+  }
   else
   {
     m_DestAttributeMatrixType = AttributeMatrix::Type::Unknown;
-    QString ss = QObject::tr("The Attribute Matrix must have a cell, vertex geometry.");
+    QString ss = QObject::tr("The Attribute Matrix must be a Vertex, Edge or Cell Attribute Matrix.");
     setErrorCondition(::k_AttributeMatrixTypeSelectionError, ss);
     return;
   }
 
+  DataContainer::Pointer dc = getDataContainerArray()->getPrereqDataContainer(this, getFeatureIDsArrayPath().getDataContainerName(), false);
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+  IGeometry::Pointer geometry = dc->getGeometry();
+  bool validGeometry = false;
+  if(m_DestAttributeMatrixType == AttributeMatrix::Type::CellFeature)
+  {
+    validGeometry = (nullptr != std::dynamic_pointer_cast<ImageGeom>(geometry));
+  }
+  else if(m_DestAttributeMatrixType == AttributeMatrix::Type::EdgeFeature)
+  {
+    validGeometry = (nullptr != std::dynamic_pointer_cast<EdgeGeom>(geometry));
+  }
+  else
+  {
+    validGeometry = (nullptr != std::dynamic_pointer_cast<VertexGeom>(geometry)) || (nullptr != std::dynamic_pointer_cast<EdgeGeom>(geometry)) ||
+                    (nullptr != std::dynamic_pointer_cast<IGeometry2D>(geometry)) || (nullptr != std::dynamic_pointer_cast<IGeometry3D>(geometry));
+  }
+  if(!validGeometry)
+  {
+    QString ss = QObject::tr("A Cell Attribute Matrix requires an Image Geometry, an Edge Attribute Matrix requires an Edge Geometry and a Vertex Attribute Matrix requires a geometry with shared vertices.");
+    setErrorCondition(::k_GeometryTypeError, ss);
+    return;
+  }
+
   std::vector<size_t> cDims = {1};
   m_BoxFeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getBoxFeatureIDsArrayPath(), cDims);
   if(nullptr != m_BoxFeatureIdsPtr.lock())
@@ -141,6 +516,21 @@ void GenerateFeatureIDsbyBoundingBoxes::dataCheck()
     m_BoxDims = m_BoxDimsPtr.lock()->getPointer(0);
   }
 
+  QVector<IDataArray::Pointer> boxArrays;
+  if(nullptr != m_BoxFeatureIdsPtr.lock())
+  {
+    boxArrays.push_back(m_BoxFeatureIdsPtr.lock());
+  }
+  if(nullptr != m_BoxCenterPtr.lock())
+  {
+    boxArrays.push_back(m_BoxCenterPtr.lock());
+  }
+  if(nullptr != m_BoxDimsPtr.lock())
+  {
+    boxArrays.push_back(m_BoxDimsPtr.lock());
+  }
+  getDataContainerArray()->validateNumberOfTuples(this, boxArrays);
+
   cDims[0] = 1;
   m_FeatureIdsPtr =
       getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>>(this, getFeatureIDsArrayPath(), 0, cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
@@ -161,21 +551,12 @@ void GenerateFeatureIDsbyBoundingBoxes::dataCheck()
   m->createNonPrereqAttributeMatrix(this, getFeatureAttributeMatrixArrayPath(), tDims, m_DestAttributeMatrixType, AttributeMatrixID20);
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-bool IsPointInBounds(float xmax, float xmin, float ymax, float ymin, float zmax, float zmin, float x, float y, float z)
-{
-  return (x < xmax) && (x > xmin) && (y < ymax) && (y > ymin) && (z < zmax) && (z > zmin);
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void GenerateFeatureIDsbyBoundingBoxes::checkBoundingBoxImage()
 {
   size_t totalNumFIDs = m_BoxFeatureIdsPtr.lock()->getNumberOfTuples();
-  size_t totalNumElementsDest = m_FeatureIdsPtr.lock()->getNumberOfTuples();
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getFeatureIDsArrayPath().getDataContainerName());
   ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
   SizeVec3Type udims = image->getDimensions();
@@ -200,39 +581,33 @@ void GenerateFeatureIDsbyBoundingBoxes::checkBoundingBoxImage()
       static_cast<float>(uspacing[2]),
   };
 
-  for(size_t i = 0; i < totalNumElementsDest; i++)
-  {
-    int64_t zindex = i / (dims[0] * dims[1]);
-    int64_t tempMod = i % (dims[0] * dims[1]);
-    int64_t yindex = tempMod / (dims[0]);
-    int64_t xindex = tempMod % (dims[0]);
-
-    float currentx = origin[0] + spacing[0] * xindex;
-    float currenty = origin[1] + spacing[1] * yindex;
-    float currentz = origin[2] + spacing[2] * zindex;
-
-    bool inBounds = false;
-    size_t k = 0;
+  std::vector<Box> boxes = CreateBoxes(m_BoxCenter, m_BoxDims, totalNumFIDs);
 
-    while(!inBounds && k < totalNumFIDs)
+  // Each box only touches the cells whose coordinates fall inside it
+  std::vector<CellRange> ranges;
+  ranges.reserve(totalNumFIDs);
+  for(size_t k = 0; k < totalNumFIDs; k++)
+  {
+    CellRange range;
+    range.box = k;
+    bool empty = false;
+    for(size_t a = 0; a < 3; a++)
     {
-      float xmin = m_BoxCenter[3 * k] - m_BoxDims[3 * k] / 2.0;
-      float xmax = m_BoxCenter[3 * k] + m_BoxDims[3 * k] / 2.0;
-      float ymin = m_BoxCenter[3 * k + 1] - m_BoxDims[3 * k + 1] / 2.0;
-      float ymax = m_BoxCenter[3 * k + 1] + m_BoxDims[3 * k + 1] / 2.0;
-      float zmin = m_BoxCenter[3 * k + 2] - m_BoxDims[3 * k + 2] / 2.0;
-      float zmax = m_BoxCenter[3 * k + 2] + m_BoxDims[3 * k + 2] / 2.0;
-
-      inBounds = IsPointInBounds(xmax, xmin, ymax, ymin, zmax, zmin, currentx, currenty, currentz);
-
-      if(inBounds)
-      {
-        m_FeatureIds[i] = m_BoxFeatureIds[k];
-      }
-
-      k++;
+      std::pair<int64_t, int64_t> covered = FindCoveredRange(boxes[k].min[a], boxes[k].max[a], origin[a], spacing[a], dims[a]);
+      range.begin[a] = covered.first;
+      range.end[a] = covered.second;
+      empty = empty || (covered.first >= covered.second);
+    }
+    if(!empty)
+    {
+      ranges.push_back(range);
     }
   }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, static_cast<size_t>(dims[2]));
+  dataAlg.setGrain(1);
+  dataAlg.execute(RasterizeBoxesImpl(ranges, dims.data(), m_BoxFeatureIds, m_FeatureIds));
 }
 
 // -----------------------------------------------------------------------------
@@ -242,13 +617,28 @@ void GenerateFeatureIDsbyBoundingBoxes::checkBoundingBoxEdge()
 {
   size_t totalNumFIDs = m_BoxFeatureIdsPtr.lock()->getNumberOfTuples();
   size_t totalNumElementsDest = m_FeatureIdsPtr.lock()->getNumberOfTuples();
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getFeatureIDsArrayPath().getDataContainerName());
+  EdgeGeom::Pointer edge = dc->getGeometryAs<EdgeGeom>();
 
-  for(size_t i = 0; i < totalNumElementsDest; i++)
-  {
-    for(size_t k = 0; k < totalNumFIDs; k++)
+  const float* vertices = edge->getVertexPointer(0);
+  const MeshIndexType* edges = edge->getEdgePointer(0);
+
+  std::vector<Box> boxes = CreateBoxes(m_BoxCenter, m_BoxDims, totalNumFIDs);
+  BoxGrid grid(boxes);
+
+  // An edge belongs to the box containing its midpoint
+  auto midpointOf = [vertices, edges](size_t i, float* point) {
+    const float* p1 = vertices + 3 * edges[2 * i + 0];
+    const float* p2 = vertices + 3 * edges[2 * i + 1];
+    for(size_t a = 0; a < 3; a++)
     {
+      point[a] = 0.5f * (p1[a] + p2[a]);
     }
-  }
+  };
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, totalNumElementsDest);
+  dataAlg.execute(AssignPointsImpl<decltype(midpointOf)>(grid, midpointOf, m_BoxFeatureIds, m_FeatureIds));
 }
 
 // -----------------------------------------------------------------------------
@@ -259,36 +649,38 @@ void GenerateFeatureIDsbyBoundingBoxes::checkBoundingBoxVertex()
   size_t totalNumFIDs = m_BoxFeatureIdsPtr.lock()->getNumberOfTuples();
   size_t totalNumElementsDest = m_FeatureIdsPtr.lock()->getNumberOfTuples();
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getFeatureIDsArrayPath().getDataContainerName());
-  VertexGeom::Pointer vertex = dc->getGeometryAs<VertexGeom>();
+  IGeometry::Pointer geometry = dc->getGeometry();
 
-  float* vertices = vertex->getVertexPointer(0);
-  for(size_t i = 0; i < totalNumElementsDest; i++)
+  const float* vertices = nullptr;
+  if(VertexGeom::Pointer vertex = std::dynamic_pointer_cast<VertexGeom>(geometry))
   {
-    bool inBounds = false;
-    size_t k = 0;
-    float currentx = vertices[3 * i];
-    float currenty = vertices[3 * i + 1];
-    float currentz = vertices[3 * i + 2];
-
-    while(!inBounds && k < totalNumFIDs)
-    {
-      float xmin = m_BoxCenter[3 * k] - m_BoxDims[3 * k] / 2.0;
-      float xmax = m_BoxCenter[3 * k] + m_BoxDims[3 * k] / 2.0;
-      float ymin = m_BoxCenter[3 * k + 1] - m_BoxDims[3 * k + 1] / 2.0;
-      float ymax = m_BoxCenter[3 * k + 1] + m_BoxDims[3 * k + 1] / 2.0;
-      float zmin = m_BoxCenter[3 * k + 2] - m_BoxDims[3 * k + 2] / 2.0;
-      float zmax = m_BoxCenter[3 * k + 2] + m_BoxDims[3 * k + 2] / 2.0;
+    vertices = vertex->getVertexPointer(0);
+  }
+  else if(EdgeGeom::Pointer edge = std::dynamic_pointer_cast<EdgeGeom>(geometry))
+  {
+    vertices = edge->getVertexPointer(0);
+  }
+  else if(IGeometry2D::Pointer geometry2d = std::dynamic_pointer_cast<IGeometry2D>(geometry))
+  {
+    vertices = geometry2d->getVertexPointer(0);
+  }
+  else if(IGeometry3D::Pointer geometry3d = std::dynamic_pointer_cast<IGeometry3D>(geometry))
+  {
+    vertices = geometry3d->getVertexPointer(0);
+  }
 
-      inBounds = IsPointInBounds(xmax, xmin, ymax, ymin, zmax, zmin, currentx, currenty, currentz);
+  std::vector<Box> boxes = CreateBoxes(m_BoxCenter, m_BoxDims, totalNumFIDs);
+  BoxGrid grid(boxes);
 
-      if(inBounds)
-      {
-        m_FeatureIds[i] = m_BoxFeatureIds[k];
-      }
+  auto vertexOf = [vertices](size_t i, float* point) {
+    point[0] = vertices[3 * i + 0];
+    point[1] = vertices[3 * i + 1];
+    point[2] = vertices[3 * i + 2];
+  };
 
-      k++;
-    }
-  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, totalNumElementsDest);
+  dataAlg.execute(AssignPointsImpl<decltype(vertexOf)>(grid, vertexOf, m_BoxFeatureIds, m_FeatureIds));
 }
 
 // -----------------------------------------------------------------------------
@@ -316,10 +708,10 @@ void GenerateFeatureIDsbyBoundingBoxes::execute()
   {
     checkBoundingBoxVertex();
   }
-  // else if(m_DestAttributeMatrixType == AttributeMatrix::Type::EdgeFeature)
-  // {
-  //   checkBoundingBoxEdge();
-  // }
+  else if(m_DestAttributeMatrixType == AttributeMatrix::Type::EdgeFeature)
+  {
+    checkBoundingBoxEdge();
+  }
 }
 
 // -----------------------------------------------------------------------------
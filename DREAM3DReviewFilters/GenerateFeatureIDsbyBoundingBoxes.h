@@ -182,17 +182,17 @@ protected:
   void initialize();
 
   /**
-   * @brief Initializes all the private instance variables.
+   * @brief checkBoundingBoxImage Writes each box's feature ID into the range of image cells it covers
    */
   void checkBoundingBoxImage();
 
   /**
-   * @brief Initializes all the private instance variables.
+   * @brief checkBoundingBoxEdge Assigns each edge the feature ID of the box containing its midpoint
    */
   void checkBoundingBoxEdge();
 
   /**
-   * @brief Initializes all the private instance variables.
+   * @brief checkBoundingBoxVertex Assigns each vertex the feature ID of the box containing it
    */
   void checkBoundingBoxVertex();
 
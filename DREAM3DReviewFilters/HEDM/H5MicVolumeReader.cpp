@@ -36,7 +36,10 @@
 
 #include "H5MicVolumeReader.h"
 
+#include <algorithm>
 #include <cmath>
+#include <memory>
+#include <vector>
 
 #include <QtCore/QString>
 
@@ -46,6 +49,7 @@
 using namespace H5Support;
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/Utilities/EbsdStringUtils.hpp"
@@ -56,6 +60,212 @@ using namespace H5Support;
 using namespace H5Support_NAMESPACE;
 #endif
 
+namespace
+{
+/**
+ * @brief The MicVolumeTarget struct holds the dimensions of the volume being loaded and the arrays to fill;
+ * arrays that were not requested are nullptr
+ */
+struct MicVolumeTarget
+{
+  int64_t dims[3] = {0, 0, 0};
+  float* euler1 = nullptr;
+  float* euler2 = nullptr;
+  float* euler3 = nullptr;
+  float* x = nullptr;
+  float* y = nullptr;
+  float* conf = nullptr;
+  int* phase = nullptr;
+};
+
+/**
+ * @brief The MicSliceData struct holds the window [start, end) of one slice that falls inside the volume, as read
+ * from the file. Voxel (i, j) of the slice is placed at (i + offset[0], j + offset[1]) in z plane z of the volume.
+ */
+struct MicSliceData
+{
+  int64_t sliceDims[2] = {0, 0};
+  int64_t start[2] = {0, 0};
+  int64_t end[2] = {0, 0};
+  int64_t offset[2] = {0, 0};
+  int64_t z = 0;
+  std::vector<float> euler1;
+  std::vector<float> euler2;
+  std::vector<float> euler3;
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> conf;
+  std::vector<int> phase;
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief ReadSliceDimensions Reads the grid dimensions of a slice from its header
+ */
+herr_t ReadSliceDimensions(hid_t sliceGid, int64_t* sliceDims)
+{
+  hid_t gid = H5Gopen(sliceGid, Mic::H5Mic::Header.c_str(), H5P_DEFAULT);
+  if(gid < 0)
+  {
+    return -1;
+  }
+  int xDim = 0;
+  int yDim = 0;
+  herr_t err = H5Lite::readScalarDataset(gid, Mic::XDim, xDim);
+  if(err >= 0)
+  {
+    err = H5Lite::readScalarDataset(gid, Mic::YDim, yDim);
+  }
+  H5Gclose(gid);
+  sliceDims[0] = xDim;
+  sliceDims[1] = yDim;
+  return (err < 0 || yDim < 1) ? -1 : err;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief ReadDatasetWindow Reads the rows [start[1], end[1]) x columns [start[0], end[0]) of a slice array with a
+ * single hyperslab selection into a contiguous buffer
+ */
+template <typename T>
+herr_t ReadDatasetWindow(hid_t gid, const std::string& name, hid_t memType, const MicSliceData& slice, std::vector<T>& buffer)
+{
+  const hsize_t numColumns = static_cast<hsize_t>(slice.end[0] - slice.start[0]);
+  const hsize_t numRows = static_cast<hsize_t>(slice.end[1] - slice.start[1]);
+  buffer.resize(numColumns * numRows);
+
+  hid_t did = H5Dopen(gid, name.c_str(), H5P_DEFAULT);
+  if(did < 0)
+  {
+    return -1;
+  }
+  hid_t fileSpace = H5Dget_space(did);
+  hsize_t start[1] = {static_cast<hsize_t>(slice.start[1] * slice.sliceDims[0] + slice.start[0])};
+  hsize_t stride[1] = {static_cast<hsize_t>(slice.sliceDims[0])};
+  hsize_t count[1] = {numRows};
+  hsize_t block[1] = {numColumns};
+  herr_t err = H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, stride, count, block);
+  if(err >= 0)
+  {
+    hsize_t memDims[1] = {numColumns * numRows};
+    hid_t memSpace = H5Screate_simple(1, memDims, nullptr);
+    err = H5Dread(did, memType, memSpace, fileSpace, H5P_DEFAULT, buffer.data());
+    H5Sclose(memSpace);
+  }
+  H5Sclose(fileSpace);
+  H5Dclose(did);
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief ReadSliceWindow Reads the window of every requested array of a slice
+ */
+herr_t ReadSliceWindow(hid_t sliceGid, const MicVolumeTarget& target, MicSliceData& slice)
+{
+  if(slice.end[0] <= slice.start[0] || slice.end[1] <= slice.start[1])
+  {
+    return 0;
+  }
+  hid_t gid = H5Gopen(sliceGid, Mic::H5Mic::Data.c_str(), H5P_DEFAULT);
+  if(gid < 0)
+  {
+    return -1;
+  }
+  herr_t err = 0;
+  if(nullptr != target.euler1 && err >= 0)
+  {
+    err = ReadDatasetWindow(gid, Mic::Euler1, H5T_NATIVE_FLOAT, slice, slice.euler1);
+  }
+  if(nullptr != target.euler2 && err >= 0)
+  {
+    err = ReadDatasetWindow(gid, Mic::Euler2, H5T_NATIVE_FLOAT, slice, slice.euler2);
+  }
+  if(nullptr != target.euler3 && err >= 0)
+  {
+    err = ReadDatasetWindow(gid, Mic::Euler3, H5T_NATIVE_FLOAT, slice, slice.euler3);
+  }
+  if(nullptr != target.x && err >= 0)
+  {
+    err = ReadDatasetWindow(gid, Mic::X, H5T_NATIVE_FLOAT, slice, slice.x);
+  }
+  if(nullptr != target.y && err >= 0)
+  {
+    err = ReadDatasetWindow(gid, Mic::Y, H5T_NATIVE_FLOAT, slice, slice.y);
+  }
+  if(nullptr != target.conf && err >= 0)
+  {
+    err = ReadDatasetWindow(gid, Mic::Confidence, H5T_NATIVE_FLOAT, slice, slice.conf);
+  }
+  if(nullptr != target.phase && err >= 0)
+  {
+    err = ReadDatasetWindow(gid, Mic::Phase, H5T_NATIVE_INT, slice, slice.phase);
+  }
+  H5Gclose(gid);
+  return err;
+}
+
+/**
+ * @brief The PlaceMicSliceImpl class copies the window read from one slice into its z plane of the volume. The task
+ * is the only user of the slice data once it has been read, so it converts the phases in place.
+ */
+class PlaceMicSliceImpl
+{
+public:
+  PlaceMicSliceImpl(std::shared_ptr<MicSliceData> slice, const MicVolumeTarget& target)
+  : m_Slice(std::move(slice))
+  , m_Target(target)
+  {
+  }
+
+  template <typename T>
+  void placeArray(const std::vector<T>& source, T* destination) const
+  {
+    if(nullptr == destination || source.empty())
+    {
+      return;
+    }
+    const MicSliceData& slice = *m_Slice;
+    const size_t numColumns = static_cast<size_t>(slice.end[0] - slice.start[0]);
+    const size_t numRows = static_cast<size_t>(slice.end[1] - slice.start[1]);
+    const size_t plane = static_cast<size_t>(slice.z * m_Target.dims[0] * m_Target.dims[1]);
+    for(size_t j = 0; j < numRows; j++)
+    {
+      const size_t row = static_cast<size_t>(slice.start[1] + slice.offset[1]) + j;
+      const size_t column = static_cast<size_t>(slice.start[0] + slice.offset[0]);
+      std::copy_n(source.data() + j * numColumns, numColumns, destination + plane + row * static_cast<size_t>(m_Target.dims[0]) + column);
+    }
+  }
+
+  void operator()() const
+  {
+    placeArray(m_Slice->euler1, m_Target.euler1);
+    placeArray(m_Slice->euler2, m_Target.euler2);
+    placeArray(m_Slice->euler3, m_Target.euler3);
+    placeArray(m_Slice->x, m_Target.x);
+    placeArray(m_Slice->y, m_Target.y);
+    placeArray(m_Slice->conf, m_Target.conf);
+
+    /* For HEDM OIM Files if there is a single phase then the value of the phase
+     * data is zero (0). If there are 2 or more phases then the lowest value
+     * of phase is one (1). In the rest of the reconstruction code we follow the
+     * convention that the lowest value is One (1) even if there is only a single
+     * phase. The next loop converts all zeros to ones if there is a single
+     * phase in the OIM data.
+     */
+    for(int& phase : m_Slice->phase)
+    {
+      phase = std::max(phase, 1);
+    }
+    placeArray(m_Slice->phase, m_Target.phase);
+  }
+
+private:
+  std::shared_ptr<MicSliceData> m_Slice;
+  MicVolumeTarget m_Target;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -231,129 +441,116 @@ std::vector<MicPhase::Pointer> H5MicVolumeReader::getPhases()
   return m_Phases;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5MicVolumeReader::setSubVolumeStart(int64_t x, int64_t y, int64_t z)
+{
+  m_ReadSubVolume = true;
+  m_SubVolumeStart[0] = x;
+  m_SubVolumeStart[1] = y;
+  m_SubVolumeStart[2] = z;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5MicVolumeReader::clearSubVolume()
+{
+  m_ReadSubVolume = false;
+  m_SubVolumeStart[0] = 0;
+  m_SubVolumeStart[1] = 0;
+  m_SubVolumeStart[2] = 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 int H5MicVolumeReader::loadData(int64_t xpoints, int64_t ypoints, int64_t zpoints, uint32_t ZDir)
 {
-  int index = 0;
   int err = -1;
   // Initialize all the pointers
   initPointers(xpoints * ypoints * zpoints);
 
-  int readerIndex = 0;
-  int xpointsslice = 0;
-  int ypointsslice = 0;
-  int xpointstemp = 0;
-  int ypointstemp = 0;
-  int xstop = 0;
-  int ystop = 0;
-  int zval = 0;
+  err = readVolumeInfo();
 
-  int xstartspot = 0;
-  int ystartspot = 0;
+  // If no stacking order preference was passed, read it from the file and use that value
+  if(ZDir == SIMPL::RefFrameZDir::UnknownRefFrameZDirection)
+  {
+    ZDir = getStackingOrder();
+  }
 
-  err = readVolumeInfo();
-  for(int slice = 0; slice < zpoints; ++slice)
-  {
-    H5MicReader::Pointer reader = H5MicReader::New();
-    reader->setFileName(getFileName());
-    reader->setHDF5Path(EbsdStringUtils::number(slice + getSliceStart()));
-    reader->setUserZDir(getStackingOrder());
-    reader->setSampleTransformationAngle(getSampleTransformationAngle());
-    reader->setSampleTransformationAxis(getSampleTransformationAxis());
-    reader->setEulerTransformationAngle(getEulerTransformationAngle());
-    reader->setEulerTransformationAxis(getEulerTransformationAxis());
-    reader->readAllArrays(getReadAllArrays());
-    reader->setArraysToRead(getArraysToRead());
-    err = reader->readFile();
-    if(err < 0)
+  hid_t fileId = H5Utilities::openFile(getFileName(), true);
+  if(fileId < 0)
+  {
+    std::cout << "H5MicDataLoader Error: Could not open .h5ebsd file for reading." << std::endl;
+    return -1;
+  }
+
+  MicVolumeTarget target;
+  target.dims[0] = xpoints;
+  target.dims[1] = ypoints;
+  target.dims[2] = zpoints;
+  target.euler1 = m_Euler1;
+  target.euler2 = m_Euler2;
+  target.euler3 = m_Euler3;
+  target.x = m_X;
+  target.y = m_Y;
+  target.conf = m_Conf;
+  target.phase = m_Phase;
+
+  // Slices are read one at a time on this thread, as HDF5 requires, while the slices already read are placed
+  // into the volume by parallel tasks. Each task writes a different z plane.
+  ParallelTaskAlgorithm taskRunner;
+  taskRunner.setParallelizationEnabled(true);
+
+  const int64_t zOffset = m_ReadSubVolume ? m_SubVolumeStart[2] : 0;
+  for(int64_t slice = 0; slice < zpoints; ++slice)
+  {
+    std::string sliceName = EbsdStringUtils::number(slice + zOffset + getSliceStart());
+    hid_t gid = H5Gopen(fileId, sliceName.c_str(), H5P_DEFAULT);
+    if(gid < 0)
     {
       std::cout << "H5MicDataLoader Error: There was an issue loading the data from the hdf5 file." << std::endl;
-      return -1;
-    }
-    readerIndex = 0;
-    xpointsslice = reader->getXDimension();
-    ypointsslice = reader->getYDimension();
-    float* euler1Ptr = reader->getEuler1Pointer();
-    float* euler2Ptr = reader->getEuler2Pointer();
-    float* euler3Ptr = reader->getEuler3Pointer();
-    float* xPtr = reader->getXPointer();
-    float* yPtr = reader->getYPointer();
-    float* confPtr = reader->getConfidencePointer();
-    int* phasePtr = reader->getPhasePointer();
-
-    xpointstemp = static_cast<int>(xpoints);
-    ypointstemp = static_cast<int>(ypoints);
-    xstartspot = (xpointstemp - xpointsslice) / 2;
-    ystartspot = (ypointstemp - ypointsslice) / 2;
-    xstop = xpointsslice;
-    ystop = ypointsslice;
-
-    // If no stacking order preference was passed, read it from the file and use that value
-    if(ZDir == SIMPL::RefFrameZDir::UnknownRefFrameZDirection)
-    {
-      ZDir = getStackingOrder();
+      err = -1;
+      break;
     }
-    if(ZDir == SIMPL::RefFrameZDir::LowtoHigh)
+
+    auto sliceData = std::make_shared<MicSliceData>();
+    if(ZDir == SIMPL::RefFrameZDir::HightoLow)
     {
-      zval = slice;
+      sliceData->z = (zpoints - 1) - slice;
     }
-    if(ZDir == SIMPL::RefFrameZDir::HightoLow)
+    else
     {
-      zval = static_cast<int>((zpoints - 1) - slice);
+      sliceData->z = slice;
     }
 
-    // Copy the data from the current storage into the ReconstructionFunc Storage Location
-    for(int j = 0; j < ystop; j++)
+    err = ReadSliceDimensions(gid, sliceData->sliceDims);
+    if(err >= 0)
     {
-      for(int i = 0; i < xstop; i++)
+      // Whole slices are centered in the volume; a sub-volume starts at the requested voxel of each slice
+      for(size_t d = 0; d < 2; d++)
       {
-        index = (zval * xpointstemp * ypointstemp) + ((j + ystartspot) * xpointstemp) + (i + xstartspot);
-        if(nullptr != euler1Ptr)
-        {
-          m_Euler1[index] = euler1Ptr[readerIndex];
-        }
-        if(nullptr != euler2Ptr)
-        {
-          m_Euler2[index] = euler2Ptr[readerIndex];
-        }
-        if(nullptr != euler3Ptr)
-        {
-          m_Euler3[index] = euler3Ptr[readerIndex];
-        }
-        if(nullptr != xPtr)
-        {
-          m_X[index] = xPtr[readerIndex];
-        }
-        if(nullptr != yPtr)
-        {
-          m_Y[index] = yPtr[readerIndex];
-        }
-        if(nullptr != confPtr)
-        {
-          m_Conf[index] = confPtr[readerIndex];
-        }
-        if(nullptr != phasePtr)
-        {
-          m_Phase[index] = phasePtr[readerIndex];
-        } // Phase
-
-        /* For HEDM OIM Files if there is a single phase then the value of the phase
-         * data is zero (0). If there are 2 or more phases then the lowest value
-         * of phase is one (1). In the rest of the reconstruction code we follow the
-         * convention that the lowest value is One (1) even if there is only a single
-         * phase. The next if statement converts all zeros to ones if there is a single
-         * phase in the OIM data.
-         */
-        if(nullptr != phasePtr && m_Phase[index] < 1)
-        {
-          m_Phase[index] = 1;
-        }
-
-        ++readerIndex;
+        const int64_t offset = m_ReadSubVolume ? -m_SubVolumeStart[d] : (target.dims[d] - sliceData->sliceDims[d]) / 2;
+        sliceData->start[d] = std::max<int64_t>(0, -offset);
+        sliceData->end[d] = std::min<int64_t>(sliceData->sliceDims[d], target.dims[d] - offset);
+        sliceData->offset[d] = offset;
       }
+      err = ReadSliceWindow(gid, target, *sliceData);
     }
+    H5Gclose(gid);
+    if(err < 0)
+    {
+      std::cout << "H5MicDataLoader Error: There was an issue loading the data from the hdf5 file." << std::endl;
+      err = -1;
+      break;
+    }
+
+    taskRunner.execute(PlaceMicSliceImpl(sliceData, target));
   }
+  taskRunner.wait();
+
+  H5Utilities::closeFile(fileId);
   return err;
 }
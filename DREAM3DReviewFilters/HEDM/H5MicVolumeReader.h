@@ -82,6 +82,21 @@ public:
    */
   int loadData(int64_t xpoints, int64_t ypoints, int64_t zpoints, uint32_t ZDir) override;
 
+  /**
+   * @brief Makes loadData() read the xpoints x ypoints x zpoints sub-volume whose first voxel is (x, y) of the
+   * slice grids in slice z, counted from the first slice, instead of centering whole slices in the volume.
+   * Only the selected part of each slice is read from the file.
+   * @param x First voxel along X
+   * @param y First voxel along Y
+   * @param z First slice
+   */
+  void setSubVolumeStart(int64_t x, int64_t y, int64_t z);
+
+  /**
+   * @brief Makes loadData() read whole slices again
+   */
+  void clearSubVolume();
+
   /**
    * @brief
    * @return
@@ -114,6 +129,8 @@ protected:
 
 private:
   std::vector<MicPhase::Pointer> m_Phases;
+  bool m_ReadSubVolume = false;
+  int64_t m_SubVolumeStart[3] = {0, 0, 0};
 
   /**
    * @brief Allocats a contiguous chunk of memory to store values from the .Mic file
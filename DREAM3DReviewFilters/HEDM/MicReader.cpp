@@ -36,15 +36,26 @@
 #include "MicReader.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/Core/EbsdMacros.h"
 #include "EbsdLib/Math/EbsdLibMath.h"
 #include "EbsdLib/Utilities/EbsdStringUtils.hpp"
 
+#include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/util/TextParsing.hpp"
+
 #include "MicConstants.h"
 
 #ifdef _MSC_VER
@@ -56,6 +67,176 @@
 #endif
 #endif
 
+namespace
+{
+/**
+ * @brief Number of columns in a data row of a .mic file
+ */
+constexpr int32_t k_NumMicColumns = 19;
+
+/**
+ * @brief The MicRow struct holds the columns of one data row of a .mic file that are used to build the grid
+ */
+struct MicRow
+{
+  float x = -1.0f;
+  float y = -1.0f;
+  int32_t up = 0;
+  int32_t phase = 0;
+  float euler[3] = {0.0f, 0.0f, 0.0f};
+  float conf = -1.0f;
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief ParseMicRow Parses the data row starting at p. The columns are
+ * x y z up level good phi1 phi phi2 confidence followed by 3 float and 6 integer columns that are not used.
+ * Columns after the first one that fails to parse keep their default values.
+ * @return The number of columns read
+ */
+int32_t ParseMicRow(const char* p, const char* end, MicRow& row, int32_t& level)
+{
+  int32_t numRead = 0;
+  auto readFloat = [&](float& value) {
+    if(nullptr != p && nullptr != (p = TextParsing::ParseFloat(p, end, value)))
+    {
+      ++numRead;
+    }
+  };
+  auto readInt = [&](int64_t& value) {
+    if(nullptr != p && nullptr != (p = TextParsing::ParseInt(p, end, value)))
+    {
+      ++numRead;
+    }
+  };
+
+  float z = 0.0f;
+  int64_t up = 0;
+  int64_t rowLevel = 0;
+  int64_t good = 0;
+  readFloat(row.x);
+  readFloat(row.y);
+  readFloat(z);
+  readInt(up);
+  readInt(rowLevel);
+  readInt(good);
+  readFloat(row.euler[0]);
+  readFloat(row.euler[1]);
+  readFloat(row.euler[2]);
+  readFloat(row.conf);
+
+  // Count the remaining columns
+  while(nullptr != p && numRead < k_NumMicColumns)
+  {
+    const char* next = TextParsing::SkipToken(p, end);
+    if(next == TextParsing::SkipBlanks(p, end))
+    {
+      break;
+    }
+    p = next;
+    ++numRead;
+  }
+
+  row.up = static_cast<int32_t>(up);
+  row.phase = (good > 0) ? 1 : 0;
+  level = static_cast<int32_t>(rowLevel);
+  return numRead;
+}
+
+/**
+ * @brief The TriangleGrid struct describes the square grid the triangles of a .mic file are rasterized onto
+ */
+struct TriangleGrid
+{
+  float xMin = 0.0f;
+  float yMin = 0.0f;
+  float edgeLength = 1.0f;
+  int xDim = 0;
+  int yDim = 0;
+};
+
+/**
+ * @brief The ClaimGridPointsImpl class visits the grid points covered by a range of triangles and records, for
+ * every point, the highest index of a triangle covering it
+ */
+class ClaimGridPointsImpl
+{
+public:
+  ClaimGridPointsImpl(const std::vector<MicRow>& rows, const TriangleGrid& grid, std::vector<std::atomic<int32_t>>& owners)
+  : m_Rows(rows)
+  , m_Grid(grid)
+  , m_Owners(owners)
+  {
+  }
+
+  void claim(size_t start, size_t end) const
+  {
+    const float edgeLength = m_Grid.edgeLength;
+    const float root3over2 = sqrtf(3.0f) / 2.0f;
+    for(size_t i = start; i < end; i++)
+    {
+      const MicRow& row = m_Rows[i];
+      if(row.up != 1 && row.up != 2)
+      {
+        continue;
+      }
+      const float xA = row.x - m_Grid.xMin;
+      const float xB = xA + edgeLength;
+      const float xC = xA + (edgeLength / 2.0f);
+      float yA = 0.0f;
+      float yB = 0.0f;
+      float yC = 0.0f;
+      if(row.up == 1)
+      {
+        yA = row.y - m_Grid.yMin;
+        yB = yA;
+        yC = yA + (root3over2 * edgeLength);
+      }
+      else
+      {
+        yB = row.y - m_Grid.yMin;
+        yC = yB;
+        yA = yB - (root3over2 * edgeLength);
+      }
+
+      const int jMin = std::max(int(xA / edgeLength), 0);
+      const int jMax = std::min(int(xB / edgeLength) + 1, m_Grid.xDim);
+      const int kMin = std::max(int(yA / edgeLength), 0);
+      const int kMax = std::min(int(yC / edgeLength) + 1, m_Grid.yDim);
+      for(int j = jMin; j < jMax; j++)
+      {
+        for(int k = kMin; k < kMax; k++)
+        {
+          const float x = float(j) * edgeLength;
+          const float y = float(k) * edgeLength;
+          const int check1 = static_cast<int>((x - xB) * (yA - yB) - (xA - xB) * (y - yB));
+          const int check2 = static_cast<int>((x - xC) * (yB - yC) - (xB - xC) * (y - yC));
+          const int check3 = static_cast<int>((x - xA) * (yC - yA) - (xC - xA) * (y - yA));
+          if((check1 <= 0 && check2 <= 0 && check3 <= 0) || (check1 >= 0 && check2 >= 0 && check3 >= 0))
+          {
+            std::atomic<int32_t>& owner = m_Owners[static_cast<size_t>(k) * static_cast<size_t>(m_Grid.xDim) + static_cast<size_t>(j)];
+            int32_t current = owner.load(std::memory_order_relaxed);
+            while(current < static_cast<int32_t>(i) && !owner.compare_exchange_weak(current, static_cast<int32_t>(i), std::memory_order_relaxed))
+            {
+            }
+          }
+        }
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    claim(range.min(), range.max());
+  }
+
+private:
+  const std::vector<MicRow>& m_Rows;
+  const TriangleGrid& m_Grid;
+  std::vector<std::atomic<int32_t>>& m_Owners;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -431,8 +612,8 @@ int MicReader::readFile()
 // -----------------------------------------------------------------------------
 int MicReader::readMicFile()
 {
-  std::ifstream in(getFileName(), std::ios_base::in);
-  if(!in.is_open())
+  QFile file(QString::fromStdString(getFileName()));
+  if(!file.open(QIODevice::ReadOnly))
   {
     std::stringstream msg;
     msg << "Mic file could not be opened: " << getFileName();
@@ -441,103 +622,98 @@ int MicReader::readMicFile()
     return -113;
   }
 
+  // Map the file into memory (or read it into a single buffer when mapping is not possible) and parse it in place
+  QByteArray buffer;
+  const char* begin = nullptr;
+  const char* end = nullptr;
+  const qint64 fileSize = file.size();
+  uchar* mapped = (fileSize > 0) ? file.map(0, fileSize) : nullptr;
+  if(nullptr != mapped)
+  {
+    begin = reinterpret_cast<const char*>(mapped);
+    end = begin + fileSize;
+  }
+  else
+  {
+    buffer = file.readAll();
+    begin = buffer.constData();
+    end = begin + buffer.size();
+  }
+
   // Delete any currently existing pointers
   deletePointers();
-  // Initialize new pointers
-  size_t totalDataRows = 0;
+
+  // The first line in the file is the edge length
+  float origEdgeLength = 0.0f;
+  if(nullptr == TextParsing::ParseFloat(begin, end, origEdgeLength))
+  {
+    std::stringstream msg;
+    msg << "Mic file edge length could not be read: " << getFileName();
+    setErrorMessage(msg.str());
+    setErrorCode(-114);
+    return -114;
+  }
+
+  // Parse the data rows in a single pass, tracking the bounds of the triangle centers as we go. The level of
+  // the first row bounds the number of rows the file can hold.
+  std::vector<MicRow> rows;
+  int level = 0;
+  float newEdgeLength = origEdgeLength;
   size_t totalPossibleDataRows = 0;
-  //  size_t featuresRead = 0;
-  float origEdgeLength;
+  float constant = static_cast<float>(1.0f / (2.0 * sqrt(3.0)));
   float xMax = 0.0F;
   float yMax = 0.0F;
   float xMin = 1000000000.0F;
   float yMin = 1000000000.0F;
-  float xMinUM = 0.0F;
-  float yMinUM = 0.0F;
-  int32_t counter = 0;
-  std::string buf;
-
-  // Read the First line in the file which is the edge length
-  std::getline(in, buf);
-  origEdgeLength = std::stof(buf);
-
-  // Read the first line of actual data which we then derive the actual number of data rows
-  std::getline(in, buf);
-  parseDataLine(buf, 0);
-
-  int level = m_Level[0];
-  float newEdgeLength = origEdgeLength / powf(2.0, float(level));
-  totalPossibleDataRows = static_cast<size_t>(6.0f * powf(4.0f, float(level)));
-
-  // Reinitialize the pointers that hold the data to the proper size
-  initPointers(totalPossibleDataRows);
-
-  // Reparse the first data line to get those values into the new arrays
-  parseDataLine(buf, 0);
-
-  std::getline(in, buf);
-  ++counter;
-  for(size_t i = 1; i < totalPossibleDataRows; ++i)
+  for(const char* line = TextParsing::SkipLine(begin, end); line < end; line = TextParsing::SkipLine(line, end))
   {
-    parseDataLine(buf, i);
-    std::getline(in, buf);
-
-    ++counter;
-    if(in.eof())
+    const char* p = TextParsing::SkipBlanks(line, end);
+    if(p >= end || *p == '\n')
     {
-      break;
+      continue;
     }
-  }
-  totalDataRows = counter;
 
-  std::vector<float> EA1(totalDataRows, 0.0);
-  std::vector<float> EA2(totalDataRows, 0.0);
-  std::vector<float> EA3(totalDataRows, 0.0);
-  std::vector<float> confidence(totalDataRows, 0.0);
-  std::vector<int> phase(totalDataRows, 0);
-  std::vector<int> up(totalDataRows, 0);
-  std::vector<float> xVal(totalDataRows, 0.0);
-  std::vector<float> yVal(totalDataRows, 0.0);
-  float constant = static_cast<float>(1.0f / (2.0 * sqrt(3.0)));
-  float x;
-  float y;
-  for(size_t i = 0; i < totalDataRows; ++i)
-  {
-    if(m_Up[i] == 1)
-    {
-      x = m_X[i] + (newEdgeLength / 2.0f);
-      y = m_Y[i] + (constant * newEdgeLength);
-    }
-    if(m_Up[i] == 2)
+    MicRow row;
+    int32_t rowLevel = 0;
+    if(ParseMicRow(p, end, row, rowLevel) != k_NumMicColumns)
     {
-      x = m_X[i] + (newEdgeLength / 2.0f);
-      y = m_Y[i] - (constant * newEdgeLength);
+      std::cout << "MicReader Error: Not enough columns were read for row " << rows.size();
     }
-    if(x > xMax)
-    {
-      xMax = x;
-    }
-    if(y > yMax)
+
+    if(rows.empty())
     {
-      yMax = y;
+      level = rowLevel;
+      newEdgeLength = origEdgeLength / powf(2.0, float(level));
+      totalPossibleDataRows = static_cast<size_t>(6.0f * powf(4.0f, float(level)));
+      rows.reserve(std::min(totalPossibleDataRows, static_cast<size_t>(end - line) / 64 + 1));
     }
-    if(x < xMin)
+
+    if(row.up == 1 || row.up == 2)
     {
-      xMin = x;
+      float x = row.x + (newEdgeLength / 2.0f);
+      float y = (row.up == 1) ? row.y + (constant * newEdgeLength) : row.y - (constant * newEdgeLength);
+      xMax = std::max(xMax, x);
+      yMax = std::max(yMax, y);
+      xMin = std::min(xMin, x);
+      yMin = std::min(yMin, y);
     }
-    if(y < yMin)
+
+    rows.push_back(row);
+    if(rows.size() >= totalPossibleDataRows)
     {
-      yMin = y;
+      break;
     }
-    EA1[i] = m_Euler1[i];
-    EA2[i] = m_Euler2[i];
-    EA3[i] = m_Euler3[i];
-    confidence[i] = m_Conf[i];
-    phase[i] = m_Phase[i];
-    up[i] = m_Up[i];
-    xVal[i] = m_X[i];
-    yVal[i] = m_Y[i];
   }
+
+  if(rows.empty())
+  {
+    std::stringstream msg;
+    msg << "Mic file does not contain any data rows: " << getFileName();
+    setErrorMessage(msg.str());
+    setErrorCode(-115);
+    return -115;
+  }
+
   xMin = xMin - (2.0 * newEdgeLength);
   xMax = xMax + (2.0 * newEdgeLength);
   yMin = yMin - (2.0 * newEdgeLength);
@@ -546,8 +722,6 @@ int MicReader::readMicFile()
   yDim = int((yMax - yMin) / newEdgeLength) + 1;
   xRes = newEdgeLength * 1000.0f;
   yRes = newEdgeLength * 1000.0f;
-  xMinUM = xMin * 1000.0f;
-  yMinUM = xMin * 1000.0f;
 
   EbsdHeaderEntry::Pointer xDimHeader = MicHeaderEntry<int>::NewEbsdHeaderEntry(Mic::XDim, xDim);
   m_HeaderMap[Mic::XDim] = xDimHeader;
@@ -561,62 +735,60 @@ int MicReader::readMicFile()
   EbsdHeaderEntry::Pointer yResHeader = MicHeaderEntry<float>::NewEbsdHeaderEntry(Mic::YRes, yRes);
   m_HeaderMap[Mic::YRes] = yResHeader;
 
-  // Delete any currently existing pointers
-  deletePointers();
-  // Resize pointers
-  initPointers(xDim * yDim);
-
-  float xA = 0.0f;
-  float xB = 0.0f;
-  float xC = 0.0f;
-  float yA = 0.0f;
-  float yB = 0.0f;
-  float yC = 0.0f;
-  int point = 0;
-  float root3over2 = sqrtf(3.0f) / 2.0f;
-  int check1 = 0;
-  int check2 = 0;
-  int check3 = 0;
-  for(size_t i = 0; i < totalDataRows; ++i)
-  {
-    xA = xVal[i] - xMin;
-    xB = xA + newEdgeLength;
-    xC = xA + (newEdgeLength / 2.0f);
-    if(up[i] == 1)
-    {
-      yA = yVal[i] - yMin;
-      yB = yA;
-      yC = yA + (root3over2 * newEdgeLength);
-    }
-    if(up[i] == 2)
-    {
-      yB = yVal[i] - yMin;
-      yC = yB;
-      yA = yB - (root3over2 * newEdgeLength);
-    }
-    for(int j = int(xA / newEdgeLength); j < int(xB / newEdgeLength) + 1; j++)
+  // Size the pointers to the square grid
+  initPointers(static_cast<size_t>(xDim) * static_cast<size_t>(yDim));
+
+  // Rasterize the triangles onto the grid. Where triangles overlap, the one read last wins, so each grid point
+  // first claims the highest row that covers it and is then filled from that row.
+  TriangleGrid grid;
+  grid.xMin = xMin;
+  grid.yMin = yMin;
+  grid.edgeLength = newEdgeLength;
+  grid.xDim = xDim;
+  grid.yDim = yDim;
+  std::vector<std::atomic<int32_t>> owners(static_cast<size_t>(xDim) * static_cast<size_t>(yDim));
+  for(std::atomic<int32_t>& owner : owners)
+  {
+    owner.store(-1, std::memory_order_relaxed);
+  }
+
+  ParallelDataAlgorithm claimAlg;
+  claimAlg.setRange(0, rows.size());
+  claimAlg.execute(ClaimGridPointsImpl(rows, grid, owners));
+
+  float* euler1 = m_Euler1;
+  float* euler2 = m_Euler2;
+  float* euler3 = m_Euler3;
+  float* conf = m_Conf;
+  int* phase = m_Phase;
+  float* xPos = m_X;
+  float* yPos = m_Y;
+  const size_t xPoints = static_cast<size_t>(xDim);
+  const float xMinUM = xMin * 1000.0f;
+  const float yMinUM = xMin * 1000.0f;
+  const float xStep = xRes;
+  const float yStep = yRes;
+
+  ParallelDataAlgorithm fillAlg;
+  fillAlg.setRange(0, owners.size());
+  fillAlg.execute([&](const SIMPLRange& range) {
+    for(size_t point = range.min(); point < range.max(); point++)
     {
-      for(int k = int(yA / newEdgeLength); k < int(yC / newEdgeLength) + 1; k++)
+      const int32_t owner = owners[point].load(std::memory_order_relaxed);
+      if(owner < 0)
       {
-        x = float(j) * newEdgeLength;
-        y = float(k) * newEdgeLength;
-        check1 = static_cast<int>((x - xB) * (yA - yB) - (xA - xB) * (y - yB));
-        check2 = static_cast<int>((x - xC) * (yB - yC) - (xB - xC) * (y - yC));
-        check3 = static_cast<int>((x - xA) * (yC - yA) - (xC - xA) * (y - yA));
-        if((check1 <= 0 && check2 <= 0 && check3 <= 0) || (check1 >= 0 && check2 >= 0 && check3 >= 0))
-        {
-          point = (k * xDim) + j;
-          m_Euler1[point] = EA1[i];
-          m_Euler2[point] = EA2[i];
-          m_Euler3[point] = EA3[i];
-          m_Conf[point] = confidence[i];
-          m_Phase[point] = phase[i];
-          m_X[point] = float(j) * xRes + xMinUM;
-          m_Y[point] = float(k) * yRes + yMinUM;
-        }
+        continue;
       }
+      const MicRow& row = rows[owner];
+      euler1[point] = row.euler[0];
+      euler2[point] = row.euler[1];
+      euler3[point] = row.euler[2];
+      conf[point] = row.conf;
+      phase[point] = row.phase;
+      xPos[point] = float(point % xPoints) * xStep + xMinUM;
+      yPos[point] = float(point / xPoints) * yStep + yMinUM;
     }
-  }
+  });
 
   return 0;
 }
@@ -667,76 +839,6 @@ void MicReader::parseHeaderLine(std::string& line)
 #endif
 }
 
-// -----------------------------------------------------------------------------
-//  Read the data part of the Mic file
-// -----------------------------------------------------------------------------
-void MicReader::parseDataLine(std::string& line, size_t i)
-{
-  /* When reading the data there should be at least 8 cols of data. There may even
-   * be 10 columns of data. The column names should be the following:
-   * phi1
-   * phi
-   * phi2
-   * x pos
-   * y pos
-   * image quality
-   * confidence index
-   * phase
-   * SEM Signal
-   * Fit of Solution
-   *
-   * Some HEDM Mic files do NOT have all 10 columns. Assume these are lacking the last
-   * 2 columns and all the other columns are the same as above.
-   */
-  float p1 = 0.0f;
-  float p = 0.0f;
-  float p2 = 0.0f;
-  float x = -1.0f;
-  float y = -1.0f;
-  float z = -1.0f;
-  float conf = -1.0f;
-  float junk1;
-  float junk2;
-  float junk3;
-  int up = 0;
-  int level = 0;
-  int good = 0;
-  int junk4;
-  int junk5;
-  int junk6;
-  int junk7;
-  int junk8;
-  int junk9;
-  size_t offset = 0;
-  size_t featuresRead = 0;
-  featuresRead = sscanf(line.data(), "%f %f %f %d %d %d %f %f %f %f %f %f %f %d %d %d %d %d %d", &x, &y, &z, &up, &level, &good, &p1, &p, &p2, &conf, &junk1, &junk2, &junk3, &junk4, &junk5, &junk6,
-                        &junk7, &junk8, &junk9);
-  if(featuresRead != 19)
-  {
-    std::cout << "MicReader Error: Not enough columns were read for row " << i;
-  }
-  offset = i;
-
-  if(good > 0)
-  {
-    good = 1;
-  }
-  else
-  {
-    good = 0;
-  }
-
-  m_Euler1[offset] = p1;
-  m_Euler2[offset] = p;
-  m_Euler3[offset] = p2;
-  m_Conf[offset] = conf;
-  m_Phase[offset] = good;
-  m_Level[offset] = level;
-  m_Up[offset] = up;
-  m_X[offset] = x;
-  m_Y[offset] = y;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
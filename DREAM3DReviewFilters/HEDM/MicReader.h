@@ -197,11 +197,6 @@ private:
    */
   void parseHeaderLine(std::string& line);
 
-  /** @brief Parses the data from a line of data from the HEDM .Mic file
-   * @param line The line of data to parse
-   */
-  void parseDataLine(std::string& line, size_t i);
-
   /**
    * @brief initPointers
    * @param numElements
@@ -13,19 +13,13 @@
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
-#include "SIMPLib/Utilities/StringOperations.h"
-
-#include "H5Support/H5ScopedSentinel.h"
-#include "H5Support/H5Utilities.h"
-#include "H5Support/QH5Lite.h"
-#include "H5Support/QH5Utilities.h"
-
-using namespace H5Support;
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/MASSIFStepReader.h"
 
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
@@ -34,30 +28,6 @@ enum createdPathID : RenameDataPath::DataID_t
   AttributeMatrixID21 = 21,
 };
 
-namespace Detail
-{
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename T>
-IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const std::vector<size_t>& tDims, const std::vector<size_t>& cDims)
-{
-  herr_t err = -1;
-  IDataArray::Pointer ptr;
-
-  ptr = DataArray<T>::CreateArray(tDims, cDims, datasetPath, true);
-
-  T* data = (T*)(ptr->getVoidPointer(0));
-  err = QH5Lite::readPointerDataset(locId, datasetPath, data);
-  if(err < 0)
-  {
-    qDebug() << "readH5Data read error: " << __FILE__ << "(" << __LINE__ << ")";
-    ptr = IDataArray::NullPointer();
-  }
-  return ptr;
-}
-} // namespace Detail
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -100,6 +70,13 @@ void ImportMASSIFData::setupFilterParameters()
     parameters.push_back(SIMPL_NEW_INTEGER_FP("Step Value", StepNumber, FilterParameter::Category::Parameter, ImportMASSIFData));
   }
 
+  {
+    std::vector<QString> linkedProps = {"EndStepNumber", "StepIncrement"};
+    parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Import Range of Steps", ImportStepRange, FilterParameter::Category::Parameter, ImportMASSIFData, linkedProps));
+    parameters.push_back(SIMPL_NEW_INTEGER_FP("End Step Value", EndStepNumber, FilterParameter::Category::Parameter, ImportMASSIFData));
+    parameters.push_back(SIMPL_NEW_INTEGER_FP("Step Increment", StepIncrement, FilterParameter::Category::Parameter, ImportMASSIFData));
+  }
+
   setFilterParameters(parameters);
 }
 
@@ -140,134 +117,122 @@ void ImportMASSIFData::dataCheck()
     setWarningCondition(-3004, ss);
   }
 
-  // Get the geometry info of the arrays
-  std::vector<size_t> geoDims;
-  FloatVec3Type origin;
-  FloatVec3Type res;
-  getDataContainerGeometry(geoDims, origin, res);
-  if(getErrorCode() < 0)
+  if(m_ImportStepRange)
   {
-    return;
-  }
-  if(geoDims.size() != 3)
-  {
-    QString ss = tr("The dimensions are not of size 3");
-    setErrorCondition(-3003, ss);
-    return;
-  }
-  if(origin.size() != 3)
-  {
-    QString ss = tr("The origin is not of size 3");
-    setErrorCondition(-3003, ss);
-    return;
+    if(m_EndStepNumber < m_StepNumber || m_EndStepNumber > MASSIFUtilitiesConstants::ImportMassifData::MaxStepNumber)
+    {
+      QString ss = tr("The end step number (%1) must be between the start step number (%2) and %3.").arg(m_EndStepNumber).arg(m_StepNumber).arg(MASSIFUtilitiesConstants::ImportMassifData::MaxStepNumber);
+      setErrorCondition(-3011, ss);
+      return;
+    }
+    if(m_StepIncrement < 1)
+    {
+      QString ss = tr("The step increment must be at least 1.");
+      setErrorCondition(-3012, ss);
+      return;
+    }
   }
-  if(res.size() != 3)
+
+  // The file stays open for the whole import and the geometry is only read once, from the first step
+  MASSIFStepReader reader(m_MassifInputFilePath, m_FilePrefix);
+  if(reader.open() < 0)
   {
-    QString ss = tr("The resolution does not have a size of 3");
-    setErrorCondition(-3003, ss);
+    setErrorCondition(-3005, reader.getErrorMessage());
     return;
   }
 
-  DataContainer::Pointer dc = getDataContainerArray()->createNonPrereqDataContainer(this, MASSIFUtilitiesConstants::ImportMassifData::MassifDC);
-  ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
-  image->setSpacing(FloatVec3Type(res[0], res[1], res[2]));
-  image->setOrigin(FloatVec3Type(origin[0], origin[1], origin[2]));
-  image->setDimensions(SizeVec3Type(geoDims[0], geoDims[1], geoDims[2]));
-  dc->setGeometry(image);
+  std::vector<int32_t> steps = findStepsToImport(reader);
   if(getErrorCode() < 0)
   {
     return;
   }
 
-  int err = 0;
-  AttributeMatrix::Pointer am = dc->createNonPrereqAttributeMatrix(this, MASSIFUtilitiesConstants::ImportMassifData::MassifAM, geoDims, AttributeMatrix::Type::Cell, AttributeMatrixID21);
-  if(getErrorCode() < 0 || err < 0)
+  SizeVec3Type geoDims = {0, 0, 0};
+  FloatVec3Type origin = {0.0f, 0.0f, 0.0f};
+  FloatVec3Type res = {0.0f, 0.0f, 0.0f};
+  int32_t err = reader.readGeometry(steps.front(), geoDims, origin, res);
+  if(err < 0)
   {
+    setErrorCondition(err, reader.getErrorMessage());
     return;
   }
 
-  hid_t fileId = H5Utilities::openFile(m_MassifInputFilePath.toStdString(), true);
-  if(fileId < 0)
+  DataContainer::Pointer dc = getDataContainerArray()->createNonPrereqDataContainer(this, MASSIFUtilitiesConstants::ImportMassifData::MassifDC);
+  if(getErrorCode() < 0)
   {
-    QString ss = tr("Error Reading HDF5 file: %1\n").arg(m_MassifInputFilePath);
-    setErrorCondition(-3003, ss);
     return;
   }
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  image->setSpacing(res);
+  image->setOrigin(origin);
+  image->setDimensions(geoDims);
+  dc->setGeometry(image);
 
-  QVector<QString> hdf5ArrayPaths = createHDF5DatasetPaths();
-
-  for(const auto& hdf5ArrayPath : hdf5ArrayPaths)
+  // A single step keeps the historical Attribute Matrix name; a range gets one Cell Attribute Matrix per step
+  std::vector<size_t> tDims = {geoDims[0], geoDims[1], geoDims[2]};
+  for(size_t i = 0; i < steps.size(); i++)
   {
-    QString parentPath = QH5Utilities::getParentPath(hdf5ArrayPath);
-
-    hid_t parentId = QH5Utilities::openHDF5Object(fileId, parentPath);
-    H5ScopedGroupSentinel sentinel(parentId, false);
-    // Read dataset into DREAM.3D structure
-    QString objectName = QH5Utilities::getObjectNameFromPath(hdf5ArrayPath);
-    std::vector<size_t> geometryDims = {geoDims[0], geoDims[1], geoDims[2]};
-    IDataArray::Pointer dPtr = readIDataArray(parentId, objectName, geometryDims, getInPreflight());
-    if(dPtr == IDataArray::NullPointer())
+    if(getCancel())
+    {
+      return;
+    }
+    QString amName = m_ImportStepRange ? reader.getStepName(steps[i]) : MASSIFUtilitiesConstants::ImportMassifData::MassifAM;
+    RenameDataPath::DataID_t amID = m_ImportStepRange ? RenameDataPath::k_Invalid_ID : AttributeMatrixID21;
+    AttributeMatrix::Pointer am = dc->createNonPrereqAttributeMatrix(this, amName, tDims, AttributeMatrix::Type::Cell, amID);
+    if(getErrorCode() < 0)
     {
-      QString ss = tr("Could not read dataset '%1' at path '%2'").arg(objectName).arg(parentPath);
-      setErrorCondition(-3003, ss);
       return;
     }
-    am->insertOrAssign(dPtr);
-  }
-}
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-QVector<DataArrayPath> ImportMASSIFData::createDataArrayPaths()
-{
-  QVector<DataArrayPath> dataArrayPaths;
-  dataArrayPaths.push_back(
-      DataArrayPath(MASSIFUtilitiesConstants::ImportMassifData::MassifDC, MASSIFUtilitiesConstants::ImportMassifData::MassifAM, MASSIFUtilitiesConstants::ImportMassifData::DField));
-  dataArrayPaths.push_back(
-      DataArrayPath(MASSIFUtilitiesConstants::ImportMassifData::MassifDC, MASSIFUtilitiesConstants::ImportMassifData::MassifAM, MASSIFUtilitiesConstants::ImportMassifData::EField));
-  dataArrayPaths.push_back(
-      DataArrayPath(MASSIFUtilitiesConstants::ImportMassifData::MassifDC, MASSIFUtilitiesConstants::ImportMassifData::MassifAM, MASSIFUtilitiesConstants::ImportMassifData::SField));
-
-  dataArrayPaths.push_back(DataArrayPath(MASSIFUtilitiesConstants::ImportMassifData::MassifDC, MASSIFUtilitiesConstants::ImportMassifData::MassifAM, MASSIFUtilitiesConstants::ImportMassifData::EVM));
-  dataArrayPaths.push_back(DataArrayPath(MASSIFUtilitiesConstants::ImportMassifData::MassifDC, MASSIFUtilitiesConstants::ImportMassifData::MassifAM, MASSIFUtilitiesConstants::ImportMassifData::SVM));
-  dataArrayPaths.push_back(
-      DataArrayPath(MASSIFUtilitiesConstants::ImportMassifData::MassifDC, MASSIFUtilitiesConstants::ImportMassifData::MassifAM, MASSIFUtilitiesConstants::ImportMassifData::GrainID));
-  dataArrayPaths.push_back(
-      DataArrayPath(MASSIFUtilitiesConstants::ImportMassifData::MassifDC, MASSIFUtilitiesConstants::ImportMassifData::MassifAM, MASSIFUtilitiesConstants::ImportMassifData::Phase));
-
-  return dataArrayPaths;
+    if(!getInPreflight())
+    {
+      notifyStatusMessage(tr("Reading step %1 (%2 of %3)").arg(steps[i]).arg(i + 1).arg(steps.size()));
+    }
+    // Preflight only creates the arrays; execute reads each step on demand through the reader's bounded cache
+    AttributeMatrix::Pointer stepData = getInPreflight() ? reader.readStep(steps[i], amName, true) : reader.getStep(steps[i]);
+    if(nullptr == stepData)
+    {
+      setErrorCondition(-3014, reader.getErrorMessage());
+      return;
+    }
+    for(const auto& arrayName : stepData->getAttributeArrayNames())
+    {
+      am->insertOrAssign(stepData->getAttributeArray(arrayName));
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QVector<QString> ImportMASSIFData::createHDF5DatasetPaths()
+std::vector<int32_t> ImportMASSIFData::findStepsToImport(MASSIFStepReader& reader)
 {
-  QVector<QString> arrayPaths;
-  QString parentPath = "/" + MASSIFUtilitiesConstants::ImportMassifData::DCGrpName + "/" + m_PaddedStep + "/" + MASSIFUtilitiesConstants::ImportMassifData::Datapoint;
-
-  arrayPaths.push_back(parentPath + "/" + MASSIFUtilitiesConstants::ImportMassifData::DFieldsGrpName + "/" + MASSIFUtilitiesConstants::ImportMassifData::DField);
-
-  arrayPaths.push_back(parentPath + "/" + MASSIFUtilitiesConstants::ImportMassifData::EFieldsGrpName + "/" + MASSIFUtilitiesConstants::ImportMassifData::EField);
-
-  arrayPaths.push_back(parentPath + "/" + MASSIFUtilitiesConstants::ImportMassifData::SFieldsGrpName + "/" + MASSIFUtilitiesConstants::ImportMassifData::SField);
-
-  arrayPaths.push_back(parentPath + "/" + MASSIFUtilitiesConstants::ImportMassifData::DFieldsGrpName + "/" + MASSIFUtilitiesConstants::ImportMassifData::EVM);
-
-  arrayPaths.push_back(parentPath + "/" + MASSIFUtilitiesConstants::ImportMassifData::SFieldsGrpName + "/" + MASSIFUtilitiesConstants::ImportMassifData::SVM);
-
-  arrayPaths.push_back(parentPath + "/" + MASSIFUtilitiesConstants::ImportMassifData::EulerAngleGrpName + "/" + MASSIFUtilitiesConstants::ImportMassifData::Phi1);
-
-  arrayPaths.push_back(parentPath + "/" + MASSIFUtilitiesConstants::ImportMassifData::EulerAngleGrpName + "/" + MASSIFUtilitiesConstants::ImportMassifData::Phi);
-
-  arrayPaths.push_back(parentPath + "/" + MASSIFUtilitiesConstants::ImportMassifData::EulerAngleGrpName + "/" + MASSIFUtilitiesConstants::ImportMassifData::Phi2);
-
-  arrayPaths.push_back(parentPath + "/" + MASSIFUtilitiesConstants::ImportMassifData::GrainID);
+  if(!m_ImportStepRange)
+  {
+    return {m_StepNumber};
+  }
 
-  arrayPaths.push_back(parentPath + "/" + MASSIFUtilitiesConstants::ImportMassifData::Phase);
+  std::vector<int32_t> availableSteps;
+  if(reader.findAvailableSteps(availableSteps) < 0)
+  {
+    setErrorCondition(-3006, reader.getErrorMessage());
+    return {};
+  }
 
-  return arrayPaths;
+  std::vector<int32_t> steps;
+  for(int32_t step : availableSteps)
+  {
+    if(step >= m_StepNumber && step <= m_EndStepNumber && (step - m_StepNumber) % m_StepIncrement == 0)
+    {
+      steps.push_back(step);
+    }
+  }
+  if(steps.empty())
+  {
+    QString ss = tr("No steps with prefix '%1' between %2 and %3 (increment %4) were found in the file.").arg(m_FilePrefix).arg(m_StepNumber).arg(m_EndStepNumber).arg(m_StepIncrement);
+    setErrorCondition(-3013, ss);
+  }
+  return steps;
 }
 
 // -----------------------------------------------------------------------------
@@ -295,80 +260,6 @@ void ImportMASSIFData::execute()
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ImportMASSIFData::getDataContainerGeometry(std::vector<size_t>& tDims, FloatVec3Type& origin, FloatVec3Type& spacing)
-{
-  hid_t fileId = QH5Utilities::openFile(m_MassifInputFilePath, true);
-  if(fileId < 0)
-  {
-    QString ss = tr("Error Reading HDF5 file: %1\n").arg(m_MassifInputFilePath);
-    setErrorCondition(-3005, ss);
-    return;
-  }
-
-  H5ScopedFileSentinel sentinel(fileId, true);
-
-  QString totalPath = MASSIFUtilitiesConstants::ImportMassifData::DCGrpName;
-  hid_t gid = QH5Utilities::openHDF5Object(fileId, MASSIFUtilitiesConstants::ImportMassifData::DCGrpName);
-  if(gid < 0)
-  {
-    QString ss = tr("Could not open path: %1\n").arg(totalPath);
-    setErrorCondition(-3006, ss);
-    return;
-  }
-  sentinel.addGroupId(gid);
-
-  // Build up the step
-  m_PaddedStep = m_FilePrefix;
-  m_PaddedStep.append(StringOperations::GenerateIndexString(m_StepNumber, MASSIFUtilitiesConstants::ImportMassifData::MaxStepNumber));
-  totalPath.append("/" + m_PaddedStep);
-
-  hid_t stepGid = QH5Utilities::openHDF5Object(gid, m_PaddedStep);
-  if(stepGid < 0)
-  {
-    QString ss = tr("Could not open path: %1\n").arg(totalPath);
-    setErrorCondition(-3007, ss);
-    return;
-  }
-  sentinel.addGroupId(stepGid);
-
-  totalPath.append("/" + MASSIFUtilitiesConstants::ImportMassifData::GeometryGrpName);
-  hid_t geoGid = QH5Utilities::openHDF5Object(stepGid, MASSIFUtilitiesConstants::ImportMassifData::GeometryGrpName);
-  if(geoGid < 0)
-  {
-    QString ss = tr("Could not open path: %1\n").arg(totalPath);
-    setErrorCondition(-3007, ss);
-    return;
-  }
-  sentinel.addGroupId(geoGid);
-
-  herr_t err = QH5Lite::readPointerDataset(geoGid, MASSIFUtilitiesConstants::ImportMassifData::DimGrpName, tDims.data());
-  if(err < 0)
-  {
-    QString ss = tr("Could not read dataset %1 at path '%2'\n").arg(MASSIFUtilitiesConstants::ImportMassifData::DimGrpName).arg(totalPath);
-    setErrorCondition(-3008, ss);
-    return;
-  }
-
-  err = QH5Lite::readPointerDataset(geoGid, MASSIFUtilitiesConstants::ImportMassifData::OriginGrpName, origin.data());
-  if(err < 0)
-  {
-    QString ss = tr("Could not read dataset %1 at path '%2'\n").arg(MASSIFUtilitiesConstants::ImportMassifData::OriginGrpName).arg(totalPath);
-    setErrorCondition(-3009, ss);
-    return;
-  }
-
-  err = QH5Lite::readPointerDataset(geoGid, MASSIFUtilitiesConstants::ImportMassifData::SpacingGrpName, spacing.data());
-  if(err < 0)
-  {
-    QString ss = tr("Could not read dataset %1 at path '%2'\n").arg(MASSIFUtilitiesConstants::ImportMassifData::SpacingGrpName).arg(totalPath);
-    setErrorCondition(-3010, ss);
-    return;
-  }
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -441,215 +332,6 @@ QString ImportMASSIFData::getHumanLabel() const
   return "Import MASSIF Data (HDF5)";
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-IDataArray::Pointer ImportMASSIFData::readIDataArray(hid_t gid, const QString& name, std::vector<size_t> geoDims, bool metaDataOnly)
-{
-
-  herr_t err = -1;
-  // herr_t retErr = 1;
-  hid_t typeId = -1;
-  H5T_class_t attr_type;
-  size_t attr_size;
-  QString res;
-
-  QVector<hsize_t> dims; // Reusable for the loop
-  IDataArray::Pointer ptr = IDataArray::NullPointer();
-  // qDebug() << "Reading Attribute " << *iter ;
-  typeId = QH5Lite::getDatasetType(gid, name);
-  if(typeId < 0)
-  {
-    return ptr;
-  }
-  // Get the HDF5 DataSet information. the dimensions will be the combined Tuple Dims and the Data Array Componenet dimes
-  err = QH5Lite::getDatasetInfo(gid, name, dims, attr_type, attr_size);
-  if(err < 0)
-  {
-    qDebug() << "Error in getAttributeInfo method in readUserMetaData.";
-  }
-  else
-  {
-    QString classType;
-    // int version = 0;
-    std::vector<size_t>& tDims = geoDims;
-    std::vector<size_t> cDims;
-
-    if(geoDims.size() == dims.size())
-    {
-      cDims.push_back(1);
-    }
-    else
-    {
-      for(int i = geoDims.size(); i < dims.size(); i++)
-      {
-        cDims.push_back(dims[i]);
-      }
-    }
-
-    //    err = ReadRequiredAttributes(gid, name, classType, version, tDims, cDims);
-    //    if(err < 0)
-    //    {
-    //      return ptr;
-    //    }
-
-    // Check to see if we are reading a bool array and if so read it and return
-    if(classType.compare("DataArray<bool>") == 0)
-    {
-      if(!metaDataOnly)
-      {
-        ptr = Detail::readH5Dataset<bool>(gid, name, tDims, cDims);
-      }
-      else
-      {
-        ptr = DataArray<bool>::CreateArray(tDims, cDims, name, false);
-      }
-      err = H5Tclose(typeId);
-      return ptr; // <== Note early return here.
-    }
-    switch(attr_type)
-    {
-    case H5T_STRING:
-      res.clear(); // Clear the string out first
-      err = QH5Lite::readStringDataset(gid, name, res);
-      break;
-    case H5T_INTEGER:
-      // qDebug() << "User Meta Data Type is Integer" ;
-      if((H5Tequal(typeId, H5T_STD_U8BE) != 0) || (H5Tequal(typeId, H5T_STD_U8LE) != 0))
-      {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<uint8_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<uint8_t>::CreateArray(tDims, cDims, name, false);
-        }
-      }
-      else if((H5Tequal(typeId, H5T_STD_U16BE) != 0) || (H5Tequal(typeId, H5T_STD_U16LE) != 0))
-      {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<uint16_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<uint16_t>::CreateArray(tDims, cDims, name, false);
-        }
-      }
-      else if((H5Tequal(typeId, H5T_STD_U32BE) != 0) || (H5Tequal(typeId, H5T_STD_U32LE) != 0))
-      {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<uint32_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<uint32_t>::CreateArray(tDims, cDims, name, false);
-        }
-      }
-      else if((H5Tequal(typeId, H5T_STD_U64BE) != 0) || (H5Tequal(typeId, H5T_STD_U64LE) != 0))
-      {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<uint64_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<uint64_t>::CreateArray(tDims, cDims, name, false);
-        }
-      }
-      else if((H5Tequal(typeId, H5T_STD_I8BE) != 0) || (H5Tequal(typeId, H5T_STD_I8LE) != 0))
-      {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<int8_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<int8_t>::CreateArray(tDims, cDims, name, false);
-        }
-      }
-      else if((H5Tequal(typeId, H5T_STD_I16BE) != 0) || (H5Tequal(typeId, H5T_STD_I16LE) != 0))
-      {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<int16_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<int16_t>::CreateArray(tDims, cDims, name, false);
-        }
-      }
-      else if((H5Tequal(typeId, H5T_STD_I32BE) != 0) || (H5Tequal(typeId, H5T_STD_I32LE) != 0))
-      {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<int32_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<int32_t>::CreateArray(tDims, cDims, name, false);
-        }
-      }
-      else if((H5Tequal(typeId, H5T_STD_I64BE) != 0) || (H5Tequal(typeId, H5T_STD_I64LE) != 0))
-      {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<int64_t>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<int64_t>::CreateArray(tDims, cDims, name, false);
-        }
-      }
-      else
-      {
-        qDebug() << "Unknown Type: " << typeId << " at " << name;
-        err = -1;
-      }
-      break;
-    case H5T_FLOAT:
-      if(attr_size == 4)
-      {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<float>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<float>::CreateArray(tDims, cDims, name, false);
-        }
-      }
-      else if(attr_size == 8)
-      {
-        if(!metaDataOnly)
-        {
-          ptr = Detail::readH5Dataset<double>(gid, name, tDims, cDims);
-        }
-        else
-        {
-          ptr = DataArray<double>::CreateArray(tDims, cDims, name, false);
-        }
-      }
-      else
-      {
-        qDebug() << "Unknown Floating point type";
-        err = -1;
-      }
-      break;
-    default:
-      qDebug() << "Error: readUserMetaData() Unknown attribute type: " << attr_type;
-      QH5Utilities::printHDFClassType(attr_type);
-    }
-
-    err = H5Tclose(typeId);
-    // Close the H5A type Id that was retrieved during the loop
-  }
-
-  return ptr;
-}
-
 // -----------------------------------------------------------------------------
 ImportMASSIFData::Pointer ImportMASSIFData::NullPointer()
 {
@@ -714,3 +396,39 @@ int ImportMASSIFData::getStepNumber() const
 {
   return m_StepNumber;
 }
+
+// -----------------------------------------------------------------------------
+void ImportMASSIFData::setImportStepRange(bool value)
+{
+  m_ImportStepRange = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ImportMASSIFData::getImportStepRange() const
+{
+  return m_ImportStepRange;
+}
+
+// -----------------------------------------------------------------------------
+void ImportMASSIFData::setEndStepNumber(int value)
+{
+  m_EndStepNumber = value;
+}
+
+// -----------------------------------------------------------------------------
+int ImportMASSIFData::getEndStepNumber() const
+{
+  return m_EndStepNumber;
+}
+
+// -----------------------------------------------------------------------------
+void ImportMASSIFData::setStepIncrement(int value)
+{
+  m_StepIncrement = value;
+}
+
+// -----------------------------------------------------------------------------
+int ImportMASSIFData::getStepIncrement() const
+{
+  return m_StepIncrement;
+}
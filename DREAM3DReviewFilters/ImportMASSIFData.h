@@ -13,6 +13,7 @@
 
 class IDataArray;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
+class MASSIFStepReader;
 
 #include "DREAM3DReview/DREAM3DReviewDLLExport.h"
 
@@ -31,6 +32,9 @@ class DREAM3DReview_EXPORT ImportMASSIFData : public AbstractFilter
   PYB11_PROPERTY(QString MassifInputFilePath READ getMassifInputFilePath WRITE setMassifInputFilePath)
   PYB11_PROPERTY(QString FilePrefix READ getFilePrefix WRITE setFilePrefix)
   PYB11_PROPERTY(int StepNumber READ getStepNumber WRITE setStepNumber)
+  PYB11_PROPERTY(bool ImportStepRange READ getImportStepRange WRITE setImportStepRange)
+  PYB11_PROPERTY(int EndStepNumber READ getEndStepNumber WRITE setEndStepNumber)
+  PYB11_PROPERTY(int StepIncrement READ getStepIncrement WRITE setStepIncrement)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -88,6 +92,39 @@ public:
   int getStepNumber() const;
   Q_PROPERTY(int StepNumber READ getStepNumber WRITE setStepNumber)
 
+  /**
+   * @brief Setter property for ImportStepRange
+   */
+  void setImportStepRange(bool value);
+  /**
+   * @brief Getter property for ImportStepRange
+   * @return Value of ImportStepRange
+   */
+  bool getImportStepRange() const;
+  Q_PROPERTY(bool ImportStepRange READ getImportStepRange WRITE setImportStepRange)
+
+  /**
+   * @brief Setter property for EndStepNumber
+   */
+  void setEndStepNumber(int value);
+  /**
+   * @brief Getter property for EndStepNumber
+   * @return Value of EndStepNumber
+   */
+  int getEndStepNumber() const;
+  Q_PROPERTY(int EndStepNumber READ getEndStepNumber WRITE setEndStepNumber)
+
+  /**
+   * @brief Setter property for StepIncrement
+   */
+  void setStepIncrement(int value);
+  /**
+   * @brief Getter property for StepIncrement
+   * @return Value of StepIncrement
+   */
+  int getStepIncrement() const;
+  Q_PROPERTY(int StepIncrement READ getStepIncrement WRITE setStepIncrement)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -165,36 +202,17 @@ private:
   QString m_FilePrefix = {"Step-"};
   int m_StepNumber = {2};
 
-  QString m_PaddedStep = "";
+  bool m_ImportStepRange = {false};
+  int m_EndStepNumber = {2};
+  int m_StepIncrement = {1};
 
   /**
-   * @brief createDataArrayPaths
-   * @return
-   */
-  QVector<DataArrayPath> createDataArrayPaths();
-
-  /**
-   * @brief createHDF5DatasetPaths
-   * @return
-   */
-  QVector<QString> createHDF5DatasetPaths();
-
-  /**
-   * @brief getDataContainerGeometry
-   * @param tDims
-   * @param origin
-   * @param res
-   */
-  void getDataContainerGeometry(std::vector<size_t>& tDims, FloatVec3Type& origin, FloatVec3Type& spacing);
-
-  /**
-   * @brief readIDataArray
-   * @param gid
-   * @param name
-   * @param metaDataOnly
-   * @return
+   * @brief findStepsToImport Returns the step numbers selected by the filter parameters. In range
+   * mode only the steps that actually exist in the file are returned.
+   * @param reader Open MASSIF reader
+   * @return The list of steps; empty on error
    */
-  IDataArray::Pointer readIDataArray(hid_t gid, const QString& name, std::vector<size_t> geoDims, bool metaDataOnly);
+  std::vector<int32_t> findStepsToImport(MASSIFStepReader& reader);
 
 public:
   ImportMASSIFData(const ImportMASSIFData&) = delete;            // Copy Constructor Not Implemented
@@ -14,7 +14,9 @@
 
 #include "ImportVolumeGraphicsFile.h"
 
+#include <algorithm>
 #include <tuple>
+#include <type_traits>
 
 #include <QtCore/QDir>
 #include <QtCore/QFileInfo>
@@ -25,13 +27,19 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/CTReaderHelpers.hpp"
 
 #define CREATE_BLOCK_CONST(VAR) static inline const QString k_##VAR##Block("[" #VAR "]");
 
@@ -48,6 +56,9 @@ static inline constexpr int32_t k_FileIsDirectory = -91507;
 static inline constexpr int32_t k_VolBinaryAllocateMismatch = -91504;
 static inline constexpr int32_t k_VolOpenError = -91505;
 static inline constexpr int32_t k_VolReadError = -91506;
+static inline constexpr int32_t k_SubvolumeError = -91508;
+static inline constexpr int32_t k_StrideError = -91509;
+static inline constexpr int32_t k_OutputTypeError = -91510;
 
 static inline const QString k_Millimeter("mm");
 
@@ -102,6 +113,29 @@ void ImportVolumeGraphicsFile::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::CreatedArray));
   parameters.push_back(SIMPL_NEW_AM_WITH_LINKED_DC_FP("Cell Attribute Matrix", CellAttributeMatrixName, DataContainerName, FilterParameter::Category::CreatedArray, ImportVolumeGraphicsFile));
   parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Density", DensityArrayName, DataContainerName, CellAttributeMatrixName, FilterParameter::Category::CreatedArray, ImportVolumeGraphicsFile));
+
+  std::vector<QString> linkedProps = {"StartVoxelCoord", "EndVoxelCoord"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Import Subvolume", ImportSubvolume, FilterParameter::Category::Parameter, ImportVolumeGraphicsFile, linkedProps));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Starting XYZ Voxel", StartVoxelCoord, FilterParameter::Category::Parameter, ImportVolumeGraphicsFile));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Ending XYZ Voxel", EndVoxelCoord, FilterParameter::Category::Parameter, ImportVolumeGraphicsFile));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Voxel Stride", Stride, FilterParameter::Category::Parameter, ImportVolumeGraphicsFile));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Average Voxels Within Stride (Binning)", BinVoxels, FilterParameter::Category::Parameter, ImportVolumeGraphicsFile));
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Output Data Type");
+    parameter->setPropertyName("OutputDataType");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ImportVolumeGraphicsFile, this, OutputDataType));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ImportVolumeGraphicsFile, this, OutputDataType));
+    std::vector<QString> choices = {"float", "uint16_t", "uint8_t"};
+    parameter->setChoices(choices);
+    std::vector<QString> linkedChoiceProps = {"DensityWindowMin", "DensityWindowMax"};
+    parameter->setLinkedProperties(linkedChoiceProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_FLOAT_FP("Density Window Minimum", DensityWindowMin, FilterParameter::Category::Parameter, ImportVolumeGraphicsFile, {CTReaderHelpers::k_UInt16Output, CTReaderHelpers::k_UInt8Output}));
+  parameters.push_back(SIMPL_NEW_FLOAT_FP("Density Window Maximum", DensityWindowMax, FilterParameter::Category::Parameter, ImportVolumeGraphicsFile, {CTReaderHelpers::k_UInt16Output, CTReaderHelpers::k_UInt8Output}));
   setFilterParameters(parameters);
 }
 
@@ -197,6 +231,64 @@ void ImportVolumeGraphicsFile::dataCheck()
     return;
   }
 
+  // Resolve the (inclusive) region of the .vol file to import
+  m_ImportStart = {0, 0, 0};
+  m_ImportEnd = {m_VolumeDimensions[0] - 1, m_VolumeDimensions[1] - 1, m_VolumeDimensions[2] - 1};
+  if(getImportSubvolume())
+  {
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(m_StartVoxelCoord[i] < 0 || m_StartVoxelCoord[i] > m_EndVoxelCoord[i] || static_cast<size_t>(m_EndVoxelCoord[i]) >= m_VolumeDimensions[i])
+      {
+        QString ss = QObject::tr("The subvolume range %1-%2 along axis %3 must satisfy 0 <= Start <= End < %4")
+                         .arg(m_StartVoxelCoord[i])
+                         .arg(m_EndVoxelCoord[i])
+                         .arg(i)
+                         .arg(m_VolumeDimensions[i]);
+        setErrorCondition(k_SubvolumeError, ss);
+        return;
+      }
+      m_ImportStart[i] = static_cast<size_t>(m_StartVoxelCoord[i]);
+      m_ImportEnd[i] = static_cast<size_t>(m_EndVoxelCoord[i]);
+    }
+  }
+
+  if(m_Stride[0] < 1 || m_Stride[1] < 1 || m_Stride[2] < 1)
+  {
+    QString ss = QObject::tr("All stride values must be at least 1 (%1, %2, %3)").arg(m_Stride[0]).arg(m_Stride[1]).arg(m_Stride[2]);
+    setErrorCondition(k_StrideError, ss);
+    return;
+  }
+
+  if(getOutputDataType() < CTReaderHelpers::k_Float32Output || getOutputDataType() > CTReaderHelpers::k_UInt8Output)
+  {
+    QString ss = QObject::tr("Invalid selection for the output data type");
+    setErrorCondition(k_OutputTypeError, ss);
+    return;
+  }
+  if(getOutputDataType() != CTReaderHelpers::k_Float32Output && getDensityWindowMax() <= getDensityWindowMin())
+  {
+    QString ss = QObject::tr("Density Window Maximum must be greater than Density Window Minimum (%1 <= %2)").arg(getDensityWindowMax()).arg(getDensityWindowMin());
+    setErrorCondition(k_OutputTypeError, ss);
+    return;
+  }
+
+  // Each output voxel covers one stride block of the imported region; partial blocks at the upper edges are kept
+  SizeVec3Type importedDims = {0, 0, 0};
+  FloatVec3Type spacing = image->getSpacing();
+  FloatVec3Type origin = image->getOrigin();
+  for(size_t i = 0; i < 3; i++)
+  {
+    size_t extent = m_ImportEnd[i] - m_ImportStart[i] + 1;
+    size_t stride = static_cast<size_t>(m_Stride[i]);
+    importedDims[i] = (extent + stride - 1) / stride;
+    origin[i] = origin[i] + m_ImportStart[i] * spacing[i];
+    spacing[i] = spacing[i] * stride;
+  }
+  image->setDimensions(importedDims);
+  image->setSpacing(spacing);
+  image->setOrigin(origin);
+
   DataContainer::Pointer m = getDataContainerArray()->createNonPrereqDataContainer(this, getDataContainerName());
 
   if(getErrorCode() < 0)
@@ -215,10 +307,17 @@ void ImportVolumeGraphicsFile::dataCheck()
 
   DataArrayPath path(getDataContainerName(), getCellAttributeMatrixName(), getDensityArrayName());
 
-  m_DensityPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, path, 0, cDims);
-  if(nullptr != m_DensityPtr.lock())
+  switch(getOutputDataType())
   {
-    m_Density = m_DensityPtr.lock()->getPointer(0);
+  case CTReaderHelpers::k_UInt16Output:
+    m_DensityPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint16_t>>(this, path, 0, cDims);
+    break;
+  case CTReaderHelpers::k_UInt8Output:
+    m_DensityPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint8_t>>(this, path, 0, cDims);
+    break;
+  default:
+    m_DensityPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, path, 0, cDims);
+    break;
   }
 }
 
@@ -245,17 +344,40 @@ void ImportVolumeGraphicsFile::execute()
 
 // -----------------------------------------------------------------------------
 int32_t ImportVolumeGraphicsFile::readVolFile()
+{
+  switch(getOutputDataType())
+  {
+  case CTReaderHelpers::k_UInt16Output:
+    return readVolFileAs<uint16_t>();
+  case CTReaderHelpers::k_UInt8Output:
+    return readVolFileAs<uint8_t>();
+  default:
+    return readVolFileAs<float>();
+  }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+int32_t ImportVolumeGraphicsFile::readVolFileAs()
 {
   ImageGeom::Pointer image = getDataContainerArray()->getDataContainer(getDataContainerName())->getGeometryAs<ImageGeom>();
-  int32_t error = 0;
+  SizeVec3Type outDims = image->getDimensions();
 
-  QFileInfo fi(getVGDataFile());
+  auto densityPtr = std::dynamic_pointer_cast<DataArray<T>>(m_DensityPtr.lock());
+  if(nullptr == densityPtr)
+  {
+    QString ss = QObject::tr("Density array %1 is not of the expected type").arg(getDensityArrayName());
+    setErrorCondition(k_VolReadError, ss);
+    return getErrorCode();
+  }
+  T* destination = densityPtr->getPointer(0);
 
+  QFileInfo fi(getVGDataFile());
   size_t filesize = static_cast<size_t>(fi.size());
-  FloatArrayType& density = *(m_DensityPtr.lock().get());
-  size_t allocatedBytes = density.getSize() * sizeof(float);
-
-  if(filesize < allocatedBytes)
+  const size_t dimX = m_VolumeDimensions[0];
+  const size_t dimY = m_VolumeDimensions[1];
+  size_t volumeBytes = dimX * dimY * m_VolumeDimensions[2] * sizeof(float);
+  if(filesize < volumeBytes)
   {
     QString ss = QObject::tr("Binary file size is smaller than the number of allocated bytes");
     setErrorCondition(k_VolBinaryAllocateMismatch, ss);
@@ -273,14 +395,137 @@ int32_t ImportVolumeGraphicsFile::readVolFile()
 
   QString ss = QObject::tr("Reading Data from .vol File.....");
   notifyStatusMessage(ss);
-  if(fread(density.getTuplePointer(0), 1, filesize, f) != filesize)
+
+  const size_t x0 = m_ImportStart[0];
+  const size_t y0 = m_ImportStart[1];
+  const size_t z0 = m_ImportStart[2];
+  const size_t deltaX = m_ImportEnd[0] - x0 + 1;
+  const size_t deltaY = m_ImportEnd[1] - y0 + 1;
+  const size_t deltaZ = m_ImportEnd[2] - z0 + 1;
+  const size_t sx = static_cast<size_t>(m_Stride[0]);
+  const size_t sy = static_cast<size_t>(m_Stride[1]);
+  const size_t sz = static_cast<size_t>(m_Stride[2]);
+  const bool decimating = (sx != 1 || sy != 1 || sz != 1);
+  const size_t outSliceSize = outDims[0] * outDims[1];
+
+  CTReaderHelpers::DensityConverter<T> converter(m_DensityWindowMin, m_DensityWindowMax);
+
+  // Fast path: the whole volume as float is a single read straight into the output array
+  if constexpr(std::is_same_v<T, float>)
   {
-    ss = QObject::tr("Error Reading .vol file. Not enough bytes read....");
-    setErrorCondition(k_VolReadError, ss);
-    return getErrorCode();
+    if(!decimating && deltaX == dimX && deltaY == dimY && deltaZ == m_VolumeDimensions[2])
+    {
+      if(fread(destination, sizeof(float), volumeBytes / sizeof(float), f) != volumeBytes / sizeof(float))
+      {
+        ss = QObject::tr("Error Reading .vol file. Not enough bytes read....");
+        setErrorCondition(k_VolReadError, ss);
+        return getErrorCode();
+      }
+      return 0;
+    }
   }
 
-  return error;
+  // Holds the imported XY region of one source slice. When the full X extent is imported
+  // and every row is needed, the rows are contiguous on disk and are read with one fread.
+  std::vector<float> slab(deltaX * deltaY);
+  const bool allRowsNeeded = (sy == 1 || m_BinVoxels);
+  const bool contiguousRows = (deltaX == dimX) && allRowsNeeded;
+
+  auto readSlab = [&](size_t z) -> bool {
+    if(contiguousRows)
+    {
+      int64_t offset = static_cast<int64_t>(((z * dimY) + y0) * dimX * sizeof(float));
+      return CTReaderHelpers::SeekFile(f, offset) == 0 && fread(slab.data(), sizeof(float), slab.size(), f) == slab.size();
+    }
+    for(size_t y = y0; y <= m_ImportEnd[1]; y += (allRowsNeeded ? 1 : sy))
+    {
+      int64_t offset = static_cast<int64_t>((((z * dimY) + y) * dimX + x0) * sizeof(float));
+      float* row = slab.data() + (y - y0) * deltaX;
+      if(CTReaderHelpers::SeekFile(f, offset) != 0 || fread(row, sizeof(float), deltaX, f) != deltaX)
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  std::vector<float> outSlice(outSliceSize, 0.0f);
+  std::vector<double> accumulator(m_BinVoxels ? outSliceSize : 0);
+
+  for(size_t oz = 0; oz < outDims[2]; oz++)
+  {
+    if(getCancel())
+    {
+      return 0;
+    }
+    size_t zBegin = z0 + oz * sz;
+    size_t zEnd = m_BinVoxels ? std::min(zBegin + sz, m_ImportEnd[2] + 1) : zBegin + 1;
+    if(m_BinVoxels)
+    {
+      std::fill(accumulator.begin(), accumulator.end(), 0.0);
+    }
+
+    for(size_t z = zBegin; z < zEnd; z++)
+    {
+      if(!readSlab(z))
+      {
+        ss = QObject::tr("Error reading slice %1 of .vol file %2").arg(z).arg(getVGDataFile());
+        setErrorCondition(k_VolReadError, ss);
+        return getErrorCode();
+      }
+
+      if(!decimating)
+      {
+        std::copy(slab.begin(), slab.end(), outSlice.begin());
+        continue;
+      }
+      for(size_t oy = 0; oy < outDims[1]; oy++)
+      {
+        if(m_BinVoxels)
+        {
+          size_t yEnd = std::min((oy + 1) * sy, deltaY);
+          for(size_t y = oy * sy; y < yEnd; y++)
+          {
+            const float* row = slab.data() + y * deltaX;
+            double* accumRow = accumulator.data() + oy * outDims[0];
+            for(size_t x = 0; x < deltaX; x++)
+            {
+              accumRow[x / sx] += row[x];
+            }
+          }
+        }
+        else
+        {
+          const float* row = slab.data() + (oy * sy) * deltaX;
+          float* outRow = outSlice.data() + oy * outDims[0];
+          for(size_t ox = 0; ox < outDims[0]; ox++)
+          {
+            outRow[ox] = row[ox * sx];
+          }
+        }
+      }
+    }
+
+    if(m_BinVoxels)
+    {
+      // Blocks on the upper edges may be partial so normalize by the true voxel count of each block
+      size_t countZ = zEnd - zBegin;
+      for(size_t oy = 0; oy < outDims[1]; oy++)
+      {
+        size_t countY = std::min((oy + 1) * sy, deltaY) - oy * sy;
+        for(size_t ox = 0; ox < outDims[0]; ox++)
+        {
+          size_t countX = std::min((ox + 1) * sx, deltaX) - ox * sx;
+          size_t index = oy * outDims[0] + ox;
+          outSlice[index] = static_cast<float>(accumulator[index] / static_cast<double>(countX * countY * countZ));
+        }
+      }
+    }
+
+    converter.convert(outSlice.data(), destination + oz * outSliceSize, outSliceSize);
+  }
+
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -538,6 +783,7 @@ void ImportVolumeGraphicsFile::readHeaderMetaData(ImageGeom::Pointer image)
 
   m_InHeaderStream.reset();
 
+  m_VolumeDimensions = dims;
   image->setDimensions(dims);
   image->setSpacing(res);
   if(geomBlock.unit == k_Millimeter.toStdString())
@@ -710,3 +956,99 @@ QString ImportVolumeGraphicsFile::getDensityArrayName() const
 {
   return m_DensityArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void ImportVolumeGraphicsFile::setImportSubvolume(bool value)
+{
+  m_ImportSubvolume = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ImportVolumeGraphicsFile::getImportSubvolume() const
+{
+  return m_ImportSubvolume;
+}
+
+// -----------------------------------------------------------------------------
+void ImportVolumeGraphicsFile::setStartVoxelCoord(const IntVec3Type& value)
+{
+  m_StartVoxelCoord = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type ImportVolumeGraphicsFile::getStartVoxelCoord() const
+{
+  return m_StartVoxelCoord;
+}
+
+// -----------------------------------------------------------------------------
+void ImportVolumeGraphicsFile::setEndVoxelCoord(const IntVec3Type& value)
+{
+  m_EndVoxelCoord = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type ImportVolumeGraphicsFile::getEndVoxelCoord() const
+{
+  return m_EndVoxelCoord;
+}
+
+// -----------------------------------------------------------------------------
+void ImportVolumeGraphicsFile::setStride(const IntVec3Type& value)
+{
+  m_Stride = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type ImportVolumeGraphicsFile::getStride() const
+{
+  return m_Stride;
+}
+
+// -----------------------------------------------------------------------------
+void ImportVolumeGraphicsFile::setBinVoxels(bool value)
+{
+  m_BinVoxels = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ImportVolumeGraphicsFile::getBinVoxels() const
+{
+  return m_BinVoxels;
+}
+
+// -----------------------------------------------------------------------------
+void ImportVolumeGraphicsFile::setOutputDataType(int32_t value)
+{
+  m_OutputDataType = value;
+}
+
+// -----------------------------------------------------------------------------
+int32_t ImportVolumeGraphicsFile::getOutputDataType() const
+{
+  return m_OutputDataType;
+}
+
+// -----------------------------------------------------------------------------
+void ImportVolumeGraphicsFile::setDensityWindowMin(float value)
+{
+  m_DensityWindowMin = value;
+}
+
+// -----------------------------------------------------------------------------
+float ImportVolumeGraphicsFile::getDensityWindowMin() const
+{
+  return m_DensityWindowMin;
+}
+
+// -----------------------------------------------------------------------------
+void ImportVolumeGraphicsFile::setDensityWindowMax(float value)
+{
+  m_DensityWindowMax = value;
+}
+
+// -----------------------------------------------------------------------------
+float ImportVolumeGraphicsFile::getDensityWindowMax() const
+{
+  return m_DensityWindowMax;
+}
@@ -38,6 +38,14 @@ class DREAM3DReview_EXPORT ImportVolumeGraphicsFile : public AbstractFilter
   PYB11_PROPERTY(QString DataContainerName READ getDataContainerName WRITE setDataContainerName)
   PYB11_PROPERTY(QString CellAttributeMatrixName READ getCellAttributeMatrixName WRITE setCellAttributeMatrixName)
   PYB11_PROPERTY(QString DensityArrayName READ getDensityArrayName WRITE setDensityArrayName)
+  PYB11_PROPERTY(bool ImportSubvolume READ getImportSubvolume WRITE setImportSubvolume)
+  PYB11_PROPERTY(IntVec3Type StartVoxelCoord READ getStartVoxelCoord WRITE setStartVoxelCoord)
+  PYB11_PROPERTY(IntVec3Type EndVoxelCoord READ getEndVoxelCoord WRITE setEndVoxelCoord)
+  PYB11_PROPERTY(IntVec3Type Stride READ getStride WRITE setStride)
+  PYB11_PROPERTY(bool BinVoxels READ getBinVoxels WRITE setBinVoxels)
+  PYB11_PROPERTY(int32_t OutputDataType READ getOutputDataType WRITE setOutputDataType)
+  PYB11_PROPERTY(float DensityWindowMin READ getDensityWindowMin WRITE setDensityWindowMin)
+  PYB11_PROPERTY(float DensityWindowMax READ getDensityWindowMax WRITE setDensityWindowMax)
   PYB11_METHOD(QString getVGDataFile)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
@@ -149,6 +157,94 @@ public:
   QString getDensityArrayName() const;
   Q_PROPERTY(QString DensityArrayName READ getDensityArrayName WRITE setDensityArrayName)
 
+  /**
+   * @brief Setter property for ImportSubvolume
+   */
+  void setImportSubvolume(bool value);
+  /**
+   * @brief Getter property for ImportSubvolume
+   * @return Value of ImportSubvolume
+   */
+  bool getImportSubvolume() const;
+  Q_PROPERTY(bool ImportSubvolume READ getImportSubvolume WRITE setImportSubvolume)
+
+  /**
+   * @brief Setter property for StartVoxelCoord
+   */
+  void setStartVoxelCoord(const IntVec3Type& value);
+  /**
+   * @brief Getter property for StartVoxelCoord
+   * @return Value of StartVoxelCoord
+   */
+  IntVec3Type getStartVoxelCoord() const;
+  Q_PROPERTY(IntVec3Type StartVoxelCoord READ getStartVoxelCoord WRITE setStartVoxelCoord)
+
+  /**
+   * @brief Setter property for EndVoxelCoord
+   */
+  void setEndVoxelCoord(const IntVec3Type& value);
+  /**
+   * @brief Getter property for EndVoxelCoord
+   * @return Value of EndVoxelCoord
+   */
+  IntVec3Type getEndVoxelCoord() const;
+  Q_PROPERTY(IntVec3Type EndVoxelCoord READ getEndVoxelCoord WRITE setEndVoxelCoord)
+
+  /**
+   * @brief Setter property for Stride
+   */
+  void setStride(const IntVec3Type& value);
+  /**
+   * @brief Getter property for Stride
+   * @return Value of Stride
+   */
+  IntVec3Type getStride() const;
+  Q_PROPERTY(IntVec3Type Stride READ getStride WRITE setStride)
+
+  /**
+   * @brief Setter property for BinVoxels
+   */
+  void setBinVoxels(bool value);
+  /**
+   * @brief Getter property for BinVoxels
+   * @return Value of BinVoxels
+   */
+  bool getBinVoxels() const;
+  Q_PROPERTY(bool BinVoxels READ getBinVoxels WRITE setBinVoxels)
+
+  /**
+   * @brief Setter property for OutputDataType
+   */
+  void setOutputDataType(int32_t value);
+  /**
+   * @brief Getter property for OutputDataType
+   * @return Value of OutputDataType
+   */
+  int32_t getOutputDataType() const;
+  Q_PROPERTY(int32_t OutputDataType READ getOutputDataType WRITE setOutputDataType)
+
+  /**
+   * @brief Setter property for DensityWindowMin
+   */
+  void setDensityWindowMin(float value);
+  /**
+   * @brief Getter property for DensityWindowMin
+   * @return Value of DensityWindowMin
+   */
+  float getDensityWindowMin() const;
+  Q_PROPERTY(float DensityWindowMin READ getDensityWindowMin WRITE setDensityWindowMin)
+
+  /**
+   * @brief Setter property for DensityWindowMax
+   */
+  void setDensityWindowMax(float value);
+  /**
+   * @brief Getter property for DensityWindowMax
+   * @return Value of DensityWindowMax
+   */
+  float getDensityWindowMax() const;
+  Q_PROPERTY(float DensityWindowMax READ getDensityWindowMax WRITE setDensityWindowMax)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -208,11 +304,19 @@ protected:
   ImportVolumeGraphicsFile();
 
   /**
-   * @brief readBinaryCTFile Reads the raw binary CT file
+   * @brief readVolFile Reads the requested region of the raw .vol file, applying any stride/binning
+   * and type reduction while the data is streamed in one XY slab at a time.
    * @return Integer error code
    */
   int32_t readVolFile();
 
+  /**
+   * @brief readVolFileAs Typed implementation of readVolFile
+   * @return Integer error code
+   */
+  template <typename T>
+  int32_t readVolFileAs();
+
   /**
    * @brief readHeaderMetaData Reads the number of voxels and voxel extents
    * from the NSI header file
@@ -238,8 +342,20 @@ protected:
   void initialize();
 
 private:
-  std::weak_ptr<DataArray<float>> m_DensityPtr;
-  float* m_Density = nullptr;
+  IDataArray::WeakPointer m_DensityPtr;
+
+  bool m_ImportSubvolume = {false};
+  IntVec3Type m_StartVoxelCoord = {0, 0, 0};
+  IntVec3Type m_EndVoxelCoord = {1, 1, 1};
+  IntVec3Type m_Stride = {1, 1, 1};
+  bool m_BinVoxels = {false};
+  int32_t m_OutputDataType = {0}; // 0 = float32, 1 = uint16, 2 = uint8
+  float m_DensityWindowMin = {0.0f};
+  float m_DensityWindowMax = {1.0f};
+
+  SizeVec3Type m_VolumeDimensions = {0, 0, 0};
+  SizeVec3Type m_ImportStart = {0, 0, 0};
+  SizeVec3Type m_ImportEnd = {0, 0, 0};
 
   QString m_VGDataFile = {};
   QString m_VGHeaderFile = {};
@@ -35,6 +35,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "LocalDislocationDensityCalculator.h"
 
+#include <mutex>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
@@ -49,10 +51,11 @@
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/EdgeGeom.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
-#include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/SegmentRasterizer.hpp"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -293,14 +296,7 @@ void LocalDislocationDensityCalculator::execute()
   float yMax = m_DomainBounds[4];
   float zMax = m_DomainBounds[5];
 
-  FloatVec3Type halfCellSize;
-  halfCellSize[0] = (m_CellSize[0] / 2.0f);
-  halfCellSize[1] = (m_CellSize[1] / 2.0f);
-  halfCellSize[2] = (m_CellSize[2] / 2.0f);
-  FloatVec3Type quarterCellSize;
-  quarterCellSize[0] = (m_CellSize[0] / 4.0f);
-  quarterCellSize[1] = (m_CellSize[1] / 4.0f);
-  quarterCellSize[2] = (m_CellSize[2] / 4.0f);
+  float halfCellSize[3] = {m_CellSize[0] / 2.0f, m_CellSize[1] / 2.0f, m_CellSize[2] / 2.0f};
 
   vdc->getGeometryAs<ImageGeom>()->setOrigin(std::make_tuple(xMin, yMin, zMin));
   size_t dcDims[3];
@@ -317,125 +313,53 @@ void LocalDislocationDensityCalculator::execute()
   cellAttrMat->resizeAttributeArrays(tDims);
   updateCellInstancePointers();
 
-  // Create a temporary array to hold the individual slip system lengths in order to determine dominant system
-  FloatArrayType::Pointer m_IndividualSystemLengthsPtr =
-      FloatArrayType::CreateArray(12 * m_OutputArrayPtr.lock()->getNumberOfTuples(), std::string("INDIVIDUAL_SYSTEM_LENGTHS_INTERNAL_USE_ONLY"), true);
-  float* m_IndividualSystemLengths = m_IndividualSystemLengthsPtr->getPointer(0);
-
-  float point1[3], point2[3], corner1[3], corner2[3];
-  size_t xCellMin, xCellMax;
-  size_t yCellMin, yCellMax;
-  size_t zCellMin, zCellMax;
-  float x1, y1, z1, x2, y2, z2;
-  size_t zStride, yStride, point;
-  float length;
-  int32_t system = 0;
-  for(size_t i = 0; i < numEdges; i++)
+  // Each cell is one full cell wide and overlaps its neighbors by half a cell, so the edges are rasterized
+  // once onto a grid of half cells and every cell sums the 2x2x2 block of half cells it covers. Channel 0
+  // holds the total length and channels 1 - 12 the length on each slip system.
+  const size_t numChannels = 13;
+  const size_t totalCells = dcDims[0] * dcDims[1] * dcDims[2];
+  float domainMin[3] = {xMin, yMin, zMin};
+  SegmentRasterizer::Grid fineGrid = SegmentRasterizer::CreateStaggeredGrid(domainMin, halfCellSize, dcDims);
+  std::vector<float> fineLengths(numChannels * fineGrid.getNumberOfCells(), 0.0f);
   {
-    point1[0] = nodes[3 * edge[2 * i + 0] + 0];
-    point1[1] = nodes[3 * edge[2 * i + 0] + 1];
-    point1[2] = nodes[3 * edge[2 * i + 0] + 2];
-    point2[0] = nodes[3 * edge[2 * i + 1] + 0];
-    point2[1] = nodes[3 * edge[2 * i + 1] + 1];
-    point2[2] = nodes[3 * edge[2 * i + 1] + 2];
-    x1 = (point1[0] - xMin);
-    y1 = (point1[1] - yMin);
-    z1 = (point1[2] - zMin);
-    x2 = (point2[0] - xMin);
-    y2 = (point2[1] - yMin);
-    z2 = (point2[2] - zMin);
-    if(x1 > x2)
-    {
-      xCellMin = size_t(x2 / quarterCellSize[0]), xCellMax = size_t(x1 / quarterCellSize[0]);
-    }
-    else
-    {
-      xCellMin = size_t(x1 / quarterCellSize[0]), xCellMax = size_t(x2 / quarterCellSize[0]);
-    }
-    if(y1 > y2)
-    {
-      yCellMin = size_t(y2 / quarterCellSize[1]), yCellMax = size_t(y1 / quarterCellSize[1]);
-    }
-    else
-    {
-      yCellMin = size_t(y1 / quarterCellSize[1]), yCellMax = size_t(y2 / quarterCellSize[1]);
-    }
-    if(z1 > z2)
-    {
-      zCellMin = size_t(z2 / quarterCellSize[2]), zCellMax = size_t(z1 / quarterCellSize[2]);
-    }
-    else
-    {
-      zCellMin = size_t(z1 / quarterCellSize[2]), zCellMax = size_t(z2 / quarterCellSize[2]);
-    }
-    xCellMin = (xCellMin - 1) / 2;
-    yCellMin = (yCellMin - 1) / 2;
-    zCellMin = (zCellMin - 1) / 2;
-    xCellMax = ((xCellMax - 1) / 2) + 1;
-    yCellMax = ((yCellMax - 1) / 2) + 1;
-    zCellMax = ((zCellMax - 1) / 2) + 1;
-    if(xCellMax >= tDims[0])
-    {
-      xCellMax = tDims[0] - 1;
-    }
-    if(yCellMax >= tDims[1])
-    {
-      yCellMax = tDims[1] - 1;
-    }
-    if(zCellMax >= tDims[2])
-    {
-      zCellMax = tDims[2] - 1;
-    }
-    for(size_t j = zCellMin; j <= zCellMax; j++)
-    {
-      zStride = j * tDims[0] * tDims[1];
-      corner1[2] = (j * halfCellSize[2]) - halfCellSize[2] + quarterCellSize[2] + zMin;
-      corner2[2] = (j * halfCellSize[2]) + halfCellSize[2] + quarterCellSize[2] + zMin;
-      for(size_t k = yCellMin; k <= yCellMax; k++)
-      {
-        yStride = k * tDims[0];
-        corner1[1] = (k * halfCellSize[1]) - halfCellSize[1] + quarterCellSize[1] + yMin;
-        corner2[1] = (k * halfCellSize[1]) + halfCellSize[1] + quarterCellSize[1] + yMin;
-        for(size_t l = xCellMin; l <= xCellMax; l++)
-        {
-          corner1[0] = (l * halfCellSize[0]) - halfCellSize[0] + quarterCellSize[0] + xMin;
-          corner2[0] = (l * halfCellSize[0]) + halfCellSize[0] + quarterCellSize[0] + xMin;
-          length = GeometryMath::LengthOfRayInBox(point1, point2, corner1, corner2);
-          point = (zStride + yStride + l);
-          m_OutputArray[point] += length;
-          system = determine_slip_system(i);
-          m_IndividualSystemLengths[12 * point + system] += length;
-        }
-      }
-    }
+    // The slip system is determined once per edge; edges on no slip system only count toward the total
+    auto classifier = [this](size_t edgeIndex) { return static_cast<int32_t>(determine_slip_system(static_cast<int>(edgeIndex))); };
+    std::mutex mutex;
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numEdges);
+    dataAlg.execute(SegmentRasterizer::RasterizeEdgesImpl<decltype(classifier)>(nodes, edge, fineGrid, numChannels, classifier, fineLengths, mutex));
+  }
+  if(getCancel())
+  {
+    return;
+  }
+
+  std::vector<float> cellLengths(numChannels * totalCells, 0.0f);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, dcDims[2]);
+    dataAlg.execute(SegmentRasterizer::GatherOverlappingCellsImpl(fineLengths, fineGrid, dcDims, numChannels, cellLengths));
   }
+  std::vector<float>().swap(fineLengths);
 
   float cellVolume = m_CellSize[0] * m_CellSize[1] * m_CellSize[2];
-  for(size_t j = 0; j < tDims[2]; j++)
+  for(size_t point = 0; point < totalCells; point++)
   {
-    zStride = j * tDims[0] * tDims[1];
-    for(size_t k = 0; k < tDims[1]; k++)
+    const float* lengths = cellLengths.data() + numChannels * point;
+    // take care of total density first before looping over all systems
+    m_OutputArray[point] = lengths[0] / cellVolume;
+    // convert to m/mm^3 from um/um^3
+    m_OutputArray[point] *= 1.0E12f;
+    float max = 0.0f;
+    for(int iter = 0; iter < 12; iter++)
     {
-      yStride = k * tDims[0];
-      for(size_t l = 0; l < tDims[0]; l++)
+      float density = lengths[iter + 1] / cellVolume;
+      // convert to m/mm^3 from um/um^3
+      density *= 1.0E12f;
+      if(density > max)
       {
-        point = (zStride + yStride + l);
-        // take care of total density first before looping over all systems
-        m_OutputArray[point] /= cellVolume;
-        // convert to m/mm^3 from um/um^3
-        m_OutputArray[point] *= 1.0E12f;
-        float max = 0.0f;
-        for(int iter = 0; iter < 12; iter++)
-        {
-          m_IndividualSystemLengths[12 * point + iter] /= cellVolume;
-          // convert to m/mm^3 from um/um^3
-          m_IndividualSystemLengths[12 * point + iter] *= 1.0E12f;
-          if(m_IndividualSystemLengths[12 * point + iter] > max)
-          {
-            m_DominantSystemArray[point] = iter;
-            max = m_IndividualSystemLengths[12 * point + iter];
-          }
-        }
+        m_DominantSystemArray[point] = iter;
+        max = density;
       }
     }
   }
@@ -40,6 +40,7 @@
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
 #include <tbb/partitioner.h>
 #endif
 
@@ -59,6 +60,7 @@
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "util/StatisticsHelpers.hpp"
 
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
@@ -67,6 +69,16 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID31 = 31,
 };
 
+namespace
+{
+enum OutputTypes : int32_t
+{
+  k_DoubleOutput = 0,
+  k_FloatOutput = 1,
+  k_InPlace = 2
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -99,7 +111,24 @@ void NormalizeArrays::setupFilterParameters()
     parameter->setCategory(FilterParameter::Category::Parameter);
     parameters.push_back(parameter);
   }
-  parameters.push_back(SIMPL_NEW_STRING_FP("Postfix", Postfix, FilterParameter::Category::Parameter, NormalizeArrays));
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Output Type");
+    parameter->setPropertyName("OutputType");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(NormalizeArrays, this, OutputType));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(NormalizeArrays, this, OutputType));
+    std::vector<QString> choices;
+    choices.push_back("New Arrays (64-bit Float)");
+    choices.push_back("New Arrays (32-bit Float)");
+    choices.push_back("In Place");
+    parameter->setChoices(choices);
+    std::vector<QString> linkedProps = {"Postfix"};
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_STRING_FP("Postfix", Postfix, FilterParameter::Category::Parameter, NormalizeArrays, {k_DoubleOutput, k_FloatOutput}));
   std::vector<QString> linkedProps = {"MaskArrayPath", "DefaultValue"};
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Mask", UseMask, FilterParameter::Category::Parameter, NormalizeArrays, linkedProps));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("Default Masked Value", DefaultValue, FilterParameter::Category::Parameter, NormalizeArrays));
@@ -145,7 +174,14 @@ void NormalizeArrays::dataCheck()
     return;
   }
 
-  if(getPostfix().isEmpty())
+  if(getOutputType() != k_DoubleOutput && getOutputType() != k_FloatOutput && getOutputType() != k_InPlace)
+  {
+    QString ss = QObject::tr("Invalid selection for output type");
+    setErrorCondition(-11004, ss);
+    return;
+  }
+
+  if(getOutputType() != k_InPlace && getPostfix().isEmpty())
   {
     QString ss = QObject::tr("A postfix for the normalized Attribute Arrays must be entered");
     setErrorCondition(-11001, ss);
@@ -180,16 +216,37 @@ void NormalizeArrays::dataCheck()
         QString ss = QObject::tr("All Attribute Arrays must be scalar arrays, but %1 has %2 total components").arg(ptr.lock()->getName()).arg(numComps);
         setErrorCondition(-11003, ss);
       }
+      else if(getOutputType() == k_InPlace)
+      {
+        QString typeName = ptr.lock()->getTypeAsString();
+        if(typeName != SIMPL::TypeNames::Float && typeName != SIMPL::TypeNames::Double)
+        {
+          QString ss = QObject::tr("Only floating point Attribute Arrays may be normalized in place, but %1 is of type %2").arg(ptr.lock()->getName()).arg(typeName);
+          setErrorCondition(-11005, ss);
+        }
+        else
+        {
+          m_NormalizedArraysPtrVector.push_back(ptr.lock());
+        }
+      }
       else
       {
         QString arrayName = path.getDataArrayName() + getPostfix();
         DataArrayPath tempPath(dcName, amName, arrayName);
         double defaultValue = m_UseMask ? getDefaultValue() : 0.0;
 
-        DoubleArrayType::WeakPointer ptr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, tempPath, defaultValue, cDims, "", DataArrayID31);
+        IDataArray::Pointer outputPtr;
+        if(getOutputType() == k_FloatOutput)
+        {
+          outputPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, static_cast<float>(defaultValue), cDims, "", DataArrayID31).lock();
+        }
+        else
+        {
+          outputPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, tempPath, defaultValue, cDims, "", DataArrayID31).lock();
+        }
         if(getErrorCode() >= 0)
         {
-          m_NormalizedArraysPtrVector.push_back(ptr.lock());
+          m_NormalizedArraysPtrVector.push_back(outputPtr);
         }
       }
     }
@@ -215,39 +272,74 @@ void NormalizeArrays::dataCheck()
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void copyDataArrays(IDataArray::Pointer dataPtr, std::vector<double>& copy, bool useMask, bool* mask)
+class NormalizeArraysReduceImpl
 {
-  typename DataArray<T>::Pointer inDataPtr = std::dynamic_pointer_cast<DataArray<T>>(dataPtr);
-  T* dPtr = inDataPtr->getPointer(0);
-  size_t numTuples = inDataPtr->getNumberOfTuples();
+public:
+  NormalizeArraysReduceImpl(const T* data, const bool* mask)
+  : m_Data(data)
+  , m_Mask(mask)
+  {
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  NormalizeArraysReduceImpl(NormalizeArraysReduceImpl& other, tbb::split)
+  : m_Data(other.m_Data)
+  , m_Mask(other.m_Mask)
+  {
+  }
+#endif
+
+  virtual ~NormalizeArraysReduceImpl() = default;
 
-  for(size_t i = 0; i < numTuples; i++)
+  void compute(size_t start, size_t end)
   {
-    if(useMask)
+    for(size_t i = start; i < end; i++)
     {
-      if(mask[i])
+      if(m_Mask != nullptr && !m_Mask[i])
       {
-        copy.push_back(dPtr[i]);
+        continue;
       }
-    }
-    else
-    {
-      copy.push_back(dPtr[i]);
+      m_Statistics.add(static_cast<double>(m_Data[i]));
     }
   }
-}
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r)
+  {
+    compute(r.begin(), r.end());
+  }
+
+  void join(const NormalizeArraysReduceImpl& rhs)
+  {
+    m_Statistics.merge(rhs.m_Statistics);
+  }
+#endif
+
+  const StatisticsHelpers::RangeStatistics<double>& getStatistics() const
+  {
+    return m_Statistics;
+  }
+
+private:
+  const T* m_Data;
+  const bool* m_Mask;
+  StatisticsHelpers::RangeStatistics<double> m_Statistics;
+};
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
+template <typename T, typename OutT>
 class NormalizeArraysImpl
 {
 public:
-  NormalizeArraysImpl(std::vector<std::vector<double>>& arrays, int32_t normalizeType, double rangeMin, double rangeMax)
-  : m_Arrays(arrays)
-  , m_NormalizeType(normalizeType)
-  , m_RangeMin(rangeMin)
-  , m_RangeMax(rangeMax)
+  NormalizeArraysImpl(const T* data, OutT* output, const bool* mask, double offset, double scale, double shift)
+  : m_Data(data)
+  , m_Output(output)
+  , m_Mask(mask)
+  , m_Offset(offset)
+  , m_Scale(scale)
+  , m_Shift(shift)
   {
   }
 
@@ -257,29 +349,11 @@ public:
   {
     for(size_t i = start; i < end; i++)
     {
-      if(m_NormalizeType == 0)
-      {
-        double min = *std::min_element(std::begin(m_Arrays[i]), std::end(m_Arrays[i]));
-        double max = *std::max_element(std::begin(m_Arrays[i]), std::end(m_Arrays[i]));
-        // size_t count = m_Arrays.size();
-        for(auto& val : m_Arrays[i])
-        {
-          val = m_RangeMin + (((val - min) * (m_RangeMax - m_RangeMin)) / (max - min));
-        }
-      }
-      else if(m_NormalizeType == 1)
+      if(m_Mask != nullptr && !m_Mask[i])
       {
-        double sum = std::accumulate(std::begin(m_Arrays[i]), std::end(m_Arrays[i]), 0.0);
-        double mean = sum / m_Arrays[i].size();
-        std::vector<double> difference(m_Arrays[i].size());
-        std::transform(std::begin(m_Arrays[i]), std::end(m_Arrays[i]), std::begin(difference), [&](double val) { return val - mean; });
-        double squaredSum = std::inner_product(std::begin(difference), std::end(difference), std::begin(difference), 0.0f);
-        double stdDev = std::sqrt(squaredSum / m_Arrays[i].size());
-        for(auto& val : m_Arrays[i])
-        {
-          val = (val - mean) / stdDev;
-        }
+        continue;
       }
+      m_Output[i] = static_cast<OutT>(m_Shift + (static_cast<double>(m_Data[i]) - m_Offset) * m_Scale);
     }
   }
 
@@ -291,76 +365,101 @@ public:
 #endif
 
 private:
-  std::vector<std::vector<double>>& m_Arrays;
-  int32_t m_NormalizeType;
-  double m_RangeMin;
-  double m_RangeMax;
+  const T* m_Data;
+  OutT* m_Output;
+  const bool* m_Mask;
+  double m_Offset;
+  double m_Scale;
+  double m_Shift;
 };
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void NormalizeArrays::execute()
+template <typename T, typename OutT>
+void transformDataArray(const T* data, OutT* output, const bool* mask, size_t numTuples, double offset, double scale, double shift)
 {
-  dataCheck();
-  if(getErrorCode() < 0)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, numTuples), NormalizeArraysImpl<T, OutT>(data, output, mask, offset, scale, shift), tbb::auto_partitioner());
+#else
+  NormalizeArraysImpl<T, OutT> serial(data, output, mask, offset, scale, shift);
+  serial.compute(0, numTuples);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+void normalizeDataArray(IDataArray::Pointer inputPtr, IDataArray::Pointer outputPtr, const bool* mask, int32_t normalizeType, double rangeMin, double rangeMax)
+{
+  typename DataArray<T>::Pointer inDataPtr = std::dynamic_pointer_cast<DataArray<T>>(inputPtr);
+  const T* data = inDataPtr->getPointer(0);
+  size_t numTuples = inDataPtr->getNumberOfTuples();
+
+  NormalizeArraysReduceImpl<T> reduction(data, mask);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_reduce(tbb::blocked_range<size_t>(0, numTuples), reduction, tbb::auto_partitioner());
+#else
+  reduction.compute(0, numTuples);
+#endif
+  const StatisticsHelpers::RangeStatistics<double>& stats = reduction.getStatistics();
+
+  double offset = 0.0;
+  double scale = 1.0;
+  double shift = 0.0;
+  if(normalizeType == 0)
   {
-    return;
+    offset = stats.min;
+    scale = (rangeMax - rangeMin) / (stats.max - stats.min);
+    shift = rangeMin;
   }
-
-  if(m_SelectedDataArrayPaths.size() != m_SelectedWeakPtrVector.size())
+  else
   {
-    QString ss = QObject::tr("The number of selected Attribute Arrays does not equal the number of internal weak pointers");
-    setErrorCondition(-11008, ss);
-    return;
+    offset = stats.mean;
+    scale = 1.0 / stats.stdDeviation();
   }
 
-  size_t numTuples = m_SelectedWeakPtrVector[0].lock()->getNumberOfTuples();
-
-  std::vector<std::vector<double>> arrays(m_SelectedWeakPtrVector.size());
-  for(auto&& vec : arrays)
+  if(DoubleArrayType::Pointer doubleOutput = std::dynamic_pointer_cast<DoubleArrayType>(outputPtr))
   {
-    vec.reserve(numTuples);
+    transformDataArray<T, double>(data, doubleOutput->getPointer(0), mask, numTuples, offset, scale, shift);
   }
-
-  for(std::vector<double>::size_type i = 0; i < arrays.size(); i++)
+  else if(FloatArrayType::Pointer floatOutput = std::dynamic_pointer_cast<FloatArrayType>(outputPtr))
   {
-    EXECUTE_FUNCTION_TEMPLATE(this, copyDataArrays, m_SelectedWeakPtrVector[i].lock(), m_SelectedWeakPtrVector[i].lock(), arrays[i], m_UseMask, m_Mask)
+    transformDataArray<T, float>(data, floatOutput->getPointer(0), mask, numTuples, offset, scale, shift);
   }
+}
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  if(true)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void NormalizeArrays::execute()
+{
+  dataCheck();
+  if(getErrorCode() < 0)
   {
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, arrays.size()), NormalizeArraysImpl(arrays, m_NormalizeType, m_RangeMin, m_RangeMax), tbb::auto_partitioner());
+    return;
   }
-  else
-#endif
+
+  if(m_SelectedDataArrayPaths.size() != m_SelectedWeakPtrVector.size())
   {
-    NormalizeArraysImpl serial(arrays, m_NormalizeType, m_RangeMin, m_RangeMax);
-    serial.compute(0, arrays.size());
+    QString ss = QObject::tr("The number of selected Attribute Arrays does not equal the number of internal weak pointers");
+    setErrorCondition(-11008, ss);
+    return;
   }
 
-  size_t index = 0;
+  assert(m_NormalizedArraysPtrVector.size() == m_SelectedWeakPtrVector.size());
 
-  assert(m_NormalizedArraysPtrVector.size() == arrays.size());
+  const bool* mask = m_UseMask ? m_Mask : nullptr;
 
-  for(size_t i = 0; i < numTuples; i++)
+  for(size_t i = 0; i < m_SelectedWeakPtrVector.size(); i++)
   {
-    for(std::vector<double>::size_type j = 0; j < arrays.size(); j++)
+    if(getCancel())
     {
-      if(m_UseMask)
-      {
-        if(m_Mask[i])
-        {
-          m_NormalizedArraysPtrVector[j]->setValue(i, arrays[j][index]);
-          index++;
-        }
-      }
-      else
-      {
-        m_NormalizedArraysPtrVector[j]->setValue(i, arrays[j][i]);
-      }
+      return;
     }
+    IDataArray::Pointer inputPtr = m_SelectedWeakPtrVector[i].lock();
+    EXECUTE_FUNCTION_TEMPLATE(this, normalizeDataArray, inputPtr, inputPtr, m_NormalizedArraysPtrVector[i], mask, m_NormalizeType, m_RangeMin, m_RangeMax)
   }
 }
 
@@ -513,6 +612,18 @@ double NormalizeArrays::getRangeMax() const
   return m_RangeMax;
 }
 
+// -----------------------------------------------------------------------------
+void NormalizeArrays::setOutputType(int value)
+{
+  m_OutputType = value;
+}
+
+// -----------------------------------------------------------------------------
+int NormalizeArrays::getOutputType() const
+{
+  return m_OutputType;
+}
+
 // -----------------------------------------------------------------------------
 void NormalizeArrays::setPostfix(const QString& value)
 {
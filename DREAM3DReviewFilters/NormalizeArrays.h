@@ -59,6 +59,7 @@ class DREAM3DReview_EXPORT NormalizeArrays : public AbstractFilter
   PYB11_PROPERTY(int NormalizeType READ getNormalizeType WRITE setNormalizeType)
   PYB11_PROPERTY(double RangeMin READ getRangeMin WRITE setRangeMin)
   PYB11_PROPERTY(double RangeMax READ getRangeMax WRITE setRangeMax)
+  PYB11_PROPERTY(int OutputType READ getOutputType WRITE setOutputType)
   PYB11_PROPERTY(QString Postfix READ getPostfix WRITE setPostfix)
   PYB11_PROPERTY(bool UseMask READ getUseMask WRITE setUseMask)
   PYB11_PROPERTY(DataArrayPath MaskArrayPath READ getMaskArrayPath WRITE setMaskArrayPath)
@@ -131,6 +132,17 @@ public:
   double getRangeMax() const;
   Q_PROPERTY(double RangeMax READ getRangeMax WRITE setRangeMax)
 
+  /**
+   * @brief Setter property for OutputType
+   */
+  void setOutputType(int value);
+  /**
+   * @brief Getter property for OutputType
+   * @return Value of OutputType
+   */
+  int getOutputType() const;
+  Q_PROPERTY(int OutputType READ getOutputType WRITE setOutputType)
+
   /**
    * @brief Setter property for Postfix
    */
@@ -233,8 +245,6 @@ public:
 protected:
   NormalizeArrays();
 
-  void updateDataArrays(double* copyPtr, DoubleArrayType::Pointer newArray, int32_t arrayIndex);
-
   /**
    * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
    */
@@ -253,13 +263,14 @@ private:
   int m_NormalizeType = {0};
   double m_RangeMin = {0.0};
   double m_RangeMax = {1.0};
+  int m_OutputType = {0};
   QString m_Postfix = {"_Normalized"};
   bool m_UseMask = {false};
   DataArrayPath m_MaskArrayPath = {"", "", ""};
   double m_DefaultValue = {0.0};
 
   std::vector<IDataArray::WeakPointer> m_SelectedWeakPtrVector;
-  std::vector<DoubleArrayType::Pointer> m_NormalizedArraysPtrVector;
+  std::vector<IDataArray::Pointer> m_NormalizedArraysPtrVector;
 
 public:
   NormalizeArrays(const NormalizeArrays&) = delete;            // Copy Constructor Not Implemented
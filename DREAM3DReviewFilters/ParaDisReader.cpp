@@ -36,6 +36,9 @@
 
 #include "ParaDisReader.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 #include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
 
@@ -43,13 +46,18 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataContainerCreationFilterParameter.h"
+#include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/EdgeGeom.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Utilities/FilePathGenerator.h"
 
+#include "DREAM3DReview/DREAM3DReviewFilters/util/ParaDisParser.hpp"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
 enum createdPathID : RenameDataPath::DataID_t
@@ -63,6 +71,8 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID33 = 33,
   DataArrayID34 = 34,
   DataArrayID35 = 35,
+  DataArrayID36 = 36,
+  DataArrayID37 = 37,
 
   DataContainerID = 1
 };
@@ -70,7 +80,18 @@ enum createdPathID : RenameDataPath::DataID_t
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-ParaDisReader::ParaDisReader() = default;
+ParaDisReader::ParaDisReader()
+{
+  m_InputFileListInfo.StartIndex = 0;
+  m_InputFileListInfo.EndIndex = 0;
+  m_InputFileListInfo.IncrementIndex = 1;
+  m_InputFileListInfo.PaddingDigits = 0;
+  m_InputFileListInfo.Ordering = 0;
+  m_InputFileListInfo.FileExtension = "";
+  m_InputFileListInfo.FilePrefix = "";
+  m_InputFileListInfo.FileSuffix = "";
+  m_InputFileListInfo.InputPath = "";
+}
 
 // -----------------------------------------------------------------------------
 //
@@ -84,7 +105,10 @@ void ParaDisReader::setupFilterParameters()
 {
   FileReader::setupFilterParameters();
   FilterParameterVectorType parameters;
+  std::vector<QString> linkedProps = {"InputFileListInfo", "SnapshotIndexArrayName"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Import Snapshot Series", ImportSnapshotSeries, FilterParameter::Category::Parameter, ParaDisReader, linkedProps));
   parameters.push_back(SIMPL_NEW_INPUT_FILE_FP("Input File", InputFile, FilterParameter::Category::Parameter, ParaDisReader, "*"));
+  parameters.push_back(SIMPL_NEW_FILELISTINFO_FP("Input Snapshot Files", InputFileListInfo, FilterParameter::Category::Parameter, ParaDisReader));
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Burgers Vector Length (Angstroms)", BurgersVector, FilterParameter::Category::Parameter, ParaDisReader));
   // parameters.push_back(SeparatorFilterParameter::Create("Created Information", FilterParameter::Category::Uncategorized));
   parameters.push_back(SIMPL_NEW_DC_CREATION_FP("Edge DataContainer Name", EdgeDataContainerName, FilterParameter::Category::CreatedArray, ParaDisReader));
@@ -98,6 +122,7 @@ void ParaDisReader::setupFilterParameters()
       SIMPL_NEW_DA_WITH_LINKED_AM_FP("Burgers Vectors Array Name", BurgersVectorsArrayName, EdgeDataContainerName, EdgeAttributeMatrixName, FilterParameter::Category::CreatedArray, ParaDisReader));
   parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Slip Plane Normals Array Name", SlipPlaneNormalsArrayName, EdgeDataContainerName, EdgeAttributeMatrixName,
                                                       FilterParameter::Category::CreatedArray, ParaDisReader));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Snapshot Index Array Name", SnapshotIndexArrayName, FilterParameter::Category::CreatedArray, ParaDisReader));
   setFilterParameters(parameters);
 }
 
@@ -112,7 +137,10 @@ void ParaDisReader::readFilterParameters(AbstractFilterParametersReader* reader,
   setBurgersVectorsArrayName(reader->readString("BurgersVectorsArrayName", getBurgersVectorsArrayName()));
   setNodeConstraintsArrayName(reader->readString("NodeConstraintsArrayName", getNodeConstraintsArrayName()));
   setNumberOfArmsArrayName(reader->readString("NumberOfArmsArrayName", getNumberOfArmsArrayName()));
+  setSnapshotIndexArrayName(reader->readString("SnapshotIndexArrayName", getSnapshotIndexArrayName()));
   setInputFile(reader->readString("InputFile", getInputFile()));
+  setImportSnapshotSeries(reader->readValue("ImportSnapshotSeries", getImportSnapshotSeries()));
+  setInputFileListInfo(reader->readFileListInfo("InputFileListInfo", getInputFileListInfo()));
   setBurgersVector(reader->readValue("BurgersVector", getBurgersVector()));
   reader->closeFilterGroup();
 }
@@ -133,6 +161,10 @@ void ParaDisReader::updateVertexInstancePointers()
   {
     m_NodeConstraints = m_NodeConstraintsPtr.lock()->getPointer(0);
   } /* Now assign the raw pointer to data from the DataArray<T> object */
+  if(nullptr != m_VertexSnapshotIndexPtr.lock())
+  {
+    m_VertexSnapshotIndex = m_VertexSnapshotIndexPtr.lock()->getPointer(0);
+  } /* Now assign the raw pointer to data from the DataArray<T> object */
 }
 
 // -----------------------------------------------------------------------------
@@ -151,6 +183,10 @@ void ParaDisReader::updateEdgeInstancePointers()
   {
     m_SlipPlaneNormals = m_SlipPlaneNormalsPtr.lock()->getPointer(0);
   } /* Now assign the raw pointer to data from the DataArray<T> object */
+  if(nullptr != m_EdgeSnapshotIndexPtr.lock())
+  {
+    m_EdgeSnapshotIndex = m_EdgeSnapshotIndexPtr.lock()->getPointer(0);
+  } /* Now assign the raw pointer to data from the DataArray<T> object */
 }
 
 // -----------------------------------------------------------------------------
@@ -158,13 +194,27 @@ void ParaDisReader::updateEdgeInstancePointers()
 // -----------------------------------------------------------------------------
 void ParaDisReader::initialize()
 {
-  if(m_InStream.isOpen())
+  m_Reader.reset();
+  m_SnapshotIndex = 0;
+  m_NumVerts = 0;
+  m_NumEdges = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QString> ParaDisReader::getSnapshotFiles()
+{
+  if(!m_ImportSnapshotSeries)
   {
-    m_InStream.close();
+    return QVector<QString>(1, m_InputFile);
   }
-  m_NumVerts = -1;
-  m_NumEdges = -1;
-  m_FileVersion = 0;
+
+  bool hasMissingFiles = false;
+  bool orderAscending = (m_InputFileListInfo.Ordering == 0);
+  return FilePathGenerator::GenerateFileList(m_InputFileListInfo.StartIndex, m_InputFileListInfo.EndIndex, m_InputFileListInfo.IncrementIndex, hasMissingFiles, orderAscending,
+                                             m_InputFileListInfo.InputPath, m_InputFileListInfo.FilePrefix, m_InputFileListInfo.FileSuffix, m_InputFileListInfo.FileExtension,
+                                             m_InputFileListInfo.PaddingDigits);
 }
 
 // -----------------------------------------------------------------------------
@@ -177,6 +227,8 @@ void ParaDisReader::dataCheck()
 
   DataArrayPath tempPath;
 
+  QVector<QString> snapshotFiles = getSnapshotFiles();
+
   DataContainer::Pointer m = getDataContainerArray()->createNonPrereqDataContainer(this, getEdgeDataContainerName(), DataContainerID);
   if(getErrorCode() < 0)
   {
@@ -193,21 +245,37 @@ void ParaDisReader::dataCheck()
   {
     return;
   }
-  tDims[0] = 1;
+  // One tuple of meta data (the domain bounds) per snapshot
+  tDims[0] = std::max(snapshotFiles.size(), 1);
   AttributeMatrix::Pointer amMeta = m->createNonPrereqAttributeMatrix(this, "_MetaData", tDims, AttributeMatrix::Type::MetaData, AttributeMatrixID23);
   if(getErrorCode() < 0)
   {
     return;
   }
 
-  QFileInfo fi(getInputFile());
-
-  if(getInputFile().isEmpty())
+  if(m_ImportSnapshotSeries)
+  {
+    if(snapshotFiles.empty())
+    {
+      QString ss = QObject::tr("No snapshot files have been selected for import. Have you set the input directory and other values so that input files will be generated?");
+      setErrorCondition(-389, ss);
+    }
+    for(const auto& snapshotFile : snapshotFiles)
+    {
+      if(!QFileInfo::exists(snapshotFile))
+      {
+        QString ss = QObject::tr("The snapshot file %1 does not exist.").arg(snapshotFile);
+        setErrorCondition(-390, ss);
+        break;
+      }
+    }
+  }
+  else if(getInputFile().isEmpty())
   {
     QString ss = QObject::tr("%1 needs the Input File Set and it was not.").arg(ClassName());
     setErrorCondition(-387, ss);
   }
-  else if(!fi.exists())
+  else if(!QFileInfo::exists(getInputFile()))
   {
     QString ss = QObject::tr("The input file does not exist.");
     setErrorCondition(-388, ss);
@@ -225,6 +293,21 @@ void ParaDisReader::dataCheck()
   {
     m_NodeConstraints = m_NodeConstraintsPtr.lock()->getPointer(0);
   } /* Now assign the raw pointer to data from the DataArray<T> object */
+  if(m_ImportSnapshotSeries)
+  {
+    tempPath.update(getEdgeDataContainerName().getDataContainerName(), getVertexAttributeMatrixName(), getSnapshotIndexArrayName());
+    m_VertexSnapshotIndexPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>>(this, tempPath, 0, dims, "", DataArrayID36);
+    if(nullptr != m_VertexSnapshotIndexPtr.lock())
+    {
+      m_VertexSnapshotIndex = m_VertexSnapshotIndexPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+    tempPath.update(getEdgeDataContainerName().getDataContainerName(), getEdgeAttributeMatrixName(), getSnapshotIndexArrayName());
+    m_EdgeSnapshotIndexPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>>(this, tempPath, 0, dims, "", DataArrayID37);
+    if(nullptr != m_EdgeSnapshotIndexPtr.lock())
+    {
+      m_EdgeSnapshotIndex = m_EdgeSnapshotIndexPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
   dims[0] = 3;
   tempPath.update(getEdgeDataContainerName().getDataContainerName(), getEdgeAttributeMatrixName(), getBurgersVectorsArrayName());
   m_BurgersVectorsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, tempPath, 0.0, dims);
@@ -246,34 +329,12 @@ void ParaDisReader::dataCheck()
     m_DomainBounds = m_DomainBoundsPtr.lock()->getPointer(0);
   } /* Now assign the raw pointer to data from the DataArray<T> object */
 
-  if(m_InStream.isOpen())
-  {
-    m_InStream.close();
-  }
-
-  if(!getInputFile().isEmpty() && fi.exists())
+  if(getErrorCode() >= 0)
   {
-    // We need to read the header of the input file to get the dimensions
-    m_InStream.setFileName(getInputFile());
-    if(!m_InStream.open(QIODevice::ReadOnly | QIODevice::Text))
-    {
-      QString ss = QObject::tr("ParaDisReader Input file could not be opened: %1").arg(getInputFile());
-      setErrorCondition(-100, ss);
-      return;
-    }
-
-    // int error = readHeader();
     // add edges for preflight sake...they will get overwritten when actually reading the file
     SharedVertexList::Pointer vertices = EdgeGeom::CreateSharedVertexList(0);
     EdgeGeom::Pointer edgeGeom = EdgeGeom::CreateGeometry(0, vertices, SIMPL::Geometry::EdgeGeometry, !getInPreflight());
     m->setGeometry(edgeGeom);
-
-    // m_InStream.close();
-    // if (error < 0)
-    //{
-    //  QString ss = QObject::tr("Error occurred trying to parse the dimensions from the input file. Is the input file a Dx file?");
-    //  setErrorCondition(error, ss);
-    //}
   }
 }
 
@@ -282,33 +343,47 @@ void ParaDisReader::dataCheck()
 // -----------------------------------------------------------------------------
 void ParaDisReader::execute()
 {
-  int err = 0;
-
   dataCheck();
   if(getErrorCode() < 0)
   {
     return;
   }
 
-  m_InStream.setFileName(getInputFile());
-  if(!m_InStream.open(QIODevice::ReadOnly | QIODevice::Text))
-  {
-    QString ss = QObject::tr("ParaDisReader Input file could not be opened: %1").arg(getInputFile());
-    setErrorCondition(-100, ss);
-    return;
-  }
+  initialize();
 
-  err = readHeader();
-  if(err < 0)
-  {
-    m_InStream.close();
-    return;
-  }
-  err = readFile();
-  m_InStream.close();
-  if(err < 0)
+  // Every snapshot is appended to the same Edge Geometry; the snapshot index arrays tell them apart
+  QVector<QString> snapshotFiles = getSnapshotFiles();
+  for(int32_t i = 0; i < snapshotFiles.size(); i++)
   {
-    return;
+    if(getCancel())
+    {
+      return;
+    }
+    if(m_ImportSnapshotSeries)
+    {
+      notifyStatusMessage(QObject::tr("Reading snapshot %1 of %2").arg(i + 1).arg(snapshotFiles.size()));
+    }
+
+    m_SnapshotIndex = i;
+    m_Reader = std::make_unique<ParaDisParser::SnapshotReader>(snapshotFiles[i]);
+    int err = m_Reader->open();
+    if(err < 0)
+    {
+      setErrorCondition(err, m_Reader->getErrorMessage());
+    }
+    else
+    {
+      err = readHeader();
+    }
+    if(err >= 0)
+    {
+      err = readFile();
+    }
+    m_Reader.reset();
+    if(err < 0)
+    {
+      return;
+    }
   }
 }
 
@@ -317,109 +392,31 @@ void ParaDisReader::execute()
 // -----------------------------------------------------------------------------
 int ParaDisReader::readHeader()
 {
-  QString ss;
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getEdgeDataContainerName());
   AttributeMatrix::Pointer vertexAttrMat = m->getAttributeMatrix(getVertexAttributeMatrixName());
 
   // convert user input Burgers Vector to microns from angstroms
   float burgersVec = m_BurgersVector / 10000.0f;
 
-  int error = 0;
-
-  QByteArray buf;
-  QList<QByteArray> tokens; /* vector to store the split data */
-
-  bool ok = false;
-  // Process the header information
-  // bool done = false;
-  // read Version line
-  buf = m_InStream.readLine();
-  buf = buf.trimmed();
-  buf = buf.simplified();
-  tokens = buf.split(' ');
-  m_FileVersion = tokens[2].toInt(&ok, 10);
-
-  int keepgoing = 1;
-  // read until get to minCoordinates line
-  while(keepgoing == 1)
+  int error = m_Reader->readHeader();
+  if(error < 0)
   {
-    buf = m_InStream.readLine();
-    buf = buf.trimmed();
-    buf = buf.simplified();
-    tokens = buf.split(' ');
-    QString word(tokens.at(0));
-    if(word.compare("minCoordinates") == 0)
-    {
-      for(int32_t i = 0; i < 3; i++)
-      {
-        buf = m_InStream.readLine();
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-        m_DomainBounds[i] = tokens[0].toFloat(&ok) * burgersVec;
-      }
-      keepgoing = 0;
-    }
-  }
-  keepgoing = 1;
-  // read until get to maxCoordinates line
-  while(keepgoing == 1)
-  {
-    buf = m_InStream.readLine();
-    buf = buf.trimmed();
-    buf = buf.simplified();
-    tokens = buf.split(' ');
-    QString word(tokens.at(0));
-    if(word.compare("maxCoordinates") == 0)
-    {
-      for(int32_t i = 3; i < 6; i++)
-      {
-        buf = m_InStream.readLine();
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-        m_DomainBounds[i] = tokens[0].toFloat(&ok) * burgersVec;
-      }
-      keepgoing = 0;
-    }
-  }
-  keepgoing = 1;
-  // read until get to nodeCount line
-  while(keepgoing == 1)
-  {
-    buf = m_InStream.readLine();
-    buf = buf.trimmed();
-    buf = buf.simplified();
-    tokens = buf.split(' ');
-    QString word(tokens.at(0));
-    if(word.compare("nodeCount") == 0)
-    {
-      m_NumVerts = tokens[2].toInt(&ok, 10);
-      keepgoing = 0;
-    }
+    setErrorCondition(error, m_Reader->getErrorMessage());
+    return error;
   }
-  keepgoing = 1;
-  // read until get to nodalData line
-  while(keepgoing == 1)
+
+  const float* domainBounds = m_Reader->getDomainBounds();
+  for(size_t i = 0; i < 6; i++)
   {
-    buf = m_InStream.readLine();
-    buf = buf.trimmed();
-    buf = buf.simplified();
-    tokens = buf.split(' ');
-    QString word(tokens.at(0));
-    if(word.compare("nodalData") == 0)
-    {
-      // read nodal Data lines
-      buf = m_InStream.readLine();
-      buf = m_InStream.readLine();
-      keepgoing = 0;
-    }
+    m_DomainBounds[6 * m_SnapshotIndex + i] = domainBounds[i] * burgersVec;
   }
 
+  // The vertices of this snapshot follow the vertices of the snapshots already read
   EdgeGeom::Pointer edgeGeom = m->getGeometryAs<EdgeGeom>();
-  edgeGeom->resizeVertexList(m_NumVerts);
+  const size_t numVerts = m_NumVerts + m_Reader->getNodeCount();
+  edgeGeom->resizeVertexList(numVerts);
 
-  std::vector<size_t> tDims(1, m_NumVerts);
+  std::vector<size_t> tDims(1, numVerts);
   vertexAttrMat->resizeAttributeArrays(tDims);
   updateVertexInstancePointers();
 
@@ -434,150 +431,109 @@ int ParaDisReader::readFile()
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getEdgeDataContainerName());
   AttributeMatrix::Pointer edgeAttrMat = m->getAttributeMatrix(getEdgeAttributeMatrixName());
 
-  QByteArray buf;
-  QList<QByteArray> tokens;    /* vector to store the split data */
-  QList<QByteArray> subTokens; /* vector to store the split data */
+  int error = m_Reader->readNodes();
+  if(error < 0)
+  {
+    setErrorCondition(error, m_Reader->getErrorMessage());
+    return error;
+  }
 
   EdgeGeom::Pointer edgeGeom = m->getGeometryAs<EdgeGeom>();
-  edgeGeom->resizeVertexList(m_NumVerts);
-
   float* vertex = edgeGeom->getVertexPointer(0);
-  m_NumVerts = edgeGeom->getNumberOfVertices();
-
-  bool ok = false;
-
-  int nodeNum = 0;
-  int neighborNode = 0;
-  m_NumEdges = 0;
-  int nodeCounter = 0;
-  uint64_t* ptr64;
-
-  QMap<int64_t, int32_t> vertNumbers;
-  struct
-  {
-    int32_t n1;
-    int32_t n2;
-  } uniqueNodeId;
-
-  QVector<int> firstNodes;
-  QVector<int> secondNodes;
-  QVector<float> burgerXs;
-  QVector<float> burgerYs;
-  QVector<float> burgerZs;
-  float burgVec[3];
-  QVector<float> spnXs;
-  QVector<float> spnYs;
-  QVector<float> spnZs;
-  float spNorm[3];
 
   // convert user input Burgers Vector to microns from angstroms
   float burgersVec = m_BurgersVector / 10000.0f;
 
-  for(int j = 0; j < m_NumVerts; j++)
-  {
-    buf = m_InStream.readLine();
-    buf = buf.trimmed();
-    buf = buf.simplified();
-    tokens = buf.split(' ');
-    subTokens = tokens[0].split(',');
-    uniqueNodeId.n1 = subTokens[0].toInt(&ok, 10);
-    uniqueNodeId.n2 = subTokens[1].toInt(&ok, 10);
-    ptr64 = reinterpret_cast<uint64_t*>(&uniqueNodeId);
-    nodeNum = vertNumbers.value(*ptr64, -1);
-    if(nodeNum == -1)
+  const std::vector<ParaDisParser::NodeRecord>& nodes = m_Reader->getNodes();
+  const std::vector<ParaDisParser::ArmRecord>& arms = m_Reader->getArms();
+  const size_t nodeCount = nodes.size();
+  const size_t vertexOffset = m_NumVerts;
+
+  // Nodes are numbered in the order their tags first appear, either as a node or as the neighbor of an arm,
+  // and each segment is kept once, from the node with the lower number
+  std::unordered_map<uint64_t, int32_t> vertNumbers;
+  vertNumbers.reserve(nodeCount);
+  int32_t nodeCounter = 0;
+  auto findNodeNumber = [&](uint64_t tag) {
+    auto iter = vertNumbers.emplace(tag, nodeCounter);
+    if(iter.second)
     {
-      nodeNum = nodeCounter;
-      vertex[3 * nodeNum + 0] = tokens[1].toFloat(&ok) * burgersVec;
-      vertex[3 * nodeNum + 1] = tokens[2].toFloat(&ok) * burgersVec;
-      vertex[3 * nodeNum + 2] = tokens[3].toFloat(&ok) * burgersVec;
-      m_NumberOfArms[nodeNum] = tokens[4].toInt(&ok, 10);
-      m_NodeConstraints[nodeNum] = tokens[5].toInt(&ok, 10);
-      vertNumbers.insert(*ptr64, nodeNum);
       nodeCounter++;
     }
-    else
+    return iter.first->second;
+  };
+
+  std::vector<MeshIndexType> edgeNodes;
+  std::vector<size_t> edgeArms;
+  edgeNodes.reserve(arms.size());
+  edgeArms.reserve(arms.size() / 2);
+  for(const auto& node : nodes)
+  {
+    const int32_t nodeNum = findNodeNumber(node.tag);
+    if(static_cast<size_t>(nodeCounter) > nodeCount)
     {
-      vertex[3 * nodeNum + 0] = tokens[1].toFloat(&ok) * burgersVec;
-      vertex[3 * nodeNum + 1] = tokens[2].toFloat(&ok) * burgersVec;
-      vertex[3 * nodeNum + 2] = tokens[3].toFloat(&ok) * burgersVec;
-      m_NumberOfArms[nodeNum] = tokens[4].toInt(&ok, 10);
-      m_NodeConstraints[nodeNum] = tokens[5].toInt(&ok, 10);
+      break;
     }
-    if(m_FileVersion >= 5)
+    const size_t v = vertexOffset + nodeNum;
+    vertex[3 * v + 0] = node.coords[0] * burgersVec;
+    vertex[3 * v + 1] = node.coords[1] * burgersVec;
+    vertex[3 * v + 2] = node.coords[2] * burgersVec;
+    m_NumberOfArms[v] = node.numArms;
+    m_NodeConstraints[v] = node.constraint;
+    if(m_ImportSnapshotSeries)
     {
-      buf = m_InStream.readLine();
+      m_VertexSnapshotIndex[v] = m_SnapshotIndex;
     }
-    for(int k = 0; k < m_NumberOfArms[nodeNum]; k++)
+
+    for(int32_t k = 0; k < node.numArms; k++)
     {
-      buf = m_InStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
-      subTokens = tokens[0].split(',');
-      uniqueNodeId.n1 = subTokens[0].toInt(&ok, 10);
-      uniqueNodeId.n2 = subTokens[1].toInt(&ok, 10);
-      ptr64 = reinterpret_cast<uint64_t*>(&uniqueNodeId);
-      neighborNode = vertNumbers.value(*ptr64, -1);
-      if(neighborNode == -1)
-      {
-        neighborNode = nodeCounter;
-        vertNumbers.insert(*ptr64, neighborNode);
-        nodeCounter++;
-      }
-      if(neighborNode > nodeNum)
-      {
-        m_NumEdges++;
-        firstNodes.push_back(nodeNum);
-        secondNodes.push_back(neighborNode);
-        burgVec[0] = tokens[1].toFloat(&ok);
-        burgVec[1] = tokens[2].toFloat(&ok);
-        burgVec[2] = tokens[3].toFloat(&ok);
-        // burgVec[0] = tokens[1].toFloat(&ok) * burgersVec;
-        // burgVec[1] = tokens[2].toFloat(&ok) * burgersVec;
-        // burgVec[2] = tokens[3].toFloat(&ok) * burgersVec;
-        burgerXs.push_back(burgVec[0]);
-        burgerYs.push_back(burgVec[1]);
-        burgerZs.push_back(burgVec[2]);
-      }
-      buf = m_InStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
+      const int32_t neighborNode = findNodeNumber(arms[node.firstArm + k].neighborTag);
       if(neighborNode > nodeNum)
       {
-        spNorm[0] = tokens[0].toFloat(&ok);
-        spNorm[1] = tokens[1].toFloat(&ok);
-        spNorm[2] = tokens[2].toFloat(&ok);
-        MatrixMath::Normalize3x1(spNorm);
-        spnXs.push_back(spNorm[0]);
-        spnYs.push_back(spNorm[1]);
-        spnZs.push_back(spNorm[2]);
+        edgeNodes.push_back(v);
+        edgeNodes.push_back(vertexOffset + neighborNode);
+        edgeArms.push_back(node.firstArm + k);
       }
     }
   }
+  if(static_cast<size_t>(nodeCounter) > nodeCount)
+  {
+    QString ss = QObject::tr("The segments reference more nodes than the nodeCount of %1 given in the header").arg(nodeCount);
+    setErrorCondition(-394, ss);
+    return -394;
+  }
 
-  edgeGeom->resizeEdgeList(m_NumEdges);
+  const size_t numEdges = m_NumEdges + edgeArms.size();
+  edgeGeom->resizeEdgeList(numEdges);
   MeshIndexType* edge = edgeGeom->getEdgePointer(0);
 
-  // Resize the edge attribute matrix to the number of vertices
-  std::vector<size_t> tDims(1, m_NumEdges);
+  // Resize the edge attribute matrix to the number of edges
+  std::vector<size_t> tDims(1, numEdges);
   edgeAttrMat->resizeAttributeArrays(tDims);
   updateEdgeInstancePointers();
 
-  for(int i = 0; i < m_NumEdges; i++)
+  for(size_t i = 0; i < edgeArms.size(); i++)
   {
-    edge[2 * i + 0] = firstNodes[i];
-    edge[2 * i + 1] = secondNodes[i];
-    m_BurgersVectors[3 * i + 0] = burgerXs[i];
-    m_BurgersVectors[3 * i + 1] = burgerYs[i];
-    m_BurgersVectors[3 * i + 2] = burgerZs[i];
-    m_SlipPlaneNormals[3 * i + 0] = spnXs[i];
-    m_SlipPlaneNormals[3 * i + 1] = spnYs[i];
-    m_SlipPlaneNormals[3 * i + 2] = spnZs[i];
+    const size_t e = m_NumEdges + i;
+    const ParaDisParser::ArmRecord& arm = arms[edgeArms[i]];
+    float spNorm[3] = {arm.normal[0], arm.normal[1], arm.normal[2]};
+    MatrixMath::Normalize3x1(spNorm);
+    edge[2 * e + 0] = edgeNodes[2 * i + 0];
+    edge[2 * e + 1] = edgeNodes[2 * i + 1];
+    m_BurgersVectors[3 * e + 0] = arm.burgers[0];
+    m_BurgersVectors[3 * e + 1] = arm.burgers[1];
+    m_BurgersVectors[3 * e + 2] = arm.burgers[2];
+    m_SlipPlaneNormals[3 * e + 0] = spNorm[0];
+    m_SlipPlaneNormals[3 * e + 1] = spNorm[1];
+    m_SlipPlaneNormals[3 * e + 2] = spNorm[2];
+    if(m_ImportSnapshotSeries)
+    {
+      m_EdgeSnapshotIndex[e] = m_SnapshotIndex;
+    }
   }
 
-  tokens.clear();
-  m_InStream.close();
+  m_NumVerts += nodeCount;
+  m_NumEdges = numEdges;
 
   return 0;
 }
@@ -731,6 +687,30 @@ QString ParaDisReader::getInputFile() const
   return m_InputFile;
 }
 
+// -----------------------------------------------------------------------------
+void ParaDisReader::setImportSnapshotSeries(bool value)
+{
+  m_ImportSnapshotSeries = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ParaDisReader::getImportSnapshotSeries() const
+{
+  return m_ImportSnapshotSeries;
+}
+
+// -----------------------------------------------------------------------------
+void ParaDisReader::setInputFileListInfo(const StackFileListInfo& value)
+{
+  m_InputFileListInfo = value;
+}
+
+// -----------------------------------------------------------------------------
+StackFileListInfo ParaDisReader::getInputFileListInfo() const
+{
+  return m_InputFileListInfo;
+}
+
 // -----------------------------------------------------------------------------
 void ParaDisReader::setBurgersVector(float value)
 {
@@ -802,3 +782,15 @@ QString ParaDisReader::getDomainBoundsArrayName() const
 {
   return m_DomainBoundsArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void ParaDisReader::setSnapshotIndexArrayName(const QString& value)
+{
+  m_SnapshotIndexArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString ParaDisReader::getSnapshotIndexArrayName() const
+{
+  return m_SnapshotIndexArrayName;
+}
@@ -38,8 +38,8 @@
 
 #include <memory>
 
-#include <QtCore/QFile>
 #include <QtCore/QString>
+#include <QtCore/QVector>
 #include <vector>
 
 #include "SIMPLib/SIMPLib.h"
@@ -48,12 +48,18 @@
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/FilterParameters/StackFileListInfo.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Geometry/MeshStructs.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewDLLExport.h"
 
+namespace ParaDisParser
+{
+class SnapshotReader;
+}
+
 /**
  * @class ParaDisReader ParaDisReader.h DREAM3DLib/IO/ParaDisReader.h
  * @brief
@@ -74,12 +80,15 @@ class DREAM3DReview_EXPORT ParaDisReader : public FileReader
   PYB11_PROPERTY(QString VertexAttributeMatrixName READ getVertexAttributeMatrixName WRITE setVertexAttributeMatrixName)
   PYB11_PROPERTY(QString EdgeAttributeMatrixName READ getEdgeAttributeMatrixName WRITE setEdgeAttributeMatrixName)
   PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
+  PYB11_PROPERTY(bool ImportSnapshotSeries READ getImportSnapshotSeries WRITE setImportSnapshotSeries)
+  PYB11_PROPERTY(StackFileListInfo InputFileListInfo READ getInputFileListInfo WRITE setInputFileListInfo)
   PYB11_PROPERTY(float BurgersVector READ getBurgersVector WRITE setBurgersVector)
   PYB11_PROPERTY(QString NumberOfArmsArrayName READ getNumberOfArmsArrayName WRITE setNumberOfArmsArrayName)
   PYB11_PROPERTY(QString NodeConstraintsArrayName READ getNodeConstraintsArrayName WRITE setNodeConstraintsArrayName)
   PYB11_PROPERTY(QString BurgersVectorsArrayName READ getBurgersVectorsArrayName WRITE setBurgersVectorsArrayName)
   PYB11_PROPERTY(QString SlipPlaneNormalsArrayName READ getSlipPlaneNormalsArrayName WRITE setSlipPlaneNormalsArrayName)
   PYB11_PROPERTY(QString DomainBoundsArrayName READ getDomainBoundsArrayName WRITE setDomainBoundsArrayName)
+  PYB11_PROPERTY(QString SnapshotIndexArrayName READ getSnapshotIndexArrayName WRITE setSnapshotIndexArrayName)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -144,6 +153,29 @@ public:
    */
   QString getInputFile() const;
   Q_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
+
+  /**
+   * @brief Setter property for ImportSnapshotSeries
+   */
+  void setImportSnapshotSeries(bool value);
+  /**
+   * @brief Getter property for ImportSnapshotSeries
+   * @return Value of ImportSnapshotSeries
+   */
+  bool getImportSnapshotSeries() const;
+  Q_PROPERTY(bool ImportSnapshotSeries READ getImportSnapshotSeries WRITE setImportSnapshotSeries)
+
+  /**
+   * @brief Setter property for InputFileListInfo
+   */
+  void setInputFileListInfo(const StackFileListInfo& value);
+  /**
+   * @brief Getter property for InputFileListInfo
+   * @return Value of InputFileListInfo
+   */
+  StackFileListInfo getInputFileListInfo() const;
+  Q_PROPERTY(StackFileListInfo InputFileListInfo READ getInputFileListInfo WRITE setInputFileListInfo)
+
   /**
    * @brief Setter property for BurgersVector
    */
@@ -209,6 +241,17 @@ public:
    */
   QString getDomainBoundsArrayName() const;
 
+  /**
+   * @brief Setter property for SnapshotIndexArrayName
+   */
+  void setSnapshotIndexArrayName(const QString& value);
+  /**
+   * @brief Getter property for SnapshotIndexArrayName
+   * @return Value of SnapshotIndexArrayName
+   */
+  QString getSnapshotIndexArrayName() const;
+  Q_PROPERTY(QString SnapshotIndexArrayName READ getSnapshotIndexArrayName WRITE setSnapshotIndexArrayName)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -305,6 +348,12 @@ protected:
    */
   void updateEdgeInstancePointers();
 
+  /**
+   * @brief getSnapshotFiles Returns the files to import, in snapshot order
+   * @return
+   */
+  QVector<QString> getSnapshotFiles();
+
 private:
   std::weak_ptr<DataArray<int32_t>> m_NumberOfArmsPtr;
   int32_t* m_NumberOfArms = nullptr;
@@ -316,24 +365,30 @@ private:
   float* m_SlipPlaneNormals = nullptr;
   std::weak_ptr<DataArray<float>> m_DomainBoundsPtr;
   float* m_DomainBounds = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_VertexSnapshotIndexPtr;
+  int32_t* m_VertexSnapshotIndex = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_EdgeSnapshotIndexPtr;
+  int32_t* m_EdgeSnapshotIndex = nullptr;
 
   DataArrayPath m_EdgeDataContainerName = {SIMPL::Defaults::DataContainerName, "", ""};
   QString m_VertexAttributeMatrixName = {SIMPL::Defaults::VertexAttributeMatrixName};
   QString m_EdgeAttributeMatrixName = {SIMPL::Defaults::EdgeAttributeMatrixName};
   QString m_InputFile = {""};
+  bool m_ImportSnapshotSeries = {false};
+  StackFileListInfo m_InputFileListInfo = {};
   float m_BurgersVector = {2.5};
   QString m_NumberOfArmsArrayName = {SIMPL::VertexData::NumberOfArms};
   QString m_NodeConstraintsArrayName = {SIMPL::VertexData::NodeConstraints};
   QString m_BurgersVectorsArrayName = {SIMPL::EdgeData::BurgersVectors};
   QString m_SlipPlaneNormalsArrayName = {SIMPL::EdgeData::SlipPlaneNormals};
   QString m_DomainBoundsArrayName = {"DomainBounds"};
+  QString m_SnapshotIndexArrayName = {"SnapshotIndex"};
 
-  QFile m_InStream;
-
-  int m_NumVerts;
-  int m_NumEdges;
+  std::unique_ptr<ParaDisParser::SnapshotReader> m_Reader;
+  int32_t m_SnapshotIndex = 0;
 
-  int m_FileVersion;
+  size_t m_NumVerts = 0;
+  size_t m_NumEdges = 0;
 
 public:
   ParaDisReader(const ParaDisReader&) = delete;            // Copy Constructor Not Implemented
@@ -34,6 +34,12 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "PrincipalComponentAnalysis.h"
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
 #include <Eigen/Core>
 #include <Eigen/Eigen>
 
@@ -54,10 +60,239 @@
 #include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
 
+namespace
+{
+/**
+ * @brief Number of tuples gathered from the selected arrays and processed together
+ */
+constexpr size_t k_BlockSize = 4096;
+
+/**
+ * @brief Smallest number of tuples accumulated by one chunk; at most k_MaxChunks chunks are used
+ */
+constexpr size_t k_MinChunkSize = 1 << 16;
+constexpr size_t k_MaxChunks = 64;
+
+/**
+ * @brief Extra sample directions and subspace iterations used by the randomized decomposition
+ */
+constexpr Eigen::Index k_Oversampling = 10;
+constexpr size_t k_PowerIterations = 4;
+constexpr uint64_t k_RandomSeed = 5489;
+
+/**
+ * @brief ColumnReader Casts count values of one selected array, starting at tuple start, to double
+ */
+using ColumnReader = std::function<void(size_t start, size_t count, double* column)>;
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void createColumnReader(IDataArray::Pointer dataPtr, ColumnReader& reader)
+{
+  typename DataArray<T>::Pointer inDataPtr = std::dynamic_pointer_cast<DataArray<T>>(dataPtr);
+  const T* dPtr = inDataPtr->getPointer(0);
+  reader = [dPtr](size_t start, size_t count, double* column) {
+    for(size_t i = 0; i < count; i++)
+    {
+      column[i] = static_cast<double>(dPtr[start + i]);
+    }
+  };
+}
+
+/**
+ * @brief The Moments struct holds the number of tuples, the mean and the co-moment matrix (the sum of the
+ * outer products of the deviations from the mean) of a set of tuples. Two sets are combined with the
+ * pairwise update of Chan, Golub & LeVeque, which stays accurate when the means are large compared to
+ * the spread of the data.
+ */
+struct Moments
+{
+  double count = 0.0;
+  Eigen::VectorXd mean;
+  Eigen::MatrixXd comoment;
+
+  explicit Moments(Eigen::Index numArrays)
+  : mean(Eigen::VectorXd::Zero(numArrays))
+  , comoment(Eigen::MatrixXd::Zero(numArrays, numArrays))
+  {
+  }
+
+  void merge(const Moments& other)
+  {
+    if(other.count == 0.0)
+    {
+      return;
+    }
+    if(count == 0.0)
+    {
+      *this = other;
+      return;
+    }
+    const double total = count + other.count;
+    const Eigen::VectorXd delta = other.mean - mean;
+    comoment += other.comoment + (count * other.count / total) * delta * delta.transpose();
+    mean += (other.count / total) * delta;
+    count = total;
+  }
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief GatherBlock Reads count tuples starting at tuple start into the top rows of block, one column per array
+ */
+void GatherBlock(const std::vector<ColumnReader>& readers, size_t start, size_t count, Eigen::MatrixXd& block)
+{
+  for(size_t j = 0; j < readers.size(); j++)
+  {
+    readers[j](start, count, block.col(static_cast<Eigen::Index>(j)).data());
+  }
+}
+
+/**
+ * @brief The AccumulateMomentsImpl class computes the moments of a fixed chunk of tuples per task. Each block
+ * of a chunk is centered on its own mean before its co-moments are formed and merged into the chunk.
+ */
+class AccumulateMomentsImpl
+{
+public:
+  AccumulateMomentsImpl(const std::vector<ColumnReader>& readers, size_t numTuples, std::vector<Moments>& partials)
+  : m_Readers(readers)
+  , m_NumTuples(numTuples)
+  , m_Partials(partials)
+  {
+  }
+
+  void accumulate(size_t chunkStart, size_t chunkEnd) const
+  {
+    const auto numArrays = static_cast<Eigen::Index>(m_Readers.size());
+    const size_t numChunks = m_Partials.size();
+    Eigen::MatrixXd block(static_cast<Eigen::Index>(k_BlockSize), numArrays);
+    Moments blockMoments(numArrays);
+    for(size_t c = chunkStart; c < chunkEnd; c++)
+    {
+      const size_t first = m_NumTuples * c / numChunks;
+      const size_t last = m_NumTuples * (c + 1) / numChunks;
+      for(size_t start = first; start < last; start += k_BlockSize)
+      {
+        const size_t count = std::min(k_BlockSize, last - start);
+        GatherBlock(m_Readers, start, count, block);
+        auto rows = block.topRows(static_cast<Eigen::Index>(count));
+        blockMoments.count = static_cast<double>(count);
+        blockMoments.mean = rows.colwise().mean().transpose();
+        rows.rowwise() -= blockMoments.mean.transpose();
+        blockMoments.comoment.noalias() = rows.transpose() * rows;
+        m_Partials[c].merge(blockMoments);
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    accumulate(range.min(), range.max());
+  }
+
+private:
+  const std::vector<ColumnReader>& m_Readers;
+  size_t m_NumTuples;
+  std::vector<Moments>& m_Partials;
+};
+
+/**
+ * @brief The ProjectDataSpaceImpl class projects blocks of tuples onto the selected principal components,
+ * centering (and for the correlation approach, scaling) each tuple on the fly
+ */
+class ProjectDataSpaceImpl
+{
+public:
+  ProjectDataSpaceImpl(const std::vector<ColumnReader>& readers, size_t numTuples, const Eigen::VectorXd& mean, const Eigen::VectorXd& scale, const Eigen::MatrixXd& transform, double* projected)
+  : m_Readers(readers)
+  , m_NumTuples(numTuples)
+  , m_Mean(mean)
+  , m_Scale(scale)
+  , m_Transform(transform)
+  , m_Projected(projected)
+  {
+  }
+
+  void project(size_t blockStart, size_t blockEnd) const
+  {
+    using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    const Eigen::Index numDims = m_Transform.cols();
+    Eigen::MatrixXd block(static_cast<Eigen::Index>(k_BlockSize), static_cast<Eigen::Index>(m_Readers.size()));
+    for(size_t b = blockStart; b < blockEnd; b++)
+    {
+      const size_t start = b * k_BlockSize;
+      const size_t count = std::min(k_BlockSize, m_NumTuples - start);
+      GatherBlock(m_Readers, start, count, block);
+      auto rows = block.topRows(static_cast<Eigen::Index>(count));
+      rows.rowwise() -= m_Mean.transpose();
+      rows.array().rowwise() *= m_Scale.transpose().array();
+      Eigen::Map<RowMajorMatrix> out(m_Projected + numDims * start, static_cast<Eigen::Index>(count), numDims);
+      out.noalias() = rows * m_Transform;
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    project(range.min(), range.max());
+  }
+
+private:
+  const std::vector<ColumnReader>& m_Readers;
+  size_t m_NumTuples;
+  const Eigen::VectorXd& m_Mean;
+  const Eigen::VectorXd& m_Scale;
+  const Eigen::MatrixXd& m_Transform;
+  double* m_Projected;
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief findLeadingEigenpairs Approximates the numComponents largest eigenpairs of a symmetric positive
+ * semi-definite matrix by randomized subspace iteration (Halko, Martinsson & Tropp): a random sample of
+ * numComponents + k_Oversampling directions is repeatedly multiplied by the matrix and orthonormalized, and the
+ * matrix is then solved exactly within that subspace. The random directions use a fixed seed, so results are
+ * reproducible. Eigenvalues and eigenvectors are returned in ascending order, as for the full decomposition.
+ */
+void findLeadingEigenpairs(const Eigen::MatrixXd& matrix, int32_t numComponents, Eigen::VectorXd& eigenvalues, Eigen::MatrixXd& eigenvectors)
+{
+  const Eigen::Index size = matrix.rows();
+  const Eigen::Index numSamples = std::min<Eigen::Index>(size, numComponents + k_Oversampling);
+
+  auto orthonormalize = [size, numSamples](const Eigen::MatrixXd& samples) -> Eigen::MatrixXd {
+    Eigen::HouseholderQR<Eigen::MatrixXd> qr(samples);
+    return qr.householderQ() * Eigen::MatrixXd::Identity(size, numSamples);
+  };
+
+  std::mt19937_64 generator(k_RandomSeed);
+  std::normal_distribution<double> distribution(0.0, 1.0);
+  Eigen::MatrixXd basis(size, numSamples);
+  for(Eigen::Index j = 0; j < numSamples; j++)
+  {
+    for(Eigen::Index i = 0; i < size; i++)
+    {
+      basis(i, j) = distribution(generator);
+    }
+  }
+
+  basis = orthonormalize(matrix * basis);
+  for(size_t q = 0; q < k_PowerIterations; q++)
+  {
+    basis = orthonormalize(matrix * basis);
+  }
+
+  Eigen::MatrixXd reduced = basis.transpose() * matrix * basis;
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(reduced);
+  eigenvalues = solver.eigenvalues().tail(numComponents);
+  eigenvectors = basis * solver.eigenvectors().rightCols(numComponents);
+}
+} // namespace
+
 /* Create Enumerations to allow the created Attribute Arrays to take part in renaming */
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -100,6 +335,10 @@ void PrincipalComponentAnalysis::setupFilterParameters()
     choices->setCategory(FilterParameter::Category::Parameter);
     parameters.push_back(choices);
   }
+  std::vector<QString> randomizedProps = {"NumberOfComponents"};
+  parameters.push_back(
+      SIMPL_NEW_LINKED_BOOL_FP("Randomized Truncated Decomposition", RandomizedDecomposition, FilterParameter::Category::Parameter, PrincipalComponentAnalysis, randomizedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Components", NumberOfComponents, FilterParameter::Category::Parameter, PrincipalComponentAnalysis));
   std::vector<QString> linkedProps = {"NumberOfDimensionsForProjection", "ProjectedDataSpaceArrayPath"};
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Project Data Space", ProjectDataSpace, FilterParameter::Category::Parameter, PrincipalComponentAnalysis, linkedProps));
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Dimensions for Projection", NumberOfDimensionsForProjection, FilterParameter::Category::Parameter, PrincipalComponentAnalysis));
@@ -165,6 +404,18 @@ void PrincipalComponentAnalysis::dataCheck()
   }
 
   std::vector<size_t> tDims(1, paths.size());
+  if(getRandomizedDecomposition())
+  {
+    if(getNumberOfComponents() <= 0 || getNumberOfComponents() > paths.size())
+    {
+      QString ss = QObject::tr("Number of components for the randomized decomposition (%1) must be greater than 0 and less than or equal to the number of selected Attribute Arrays (%2)")
+                       .arg(getNumberOfComponents())
+                       .arg(paths.size());
+      setErrorCondition(-11006, ss);
+      return;
+    }
+    tDims[0] = getNumberOfComponents();
+  }
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getSelectedDataArrayPaths().at(0).getDataContainerName());
   m->createNonPrereqAttributeMatrix(this, getPCAttributeMatrixName(), tDims, AttributeMatrix::Type::Generic, AttributeMatrixID21);
@@ -204,6 +455,14 @@ void PrincipalComponentAnalysis::dataCheck()
       setErrorCondition(-11005, ss);
     }
 
+    if(getRandomizedDecomposition() && getNumberOfDimensionsForProjection() > getNumberOfComponents())
+    {
+      QString ss = QObject::tr("Number of dimensions for the projected space (%1) must be less than or equal to the number of components for the randomized decomposition (%2)")
+                       .arg(getNumberOfDimensionsForProjection())
+                       .arg(getNumberOfComponents());
+      setErrorCondition(-11007, ss);
+    }
+
     cDims[0] = getNumberOfDimensionsForProjection();
 
     m_ProjectedDataSpacePtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>>(this, getProjectedDataSpaceArrayPath(), 0, cDims, "", DataArrayID33);
@@ -220,22 +479,6 @@ void PrincipalComponentAnalysis::dataCheck()
   getDataContainerArray()->validateNumberOfTuples(this, paths);
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename T>
-void copyDataArrays(IDataArray::Pointer dataPtr, std::vector<double>& copy, int32_t arrayIndex)
-{
-  typename DataArray<T>::Pointer inDataPtr = std::dynamic_pointer_cast<DataArray<T>>(dataPtr);
-  T* dPtr = inDataPtr->getPointer(0);
-  size_t numTuples = inDataPtr->getNumberOfTuples();
-
-  for(size_t i = 0; i < numTuples; i++)
-  {
-    copy[numTuples * arrayIndex + i] = static_cast<double>(dPtr[i]);
-  }
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -254,95 +497,94 @@ void PrincipalComponentAnalysis::execute()
     return;
   }
 
-  // Set up our Eigen variables ; we use a dynamic double matrix since we don't know
-  // the number of arrays or their tuples at compile time ; could have just used the
-  // MatrixXd typedef instead of our own, but this is explicit about the ordering
-  // being column major
-  auto numArrays = m_SelectedWeakPtrVector.size();
+  auto numArrays = static_cast<Eigen::Index>(m_SelectedWeakPtrVector.size());
   size_t numTuples = m_SelectedWeakPtrVector[0].lock()->getNumberOfTuples();
 
-  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> CovarianceMatrix;
+  // Read the selected arrays in place through typed readers rather than copying them
+  // into one large matrix; the type dispatch happens once per array
+  std::vector<ColumnReader> readers(numArrays);
+  for(Eigen::Index i = 0; i < numArrays; i++)
+  {
+    EXECUTE_FUNCTION_TEMPLATE(this, createColumnReader, m_SelectedWeakPtrVector[i].lock(), m_SelectedWeakPtrVector[i].lock(), readers[i])
+  }
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  notifyStatusMessage(QObject::tr("Accumulating Covariance..."));
 
-  // Copy the incoming data into a contiguous chunk of memory, casting everything to doubles
-  std::vector<double> inDataVector(numTuples * numArrays, 0);
+  // Each chunk of tuples accumulates its own moments; the chunks are fixed and merged in
+  // order, so the result does not depend on the number of threads
+  const size_t numChunks = std::clamp<size_t>(numTuples / k_MinChunkSize, 1, k_MaxChunks);
+  std::vector<Moments> partials(numChunks, Moments(numArrays));
+  ParallelDataAlgorithm momentsAlg;
+  momentsAlg.setRange(0, numChunks);
+  momentsAlg.setGrain(1);
+  momentsAlg.execute(AccumulateMomentsImpl(readers, numTuples, partials));
 
-  for(auto i = 0; i < numArrays; i++)
+  Moments moments(numArrays);
+  for(const Moments& partial : partials)
   {
-    EXECUTE_FUNCTION_TEMPLATE(this, copyDataArrays, m_SelectedWeakPtrVector[i].lock(), m_SelectedWeakPtrVector[i].lock(), inDataVector, i)
+    moments.merge(partial);
   }
 
-  // Interface our CovarianceMatrix typedef with our contiguous array in memory
-  // Using a colum major matrix, so each array is a column, so the arrays should
-  // be layed out end-to-end in memory ; initialization for sizes in Eigen is:
-  // numRows x numColumns
-  Eigen::Map<CovarianceMatrix> dataMat(inDataVector.data(), numTuples, numArrays);
-
-  // If the correlation approach is being used, the data must be standardize to have
-  // mean 0 and unit variance
+  // Calculate the covariance matrix from the co-moments, checking if tuples are 1 to avoid
+  // division by zero. If the correlation approach is being used, the data are standardized
+  // to have mean 0 and unit (population) variance, which scales each co-moment by the
+  // standard deviations of its two arrays
+  const double denominator = (numTuples == 1) ? 1.0 : static_cast<double>(numTuples - 1);
+  Eigen::MatrixXd covMat = moments.comoment / denominator;
+  Eigen::VectorXd scale = Eigen::VectorXd::Ones(numArrays);
   if(m_MatrixApproach == 0)
   {
-    // Standardize data to have mean 0 and unit variance
-    dataMat = (dataMat.rowwise() - dataMat.colwise().mean());
-    Eigen::RowVectorXd stdDev = dataMat.colwise().squaredNorm();
-    for(auto i = 0; i < stdDev.cols(); i++)
+    for(Eigen::Index i = 0; i < numArrays; i++)
     {
-      stdDev(i) /= dataMat.rows();
-      stdDev(i) = sqrt(stdDev(i));
+      scale(i) = 1.0 / std::sqrt(moments.comoment(i, i) / static_cast<double>(numTuples));
     }
-    dataMat = dataMat.array().rowwise() / stdDev.array();
+    covMat = scale.asDiagonal() * covMat * scale.asDiagonal();
   }
 
-  // Calculate the covariance matrix using the matrix formulation, checking if
-  // tuples are 1 to avoid division by zero
-  // If correlation was chosen, then this is technically the correlation matrix,
-  // but since the means are zero in that case the centering operation is trivial
-  Eigen::MatrixXd centeredMat = dataMat.rowwise() - dataMat.colwise().mean();
-  Eigen::MatrixXd covMat;
-
-  if(numTuples == 1)
+  // Perform the eigen decomposition to get the eigenvectors and eigenvalues of the covariance
+  // matrix in ascending order, either fully or truncated to the leading components
+  Eigen::VectorXd eigenvalues;
+  Eigen::MatrixXd eigenvectors;
+  if(m_RandomizedDecomposition)
   {
-    covMat = (centeredMat.adjoint() * centeredMat) / (1.0);
+    notifyStatusMessage(QObject::tr("Computing Randomized Decomposition..."));
+    findLeadingEigenpairs(covMat, m_NumberOfComponents, eigenvalues, eigenvectors);
   }
   else
   {
-    covMat = (centeredMat.adjoint() * centeredMat) / (double(numTuples - 1.0));
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> pca(covMat);
+    eigenvalues = pca.eigenvalues();
+    eigenvectors = pca.eigenvectors();
   }
 
-  // Perform the eigen decomposition to get the eigenvectors and eigenvalues
-  // of the covariance matrix, then copy those values into the primary
-  // DataArray pointers
-  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> pca(covMat);
-
-  for(auto i = 0; i < pca.eigenvalues().size(); i++)
+  for(auto i = 0; i < eigenvalues.size(); i++)
   {
-    m_PCEigenvalues[i] = pca.eigenvalues()(i);
+    m_PCEigenvalues[i] = eigenvalues(i);
   }
 
-  for(auto i = 0; i < pca.eigenvectors().cols(); i++)
+  for(auto i = 0; i < eigenvectors.cols(); i++)
   {
-    for(auto j = 0; j < pca.eigenvectors().rows(); j++)
+    for(auto j = 0; j < eigenvectors.rows(); j++)
     {
-      m_PCEigenvectors[pca.eigenvectors().rows() * i + j] = pca.eigenvectors()(j, i);
+      m_PCEigenvectors[eigenvectors.rows() * i + j] = eigenvectors(j, i);
     }
   }
 
   if(m_ProjectDataSpace)
   {
-    // Extract the projective transform
+    notifyStatusMessage(QObject::tr("Projecting Data Space..."));
+
     // Eigen orders the eigenvalues/eigenvectors in ascending order, so just grab
     // the rightmost columns equal to the number of projective dimensions
-    Eigen::MatrixXd transform = pca.eigenvectors().rightCols(m_NumberOfDimensionsForProjection);
+    Eigen::MatrixXd transform = eigenvectors.rightCols(m_NumberOfDimensionsForProjection);
 
-    // Multiply each row in the centered data matrix by transform and copy the projected
-    // points into the DataArray pointer
-    for(auto i = 0; i < centeredMat.rows(); i++)
-    {
-      Eigen::VectorXd tmp = centeredMat.row(i) * transform;
-      for(int32_t j = 0; j < m_NumberOfDimensionsForProjection; j++)
-      {
-        m_ProjectedDataSpace[m_NumberOfDimensionsForProjection * i + j] = tmp(j);
-      }
-    }
+    ParallelDataAlgorithm projectAlg;
+    projectAlg.setRange(0, (numTuples + k_BlockSize - 1) / k_BlockSize);
+    projectAlg.execute(ProjectDataSpaceImpl(readers, numTuples, moments.mean, scale, transform, m_ProjectedDataSpace));
   }
 }
 
@@ -507,6 +749,30 @@ int PrincipalComponentAnalysis::getMatrixApproach() const
   return m_MatrixApproach;
 }
 
+// -----------------------------------------------------------------------------
+void PrincipalComponentAnalysis::setRandomizedDecomposition(bool value)
+{
+  m_RandomizedDecomposition = value;
+}
+
+// -----------------------------------------------------------------------------
+bool PrincipalComponentAnalysis::getRandomizedDecomposition() const
+{
+  return m_RandomizedDecomposition;
+}
+
+// -----------------------------------------------------------------------------
+void PrincipalComponentAnalysis::setNumberOfComponents(int value)
+{
+  m_NumberOfComponents = value;
+}
+
+// -----------------------------------------------------------------------------
+int PrincipalComponentAnalysis::getNumberOfComponents() const
+{
+  return m_NumberOfComponents;
+}
+
 // -----------------------------------------------------------------------------
 void PrincipalComponentAnalysis::setProjectDataSpace(bool value)
 {
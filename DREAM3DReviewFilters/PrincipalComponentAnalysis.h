@@ -60,6 +60,8 @@ class DREAM3DReview_EXPORT PrincipalComponentAnalysis : public AbstractFilter
   PYB11_PROPERTY(QString PCEigenvaluesName READ getPCEigenvaluesName WRITE setPCEigenvaluesName)
   PYB11_PROPERTY(QString PCEigenvectorsName READ getPCEigenvectorsName WRITE setPCEigenvectorsName)
   PYB11_PROPERTY(int MatrixApproach READ getMatrixApproach WRITE setMatrixApproach)
+  PYB11_PROPERTY(bool RandomizedDecomposition READ getRandomizedDecomposition WRITE setRandomizedDecomposition)
+  PYB11_PROPERTY(int NumberOfComponents READ getNumberOfComponents WRITE setNumberOfComponents)
   PYB11_PROPERTY(bool ProjectDataSpace READ getProjectDataSpace WRITE setProjectDataSpace)
   PYB11_PROPERTY(int NumberOfDimensionsForProjection READ getNumberOfDimensionsForProjection WRITE setNumberOfDimensionsForProjection)
   PYB11_PROPERTY(DataArrayPath ProjectedDataSpaceArrayPath READ getProjectedDataSpaceArrayPath WRITE setProjectedDataSpaceArrayPath)
@@ -142,6 +144,28 @@ public:
   int getMatrixApproach() const;
   Q_PROPERTY(int MatrixApproach READ getMatrixApproach WRITE setMatrixApproach)
 
+  /**
+   * @brief Setter property for RandomizedDecomposition
+   */
+  void setRandomizedDecomposition(bool value);
+  /**
+   * @brief Getter property for RandomizedDecomposition
+   * @return Value of RandomizedDecomposition
+   */
+  bool getRandomizedDecomposition() const;
+  Q_PROPERTY(bool RandomizedDecomposition READ getRandomizedDecomposition WRITE setRandomizedDecomposition)
+
+  /**
+   * @brief Setter property for NumberOfComponents
+   */
+  void setNumberOfComponents(int value);
+  /**
+   * @brief Getter property for NumberOfComponents
+   * @return Value of NumberOfComponents
+   */
+  int getNumberOfComponents() const;
+  Q_PROPERTY(int NumberOfComponents READ getNumberOfComponents WRITE setNumberOfComponents)
+
   /**
    * @brief Setter property for ProjectDataSpace
    */
@@ -256,6 +280,8 @@ private:
   QString m_PCEigenvaluesName = {"PrincipalComponentEigenvalues"};
   QString m_PCEigenvectorsName = {"PrincipalComponentEigenvectors"};
   int m_MatrixApproach = {0};
+  bool m_RandomizedDecomposition = {false};
+  int m_NumberOfComponents = {3};
   bool m_ProjectDataSpace = {false};
   int m_NumberOfDimensionsForProjection = {0};
   DataArrayPath m_ProjectedDataSpaceArrayPath = {"", "", "ProjectedDataSpace"};
@@ -14,7 +14,9 @@
 
 #include "ReadBinaryCTNorthStar.h"
 
+#include <algorithm>
 #include <tuple>
+#include <type_traits>
 
 #include <QtCore/QDir>
 #include <QtCore/QFileInfo>
@@ -26,16 +28,188 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
+#include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/PreflightUpdatedValueFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/ParallelTaskAlgorithm.h"
 
 #include "DREAM3DReview/DREAM3DReviewConstants.h"
 #include "DREAM3DReview/DREAM3DReviewVersion.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/CTReaderHelpers.hpp"
+
+namespace
+{
+// Upper bound on the number of voxels read by a single fread call. Keeps the
+// staging buffer used for type reduction small and lets a cancel be noticed.
+constexpr size_t k_MaxElementsPerRead = 16 * 1024 * 1024;
+
+/**
+ * @brief The NorthStarFileRegion struct describes which part of the imported volume a single .nsidat file covers
+ */
+struct NorthStarFileRegion
+{
+  QString filePath;
+  size_t firstZ = 0;    // First global Z slice stored in the file
+  size_t numSlices = 0; // Number of Z slices stored in the file
+};
+
+/**
+ * @brief The ReadNorthStarFileImpl class reads the portion of one .nsidat file that lies inside the
+ * imported volume. Contiguous runs of voxels (whole slabs when the full XY extent is imported, whole
+ * rows-of-rows when the full X extent is imported) are read with a single fread. Each file maps to a
+ * disjoint Z range of the destination, so instances for different files can run concurrently.
+ */
+template <typename T>
+class ReadNorthStarFileImpl
+{
+public:
+  ReadNorthStarFileImpl(AbstractFilter* filter, const NorthStarFileRegion& region, const SizeVec3Type& origDims, const SizeVec3Type& importedDims, const IntVec3Type& start, const IntVec3Type& end,
+                        T* destination, float windowMin, float windowMax, std::pair<int32_t, QString>& result)
+  : m_Filter(filter)
+  , m_Region(region)
+  , m_OrigDims(origDims)
+  , m_ImportedDims(importedDims)
+  , m_Start(start)
+  , m_End(end)
+  , m_Destination(destination)
+  , m_Converter(windowMin, windowMax)
+  , m_Result(result)
+  {
+  }
+
+  void operator()() const
+  {
+    size_t zBegin = std::max(m_Region.firstZ, static_cast<size_t>(m_Start[2]));
+    size_t zEnd = std::min(m_Region.firstZ + m_Region.numSlices, static_cast<size_t>(m_End[2]) + 1);
+    if(zBegin >= zEnd)
+    {
+      return;
+    }
+
+    FILE* f = fopen(m_Region.filePath.toLatin1().data(), "rb");
+    if(nullptr == f)
+    {
+      m_Result = {-38706, QObject::tr("Error opening binary input file: %1").arg(m_Region.filePath)};
+      return;
+    }
+    ScopedFileMonitor monitor(f);
+
+    const size_t dimX = m_OrigDims[0];
+    const size_t dimY = m_OrigDims[1];
+    const size_t deltaX = m_ImportedDims[0];
+    const size_t deltaY = m_ImportedDims[1];
+    const size_t x0 = static_cast<size_t>(m_Start[0]);
+    const size_t y0 = static_cast<size_t>(m_Start[1]);
+    const size_t z0 = static_cast<size_t>(m_Start[2]);
+
+    const bool fullRows = (deltaX == dimX);
+    const bool fullSlices = fullRows && (deltaY == dimY);
+
+    std::vector<float> staging;
+    if constexpr(!std::is_same_v<T, float>)
+    {
+      size_t runLength = fullSlices ? (zEnd - zBegin) * dimX * dimY : (fullRows ? deltaY * dimX : deltaX);
+      staging.resize(std::min(runLength, k_MaxElementsPerRead));
+    }
+
+    int64_t filePosition = -1;
+    auto fileOffset = [&](size_t z, size_t y, size_t x) -> int64_t {
+      return static_cast<int64_t>((((z - m_Region.firstZ) * dimY + y) * dimX + x) * sizeof(float));
+    };
+    auto destOffset = [&](size_t z, size_t y) -> size_t { return ((z - z0) * deltaY + (y - y0)) * deltaX; };
+
+    if(fullSlices)
+    {
+      readRun(f, filePosition, fileOffset(zBegin, 0, 0), destOffset(zBegin, y0), (zEnd - zBegin) * dimX * dimY, staging);
+      return;
+    }
+
+    for(size_t z = zBegin; z < zEnd && m_Result.first >= 0; z++)
+    {
+      if(m_Filter->getCancel())
+      {
+        return;
+      }
+      if(fullRows)
+      {
+        readRun(f, filePosition, fileOffset(z, y0, 0), destOffset(z, y0), deltaY * dimX, staging);
+        continue;
+      }
+      for(size_t y = y0; y < y0 + deltaY && m_Result.first >= 0; y++)
+      {
+        readRun(f, filePosition, fileOffset(z, y, x0), destOffset(z, y), deltaX, staging);
+      }
+    }
+  }
+
+private:
+  AbstractFilter* m_Filter = nullptr;
+  NorthStarFileRegion m_Region;
+  SizeVec3Type m_OrigDims;
+  SizeVec3Type m_ImportedDims;
+  IntVec3Type m_Start;
+  IntVec3Type m_End;
+  T* m_Destination = nullptr;
+  CTReaderHelpers::DensityConverter<T> m_Converter;
+  std::pair<int32_t, QString>& m_Result;
+
+  /**
+   * @brief readRun Reads count contiguous voxels starting at the given byte offset into the
+   * destination, seeking only when the file is not already positioned there.
+   */
+  void readRun(FILE* f, int64_t& filePosition, int64_t offset, size_t destIndex, size_t count, std::vector<float>& staging) const
+  {
+    if(filePosition != offset)
+    {
+      if(CTReaderHelpers::SeekFile(f, offset) != 0)
+      {
+        m_Result = {-38707, QObject::tr("Could not seek to postion %1 in file %2").arg(offset).arg(m_Region.filePath)};
+        return;
+      }
+      filePosition = offset;
+    }
+
+    while(count > 0)
+    {
+      if(m_Filter->getCancel())
+      {
+        return;
+      }
+      size_t numElements = std::min(count, k_MaxElementsPerRead);
+      T* dest = m_Destination + destIndex;
+      // Float output is read straight into the destination; reduced types go through the staging buffer
+      float* buffer = nullptr;
+      if constexpr(std::is_same_v<T, float>)
+      {
+        buffer = dest;
+      }
+      else
+      {
+        buffer = staging.data();
+      }
+      if(fread(buffer, sizeof(float), numElements, f) != numElements)
+      {
+        m_Result = {-38708, QObject::tr("Error reading file at position %1 in file %2").arg(filePosition).arg(m_Region.filePath)};
+        return;
+      }
+      if constexpr(!std::is_same_v<T, float>)
+      {
+        m_Converter.convert(buffer, dest, numElements);
+      }
+      filePosition += static_cast<int64_t>(numElements * sizeof(float));
+      destIndex += numElements;
+      count -= numElements;
+    }
+  }
+};
+
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -82,6 +256,23 @@ void ReadBinaryCTNorthStar::setupFilterParameters()
   param->setReadOnly(true);
   parameters.push_back(param);
 
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Output Data Type");
+    parameter->setPropertyName("OutputDataType");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ReadBinaryCTNorthStar, this, OutputDataType));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ReadBinaryCTNorthStar, this, OutputDataType));
+    std::vector<QString> choices = {"float", "uint16_t", "uint8_t"};
+    parameter->setChoices(choices);
+    std::vector<QString> linkedProps = {"DensityWindowMin", "DensityWindowMax"};
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_FLOAT_FP("Density Window Minimum", DensityWindowMin, FilterParameter::Category::Parameter, ReadBinaryCTNorthStar, {CTReaderHelpers::k_UInt16Output, CTReaderHelpers::k_UInt8Output}));
+  parameters.push_back(SIMPL_NEW_FLOAT_FP("Density Window Maximum", DensityWindowMax, FilterParameter::Category::Parameter, ReadBinaryCTNorthStar, {CTReaderHelpers::k_UInt16Output, CTReaderHelpers::k_UInt8Output}));
+
   setFilterParameters(parameters);
 }
 
@@ -187,6 +378,17 @@ void ReadBinaryCTNorthStar::dataCheck()
       setErrorCondition(-38718, ss);
     }
   }
+
+  if(getOutputDataType() < CTReaderHelpers::k_Float32Output || getOutputDataType() > CTReaderHelpers::k_UInt8Output)
+  {
+    QString ss = QObject::tr("Invalid selection for the output data type");
+    setErrorCondition(-38719, ss);
+  }
+  else if(getOutputDataType() != CTReaderHelpers::k_Float32Output && getDensityWindowMax() <= getDensityWindowMin())
+  {
+    QString ss = QObject::tr("Density Window Maximum must be greater than Density Window Minimum (%1 <= %2)").arg(getDensityWindowMax()).arg(getDensityWindowMin());
+    setErrorCondition(-38720, ss);
+  }
   if(getErrorCode() < 0)
   {
     return;
@@ -228,10 +430,17 @@ void ReadBinaryCTNorthStar::dataCheck()
 
   DataArrayPath path(getDataContainerName(), getCellAttributeMatrixName(), getDensityArrayName());
 
-  m_DensityPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, path, 0, cDims);
-  if(nullptr != m_DensityPtr.lock())
+  switch(getOutputDataType())
   {
-    m_Density = m_DensityPtr.lock()->getPointer(0);
+  case CTReaderHelpers::k_UInt16Output:
+    m_DensityPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint16_t>>(this, path, 0, cDims);
+    break;
+  case CTReaderHelpers::k_UInt8Output:
+    m_DensityPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint8_t>>(this, path, 0, cDims);
+    break;
+  default:
+    m_DensityPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>>(this, path, 0, cDims);
+    break;
   }
 }
 
@@ -257,21 +466,39 @@ int32_t ReadBinaryCTNorthStar::sanityCheckFileSizeVersusAllocatedSize(size_t all
 // -----------------------------------------------------------------------------
 int32_t ReadBinaryCTNorthStar::readBinaryCTFiles()
 {
+  switch(getOutputDataType())
+  {
+  case CTReaderHelpers::k_UInt16Output:
+    return readBinaryCTFilesAs<uint16_t>();
+  case CTReaderHelpers::k_UInt8Output:
+    return readBinaryCTFilesAs<uint8_t>();
+  default:
+    return readBinaryCTFilesAs<float>();
+  }
+}
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+int32_t ReadBinaryCTNorthStar::readBinaryCTFilesAs()
+{
   SizeVec3Type origDims = m_OriginalVolume->getDimensions();
   SizeVec3Type importedDims = m_ImportedVolume->getDimensions();
 
-  size_t deltaX = m_EndVoxelCoord[0] - m_StartVoxelCoord[0] + 1;
+  auto densityPtr = std::dynamic_pointer_cast<DataArray<T>>(m_DensityPtr.lock());
+  if(nullptr == densityPtr)
+  {
+    QString ss = QObject::tr("Density array %1 is not of the expected type").arg(getDensityArrayName());
+    setErrorCondition(-38709, ss);
+    return getErrorCode();
+  }
+  T* destination = densityPtr->getPointer(0);
 
-  int32_t error = 0;
+  // Validate every file up front so a short file is reported before any threads start
+  std::vector<NorthStarFileRegion> regions;
+  regions.reserve(m_DataFiles.size());
   size_t zShift = 0;
-  int32_t fileIndex = 1;
-
-  auto densityPtr = m_DensityPtr.lock();
-  FloatArrayType& density = *densityPtr;
-  density.initializeWithValue(0xABCDEF);
-  float* ptr = density.getPointer(0);
-
   for(const auto& dataFileInput : m_DataFiles)
   {
     QFileInfo fi(dataFileInput.first);
@@ -279,9 +506,7 @@ int32_t ReadBinaryCTNorthStar::readBinaryCTFiles()
     // allocated bytes should be the x * y dims * number of slices in the current data file....not necessarily the size of the whole density array
     size_t allocatedBytes = origDims[0] * origDims[1] * dataFileInput.second * sizeof(float);
 
-    error = sanityCheckFileSizeVersusAllocatedSize(allocatedBytes, filesize);
-
-    if(error < 0)
+    if(sanityCheckFileSizeVersusAllocatedSize(allocatedBytes, filesize) < 0)
     {
       QString msg;
       QTextStream ss(&msg);
@@ -290,67 +515,35 @@ int32_t ReadBinaryCTNorthStar::readBinaryCTFiles()
       return getErrorCode();
     }
 
-    FILE* f = fopen(dataFileInput.first.toLatin1().data(), "rb");
-    if(nullptr == f)
-    {
-      QString ss = QObject::tr("Error opening binary input file: %1").arg(dataFileInput.first);
-      setErrorCondition(-38706, ss);
-      return getErrorCode();
-    }
-
-    ScopedFileMonitor monitor(f);
-
-    size_t fileZSlice = 0;
-    size_t index = 0;
-
-    for(size_t z = zShift; z < (zShift + dataFileInput.second); z++)
-    {
-      if(m_ImportSubvolume && (z < m_StartVoxelCoord[2] || z > m_EndVoxelCoord[2]))
-      {
-        fileZSlice++;
-        continue;
-      }
-      QString ss = QObject::tr("Importing Data || Data File: %1 || Importing Slice %2").arg(dataFileInput.first).arg(z);
-      notifyStatusMessage(ss);
-      for(size_t y = 0; y < origDims[1]; y++)
-      {
-        if(m_ImportSubvolume && (y < m_StartVoxelCoord[1] || y > m_EndVoxelCoord[1]))
-        {
-          continue;
-        }
+    NorthStarFileRegion region;
+    region.filePath = dataFileInput.first;
+    region.firstZ = zShift;
+    region.numSlices = static_cast<size_t>(dataFileInput.second);
+    regions.push_back(region);
+    zShift += dataFileInput.second;
+  }
 
-        size_t fpOffset = ((origDims[1] * origDims[0] * fileZSlice) + (origDims[0] * y) + m_StartVoxelCoord[0]) * sizeof(float);
-        if(fseek(f, fpOffset, SEEK_SET) != 0)
-        {
-          ss = QObject::tr("Could not seek to postion %1 in file %2").arg(fpOffset).arg(dataFileInput.first);
-          setErrorCondition(-38707, ss);
-          fclose(f);
-          return getErrorCode();
-        }
+  notifyStatusMessage(QObject::tr("Importing Data || Reading %1 Data File(s)").arg(regions.size()));
 
-        index = (importedDims[0] * importedDims[1] * (z - m_StartVoxelCoord[2])) + (importedDims[0] * (y - m_StartVoxelCoord[1])) + (0);
-        ptr = density.getPointer(index);
-        if(fread(ptr, sizeof(float), deltaX, f) != deltaX)
-        {
-          ss = QObject::tr("Error reading file at position %1 in file %2").arg(fpOffset).arg(dataFileInput.first);
-          setErrorCondition(-387008, ss);
-          fclose(f);
-          return getErrorCode();
-        }
-      }
-      fileZSlice++;
-    }
-    zShift += dataFileInput.second;
-    fileIndex++;
-    fclose(f);
+  std::vector<std::pair<int32_t, QString>> results(regions.size(), {0, QString()});
+  ParallelTaskAlgorithm taskRunner;
+  taskRunner.setParallelizationEnabled(true);
+  for(size_t i = 0; i < regions.size(); i++)
+  {
+    taskRunner.execute(ReadNorthStarFileImpl<T>(this, regions[i], origDims, importedDims, m_StartVoxelCoord, m_EndVoxelCoord, destination, m_DensityWindowMin, m_DensityWindowMax, results[i]));
+  }
+  taskRunner.wait();
 
-    if(getCancel())
+  for(const auto& result : results)
+  {
+    if(result.first < 0)
     {
-      break;
+      setErrorCondition(result.first, result.second);
+      return getErrorCode();
     }
   }
 
-  return error;
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -821,6 +1014,42 @@ IntVec3Type ReadBinaryCTNorthStar::getEndVoxelCoord() const
   return m_EndVoxelCoord;
 }
 
+// -----------------------------------------------------------------------------
+void ReadBinaryCTNorthStar::setOutputDataType(int32_t value)
+{
+  m_OutputDataType = value;
+}
+
+// -----------------------------------------------------------------------------
+int32_t ReadBinaryCTNorthStar::getOutputDataType() const
+{
+  return m_OutputDataType;
+}
+
+// -----------------------------------------------------------------------------
+void ReadBinaryCTNorthStar::setDensityWindowMin(float value)
+{
+  m_DensityWindowMin = value;
+}
+
+// -----------------------------------------------------------------------------
+float ReadBinaryCTNorthStar::getDensityWindowMin() const
+{
+  return m_DensityWindowMin;
+}
+
+// -----------------------------------------------------------------------------
+void ReadBinaryCTNorthStar::setDensityWindowMax(float value)
+{
+  m_DensityWindowMax = value;
+}
+
+// -----------------------------------------------------------------------------
+float ReadBinaryCTNorthStar::getDensityWindowMax() const
+{
+  return m_DensityWindowMax;
+}
+
 // -----------------------------------------------------------------------------
 void ReadBinaryCTNorthStar::setImportSubvolume(bool value)
 {
@@ -77,6 +77,9 @@ class DREAM3DReview_EXPORT ReadBinaryCTNorthStar : public AbstractFilter
   PYB11_PROPERTY(bool ImportSubvolume READ getImportSubvolume WRITE setImportSubvolume)
   PYB11_PROPERTY(IntVec3Type StartVoxelCoord READ getStartVoxelCoord WRITE setStartVoxelCoord)
   PYB11_PROPERTY(IntVec3Type EndVoxelCoord READ getEndVoxelCoord WRITE setEndVoxelCoord)
+  PYB11_PROPERTY(int32_t OutputDataType READ getOutputDataType WRITE setOutputDataType)
+  PYB11_PROPERTY(float DensityWindowMin READ getDensityWindowMin WRITE setDensityWindowMin)
+  PYB11_PROPERTY(float DensityWindowMax READ getDensityWindowMax WRITE setDensityWindowMax)
   PYB11_PROPERTY(QString VolumeDescription READ getVolumeDescription)
   PYB11_PROPERTY(QString DataFileInfo READ getDataFileInfo)
   PYB11_PROPERTY(QString ImportedVolumeDescription READ getImportedVolumeDescription)
@@ -193,6 +196,39 @@ public:
   IntVec3Type getEndVoxelCoord() const;
   Q_PROPERTY(IntVec3Type EndVoxelCoord READ getEndVoxelCoord WRITE setEndVoxelCoord)
 
+  /**
+   * @brief Setter property for OutputDataType
+   */
+  void setOutputDataType(int32_t value);
+  /**
+   * @brief Getter property for OutputDataType
+   * @return Value of OutputDataType
+   */
+  int32_t getOutputDataType() const;
+  Q_PROPERTY(int32_t OutputDataType READ getOutputDataType WRITE setOutputDataType)
+
+  /**
+   * @brief Setter property for DensityWindowMin
+   */
+  void setDensityWindowMin(float value);
+  /**
+   * @brief Getter property for DensityWindowMin
+   * @return Value of DensityWindowMin
+   */
+  float getDensityWindowMin() const;
+  Q_PROPERTY(float DensityWindowMin READ getDensityWindowMin WRITE setDensityWindowMin)
+
+  /**
+   * @brief Setter property for DensityWindowMax
+   */
+  void setDensityWindowMax(float value);
+  /**
+   * @brief Getter property for DensityWindowMax
+   * @return Value of DensityWindowMax
+   */
+  float getDensityWindowMax() const;
+  Q_PROPERTY(float DensityWindowMax READ getDensityWindowMax WRITE setDensityWindowMax)
+
   /**
    * @brief getNewBoxDimensions
    * @return
@@ -282,11 +318,19 @@ protected:
   int32_t sanityCheckFileSizeVersusAllocatedSize(size_t allocatedBytes, size_t fileSize);
 
   /**
-   * @brief readBinaryCTFile Reads the raw binary CT file
+   * @brief readBinaryCTFiles Reads the raw binary CT files. Each data file covers a disjoint
+   * range of Z slices, so the files are read concurrently into their own destination ranges.
    * @return Integer error code
    */
   int32_t readBinaryCTFiles();
 
+  /**
+   * @brief readBinaryCTFilesAs Typed implementation of readBinaryCTFiles
+   * @return Integer error code
+   */
+  template <typename T>
+  int32_t readBinaryCTFilesAs();
+
   /**
    * @brief readHeaderMetaData Reads the number of voxels and voxel extents
    * from the NSI header file
@@ -304,13 +348,16 @@ protected:
   void initialize();
 
 private:
-  std::weak_ptr<DataArray<float>> m_DensityPtr;
-  float* m_Density = nullptr;
+  IDataArray::WeakPointer m_DensityPtr;
 
   bool m_ImportSubvolume = {false};
   IntVec3Type m_StartVoxelCoord = {0, 0, 0};
   IntVec3Type m_EndVoxelCoord = {1, 1, 1};
 
+  int32_t m_OutputDataType = {0}; // 0 = float32, 1 = uint16, 2 = uint8
+  float m_DensityWindowMin = {0.0f};
+  float m_DensityWindowMax = {1.0f};
+
   std::vector<std::pair<QString, int64_t>> m_DataFiles;
   QString m_InputHeaderFile = {};
   QString m_DataContainerName = {"CT DataContainer"};
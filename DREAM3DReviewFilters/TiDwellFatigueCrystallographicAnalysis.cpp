@@ -36,9 +36,14 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "TiDwellFatigueCrystallographicAnalysis.h"
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/SIMPLRange.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -51,13 +56,11 @@
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
-#include "SIMPLib/Filtering/FilterFactory.hpp"
-#include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
 #include "SIMPLib/Math/SIMPLibRandom.h"
-#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 #include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/Core/OrientationTransformation.hpp"
@@ -77,8 +80,405 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID35 = 35,
   DataArrayID36 = 36,
   DataArrayID37 = 37,
+  DataArrayID38 = 38,
+  DataArrayID39 = 39,
+  DataArrayID40 = 40,
+};
+
+namespace
+{
+/**
+ * @brief The FeatureGraph struct is a compressed sparse row adjacency list over feature IDs; the neighbors of
+ * feature f are neighbors[begins[f]] .. neighbors[ends[f] - 1]. If areas is not empty, it holds the shared
+ * surface area of each edge at the same index as its neighbor.
+ */
+struct FeatureGraph
+{
+  std::vector<size_t> begins;
+  std::vector<size_t> ends;
+  std::vector<int32_t> neighbors;
+  std::vector<float> areas;
+};
+
+/**
+ * @brief The CopyNeighborListImpl class copies a feature neighbor list into the preallocated rows of a
+ * FeatureGraph, in parallel over features
+ */
+class CopyNeighborListImpl
+{
+public:
+  CopyNeighborListImpl(NeighborList<int>& neighborList, NeighborList<float>* areaList, FeatureGraph& graph)
+  : m_NeighborList(neighborList)
+  , m_AreaList(areaList)
+  , m_Graph(graph)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t f = range.min(); f < range.max(); f++)
+    {
+      const std::vector<int>& list = m_NeighborList[f];
+      std::copy(list.begin(), list.end(), m_Graph.neighbors.begin() + m_Graph.begins[f]);
+      if(m_AreaList != nullptr)
+      {
+        const std::vector<float>& areas = (*m_AreaList)[f];
+        std::copy(areas.begin(), areas.end(), m_Graph.areas.begin() + m_Graph.begins[f]);
+      }
+    }
+  }
+
+private:
+  NeighborList<int>& m_NeighborList;
+  NeighborList<float>* m_AreaList;
+  FeatureGraph& m_Graph;
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief CopyNeighborList Returns a FeatureGraph holding the same lists as neighborList, along with the
+ * shared surface areas in areaList if it is not null. Each area list must be as long as its neighbor list.
+ */
+FeatureGraph CopyNeighborList(NeighborList<int>& neighborList, NeighborList<float>* areaList, size_t numFeatures)
+{
+  FeatureGraph graph;
+  graph.begins.resize(numFeatures);
+  graph.ends.resize(numFeatures);
+  size_t offset = 0;
+  for(size_t f = 0; f < numFeatures; f++)
+  {
+    graph.begins[f] = offset;
+    offset += neighborList[f].size();
+    graph.ends[f] = offset;
+  }
+  graph.neighbors.resize(offset);
+  if(areaList != nullptr)
+  {
+    graph.areas.resize(offset);
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numFeatures);
+  dataAlg.execute(CopyNeighborListImpl(neighborList, areaList, graph));
+  return graph;
+}
+
+/**
+ * @brief The ConcurrentUnionFind class is a disjoint set forest safe to update from several threads. Roots
+ * are always linked beneath the smaller root, so each set is represented by its smallest member.
+ */
+class ConcurrentUnionFind
+{
+public:
+  explicit ConcurrentUnionFind(size_t size)
+  : m_Parents(size)
+  {
+    for(size_t i = 0; i < size; i++)
+    {
+      m_Parents[i].store(static_cast<int32_t>(i), std::memory_order_relaxed);
+    }
+  }
+
+  int32_t find(int32_t x) const
+  {
+    int32_t parent = m_Parents[x].load();
+    while(parent != x)
+    {
+      // Path halving; a failed exchange only means another thread already shortened the path
+      const int32_t grandParent = m_Parents[parent].load();
+      m_Parents[x].compare_exchange_weak(parent, grandParent);
+      x = grandParent;
+      parent = m_Parents[x].load();
+    }
+    return x;
+  }
+
+  void unite(int32_t a, int32_t b)
+  {
+    while(true)
+    {
+      a = find(a);
+      b = find(b);
+      if(a == b)
+      {
+        return;
+      }
+      int32_t high = std::max(a, b);
+      const int32_t low = std::min(a, b);
+      // Only link high if it is still a root; otherwise retry from the new roots
+      if(m_Parents[high].compare_exchange_strong(high, low))
+      {
+        return;
+      }
+    }
+  }
+
+private:
+  mutable std::vector<std::atomic<int32_t>> m_Parents;
+};
+
+/**
+ * @brief The UniteFlaggedNeighborsImpl class joins every pair of neighboring features that are both hard or
+ * both soft, in parallel over features
+ */
+class UniteFlaggedNeighborsImpl
+{
+public:
+  UniteFlaggedNeighborsImpl(const FeatureGraph& graph, const bool* hardFeatures, const bool* softFeatures, size_t numFeatures, ConcurrentUnionFind& groups)
+  : m_Graph(graph)
+  , m_HardFeatures(hardFeatures)
+  , m_SoftFeatures(softFeatures)
+  , m_NumFeatures(numFeatures)
+  , m_Groups(groups)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t f = range.min(); f < range.max(); f++)
+    {
+      if(!m_HardFeatures[f] && !m_SoftFeatures[f])
+      {
+        continue;
+      }
+      for(size_t j = m_Graph.begins[f]; j < m_Graph.ends[f]; j++)
+      {
+        const int32_t neighbor = m_Graph.neighbors[j];
+        if(neighbor <= 0 || static_cast<size_t>(neighbor) >= m_NumFeatures)
+        {
+          continue;
+        }
+        if((m_HardFeatures[f] && m_HardFeatures[neighbor]) || (m_SoftFeatures[f] && m_SoftFeatures[neighbor]))
+        {
+          m_Groups.unite(static_cast<int32_t>(f), neighbor);
+        }
+      }
+    }
+  }
+
+private:
+  const FeatureGraph& m_Graph;
+  const bool* m_HardFeatures;
+  const bool* m_SoftFeatures;
+  size_t m_NumFeatures;
+  ConcurrentUnionFind& m_Groups;
+};
+
+/**
+ * @brief The AssignFeatureParentsImpl class sets the parent of each grouped feature to the smallest feature
+ * of its group; the smallest feature itself and ungrouped features keep a parent of -1
+ */
+class AssignFeatureParentsImpl
+{
+public:
+  AssignFeatureParentsImpl(const ConcurrentUnionFind& groups, int32_t* featureParentIds)
+  : m_Groups(groups)
+  , m_FeatureParentIds(featureParentIds)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t f = range.min(); f < range.max(); f++)
+    {
+      const int32_t root = m_Groups.find(static_cast<int32_t>(f));
+      m_FeatureParentIds[f] = (static_cast<size_t>(root) != f) ? root : -1;
+    }
+  }
+
+private:
+  const ConcurrentUnionFind& m_Groups;
+  int32_t* m_FeatureParentIds;
+};
+
+/**
+ * @brief The MapCellParentIdsImpl class writes the parent of each cell's feature, or the feature itself if it
+ * is not grouped, in parallel over cells
+ */
+class MapCellParentIdsImpl
+{
+public:
+  MapCellParentIdsImpl(const int32_t* featureIds, const int32_t* featureParentIds, int32_t* cellParentIds)
+  : m_FeatureIds(featureIds)
+  , m_FeatureParentIds(featureParentIds)
+  , m_CellParentIds(cellParentIds)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      const int32_t parentId = m_FeatureParentIds[m_FeatureIds[i]];
+      m_CellParentIds[i] = (parentId != -1) ? parentId : m_FeatureIds[i];
+    }
+  }
+
+private:
+  const int32_t* m_FeatureIds;
+  const int32_t* m_FeatureParentIds;
+  int32_t* m_CellParentIds;
+};
+
+/**
+ * @brief The ContractGraphImpl class builds the neighbors of each parent as the sorted, unique parents of the
+ * neighbors of its member features, excluding itself. When the child graph carries areas, the areas of all
+ * child edges that collapse onto the same parent edge are summed. The row of each parent is preallocated with
+ * room for every member's neighbors, so parents are processed independently in parallel.
+ */
+class ContractGraphImpl
+{
+public:
+  ContractGraphImpl(const FeatureGraph& childGraph, const std::vector<size_t>& memberOffsets, const std::vector<int32_t>& members, const std::vector<int32_t>& labels, FeatureGraph& parentGraph)
+  : m_ChildGraph(childGraph)
+  , m_MemberOffsets(memberOffsets)
+  , m_Members(members)
+  , m_Labels(labels)
+  , m_ParentGraph(parentGraph)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    const size_t numFeatures = m_Labels.size();
+    for(size_t parent = range.min(); parent < range.max(); parent++)
+    {
+      if(m_ChildGraph.areas.empty())
+      {
+        contractNeighbors(parent, numFeatures);
+      }
+      else
+      {
+        contractNeighborsAndAreas(parent, numFeatures);
+      }
+    }
+  }
+
+private:
+  void contractNeighbors(size_t parent, size_t numFeatures) const
+  {
+    const auto rowBegin = m_ParentGraph.neighbors.begin() + m_ParentGraph.begins[parent];
+    auto rowEnd = rowBegin;
+    for(size_t m = m_MemberOffsets[parent]; m < m_MemberOffsets[parent + 1]; m++)
+    {
+      const int32_t member = m_Members[m];
+      for(size_t j = m_ChildGraph.begins[member]; j < m_ChildGraph.ends[member]; j++)
+      {
+        const int32_t neighbor = m_ChildGraph.neighbors[j];
+        if(neighbor <= 0 || static_cast<size_t>(neighbor) >= numFeatures)
+        {
+          continue;
+        }
+        const int32_t neighborParent = m_Labels[neighbor];
+        if(static_cast<size_t>(neighborParent) != parent)
+        {
+          *rowEnd++ = neighborParent;
+        }
+      }
+    }
+    std::sort(rowBegin, rowEnd);
+    rowEnd = std::unique(rowBegin, rowEnd);
+    m_ParentGraph.ends[parent] = m_ParentGraph.begins[parent] + static_cast<size_t>(rowEnd - rowBegin);
+  }
+
+  void contractNeighborsAndAreas(size_t parent, size_t numFeatures) const
+  {
+    std::vector<std::pair<int32_t, float>> edges;
+    for(size_t m = m_MemberOffsets[parent]; m < m_MemberOffsets[parent + 1]; m++)
+    {
+      const int32_t member = m_Members[m];
+      for(size_t j = m_ChildGraph.begins[member]; j < m_ChildGraph.ends[member]; j++)
+      {
+        const int32_t neighbor = m_ChildGraph.neighbors[j];
+        if(neighbor <= 0 || static_cast<size_t>(neighbor) >= numFeatures)
+        {
+          continue;
+        }
+        const int32_t neighborParent = m_Labels[neighbor];
+        if(static_cast<size_t>(neighborParent) != parent)
+        {
+          edges.emplace_back(neighborParent, m_ChildGraph.areas[j]);
+        }
+      }
+    }
+    std::sort(edges.begin(), edges.end(), [](const std::pair<int32_t, float>& a, const std::pair<int32_t, float>& b) { return a.first < b.first; });
+
+    size_t out = m_ParentGraph.begins[parent];
+    for(size_t e = 0; e < edges.size(); e++)
+    {
+      if(e == 0 || edges[e].first != edges[e - 1].first)
+      {
+        m_ParentGraph.neighbors[out] = edges[e].first;
+        m_ParentGraph.areas[out] = 0.0f;
+        out++;
+      }
+      m_ParentGraph.areas[out - 1] += edges[e].second;
+    }
+    m_ParentGraph.ends[parent] = out;
+  }
+
+  const FeatureGraph& m_ChildGraph;
+  const std::vector<size_t>& m_MemberOffsets;
+  const std::vector<int32_t>& m_Members;
+  const std::vector<int32_t>& m_Labels;
+  FeatureGraph& m_ParentGraph;
 };
 
+// -----------------------------------------------------------------------------
+/**
+ * @brief ContractGraph Returns the neighbor graph of the parent features, where each feature belongs to its
+ * parent or to itself if its parent is -1. Two parents are neighbors if any of their members are, which is the
+ * neighbor list of the parent labeled cells when the child graph is the face neighbor list of the features.
+ * Likewise, summing the child shared surface areas gives the shared surface areas of the parent labeled cells.
+ */
+FeatureGraph ContractGraph(const FeatureGraph& childGraph, const int32_t* featureParentIds, size_t numFeatures)
+{
+  std::vector<int32_t> labels(numFeatures);
+  std::vector<size_t> memberOffsets(numFeatures + 1, 0);
+  for(size_t f = 0; f < numFeatures; f++)
+  {
+    labels[f] = (featureParentIds[f] != -1) ? featureParentIds[f] : static_cast<int32_t>(f);
+    memberOffsets[labels[f] + 1]++;
+  }
+  for(size_t f = 0; f < numFeatures; f++)
+  {
+    memberOffsets[f + 1] += memberOffsets[f];
+  }
+  std::vector<int32_t> members(numFeatures);
+  {
+    std::vector<size_t> fill(memberOffsets.begin(), memberOffsets.end() - 1);
+    for(size_t f = 0; f < numFeatures; f++)
+    {
+      members[fill[labels[f]]++] = static_cast<int32_t>(f);
+    }
+  }
+
+  FeatureGraph parentGraph;
+  parentGraph.begins.resize(numFeatures);
+  parentGraph.ends.resize(numFeatures);
+  size_t offset = 0;
+  for(size_t parent = 0; parent < numFeatures; parent++)
+  {
+    parentGraph.begins[parent] = offset;
+    for(size_t m = memberOffsets[parent]; m < memberOffsets[parent + 1]; m++)
+    {
+      offset += childGraph.ends[members[m]] - childGraph.begins[members[m]];
+    }
+    parentGraph.ends[parent] = offset;
+  }
+  parentGraph.neighbors.resize(offset);
+  if(!childGraph.areas.empty())
+  {
+    parentGraph.areas.resize(offset);
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numFeatures);
+  dataAlg.execute(ContractGraphImpl(childGraph, memberOffsets, members, labels, parentGraph));
+  return parentGraph;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -117,6 +517,9 @@ void TiDwellFatigueCrystallographicAnalysis::setupFilterParameters()
       SIMPL_NEW_LINKED_BOOL_FP("Do Not Assume Initiator Presence", DoNotAssumeInitiatorPresence, FilterParameter::Category::Parameter, TiDwellFatigueCrystallographicAnalysis, linkedProps2));
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Initiator Lower Threshold (Degrees)", InitiatorLowerThreshold, FilterParameter::Category::Parameter, TiDwellFatigueCrystallographicAnalysis));
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Initiator Upper Threshold (Degrees)", InitiatorUpperThreshold, FilterParameter::Category::Parameter, TiDwellFatigueCrystallographicAnalysis));
+  std::vector<QString> linkedProps3 = {"SharedSurfaceAreaListArrayPath"};
+  parameters.push_back(
+      SIMPL_NEW_LINKED_BOOL_FP("Find Parent Shared Surface Areas", FindParentSharedSurfaceAreas, FilterParameter::Category::Parameter, TiDwellFatigueCrystallographicAnalysis, linkedProps3));
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Hard Feature Lower Threshold (Degrees)", HardFeatureLowerThreshold, FilterParameter::Category::Parameter, TiDwellFatigueCrystallographicAnalysis));
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Hard Feature Upper Threshold (Degrees)", HardFeatureUpperThreshold, FilterParameter::Category::Parameter, TiDwellFatigueCrystallographicAnalysis));
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Soft Feature Lower Threshold (Degrees)", SoftFeatureLowerThreshold, FilterParameter::Category::Parameter, TiDwellFatigueCrystallographicAnalysis));
@@ -151,6 +554,10 @@ void TiDwellFatigueCrystallographicAnalysis::setupFilterParameters()
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Category::Feature);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Neighbor List", NeighborListArrayPath, FilterParameter::Category::RequiredArray, TiDwellFatigueCrystallographicAnalysis, req));
   }
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::NeighborList, 1, AttributeMatrix::Category::Feature);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Shared Surface Area List", SharedSurfaceAreaListArrayPath, FilterParameter::Category::RequiredArray, TiDwellFatigueCrystallographicAnalysis, req));
+  }
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::Defaults::AnyPrimitive, 3, AttributeMatrix::Category::Feature);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Centroids", CentroidsArrayPath, FilterParameter::Category::RequiredArray, TiDwellFatigueCrystallographicAnalysis, req));
@@ -223,6 +630,8 @@ void TiDwellFatigueCrystallographicAnalysis::readFilterParameters(AbstractFilter
   setFeatureEulerAnglesArrayPath(reader->readDataArrayPath("FeatureEulerAnglesArrayPath", getFeatureEulerAnglesArrayPath()));
   setFeaturePhasesArrayPath(reader->readDataArrayPath("FeaturePhasesArrayPath", getFeaturePhasesArrayPath()));
   setNeighborListArrayPath(reader->readDataArrayPath("NeighborListArrayPath", getNeighborListArrayPath()));
+  setFindParentSharedSurfaceAreas(reader->readValue("FindParentSharedSurfaceAreas", getFindParentSharedSurfaceAreas()));
+  setSharedSurfaceAreaListArrayPath(reader->readDataArrayPath("SharedSurfaceAreaListArrayPath", getSharedSurfaceAreaListArrayPath()));
   setCentroidsArrayPath(reader->readDataArrayPath("CentroidsArrayPath", getCentroidsArrayPath()));
   setCrystalStructuresArrayPath(reader->readDataArrayPath("CrystalStructuresArrayPath", getCrystalStructuresArrayPath()));
   reader->closeFilterGroup();
@@ -355,6 +764,16 @@ void TiDwellFatigueCrystallographicAnalysis::dataCheck()
     m_FeatureParentIds = m_FeatureParentIdsPtr.lock()->getPointer(0);
   } /* Now assign the raw pointer to data from the DataArray<T> object */
 
+  tempPath.update(getCellFeatureAttributeMatrixPath().getDataContainerName(), getCellFeatureAttributeMatrixPath().getAttributeMatrixName(), "ParentNumNeighbors");
+  m_ParentNumNeighborsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>>(this, tempPath, 0, dims, "", DataArrayID38);
+  if(nullptr != m_ParentNumNeighborsPtr.lock())
+  {
+    m_ParentNumNeighbors = m_ParentNumNeighborsPtr.lock()->getPointer(0);
+  } /* Now assign the raw pointer to data from the DataArray<T> object */
+
+  tempPath.update(getCellFeatureAttributeMatrixPath().getDataContainerName(), getCellFeatureAttributeMatrixPath().getAttributeMatrixName(), "ParentNeighborList");
+  m_ParentNeighborList = getDataContainerArray()->createNonPrereqArrayFromPath<NeighborList<int32_t>>(this, tempPath, 0, dims, "", DataArrayID39);
+
   dims[0] = 3;
   m_FeatureEulerAnglesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getFeatureEulerAnglesArrayPath(), dims);
   if(nullptr != m_FeatureEulerAnglesPtr.lock())
@@ -371,6 +790,19 @@ void TiDwellFatigueCrystallographicAnalysis::dataCheck()
 
   m_NeighborList = getDataContainerArray()->getPrereqArrayFromPath<NeighborList<int>>(this, getNeighborListArrayPath(), dims);
 
+  if(m_FindParentSharedSurfaceAreas)
+  {
+    m_SharedSurfaceAreaList = getDataContainerArray()->getPrereqArrayFromPath<NeighborList<float>>(this, getSharedSurfaceAreaListArrayPath(), dims);
+
+    tempPath.update(getCellFeatureAttributeMatrixPath().getDataContainerName(), getCellFeatureAttributeMatrixPath().getAttributeMatrixName(), "ParentSharedSurfaceAreaList");
+    m_ParentSharedSurfaceAreaList = getDataContainerArray()->createNonPrereqArrayFromPath<NeighborList<float>>(this, tempPath, 0, dims, "", DataArrayID40);
+  }
+  else
+  {
+    QString ss = QObject::tr("ParentSharedSurfaceAreaList will not be created; enable Find Parent Shared Surface Areas and select the feature Shared Surface Area List to create it");
+    setWarningCondition(-11001, ss);
+  }
+
   dims[0] = 3;
   m_CentroidsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getCentroidsArrayPath(), dims);
   if(nullptr != m_CentroidsPtr.lock())
@@ -449,162 +881,65 @@ void TiDwellFatigueCrystallographicAnalysis::execute()
     }
   }
 
-  for(size_t i = 1; i < totalFeatures; ++i)
+  // Group neighboring hard features and soft features
+  NeighborList<float>* sharedSurfaceAreaList = nullptr;
+  if(m_FindParentSharedSurfaceAreas)
   {
-    // Group neighboring hard features and soft features
-    if(m_HardFeatures[i] || m_SoftFeatures[i])
+    NeighborList<int>& neighborList = *(m_NeighborList.lock());
+    sharedSurfaceAreaList = m_SharedSurfaceAreaList.lock().get();
+    for(size_t i = 0; i < totalFeatures; ++i)
     {
-      group_flaggedfeatures(i);
+      if(sharedSurfaceAreaList->getListSize(static_cast<int32_t>(i)) != neighborList.getListSize(static_cast<int32_t>(i)))
+      {
+        QString ss = QObject::tr("The Shared Surface Area List of Feature %1 has %2 entries but its Neighbor List has %3")
+                         .arg(i)
+                         .arg(sharedSurfaceAreaList->getListSize(static_cast<int32_t>(i)))
+                         .arg(neighborList.getListSize(static_cast<int32_t>(i)));
+        setErrorCondition(-11002, ss);
+        return;
+      }
     }
   }
-
-  size_t fid = 0;
+  FeatureGraph neighborGraph = CopyNeighborList(*(m_NeighborList.lock()), sharedSurfaceAreaList, totalFeatures);
+  {
+    ConcurrentUnionFind groups(totalFeatures);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, totalFeatures);
+    dataAlg.execute(UniteFlaggedNeighborsImpl(neighborGraph, m_HardFeatures, m_SoftFeatures, totalFeatures, groups));
+    dataAlg.execute(AssignFeatureParentsImpl(groups, m_FeatureParentIds));
+  }
 
   // map grouped features to the cells
-  for(size_t i = 0; i < totalPoints; ++i)
   {
-    fid = m_FeatureParentIds[m_FeatureIds[i]];
-    if(fid != -1)
-    {
-      m_CellParentIds[i] = fid;
-    }
-    else
-    {
-      m_CellParentIds[i] = m_FeatureIds[i];
-    }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, totalPoints);
+    dataAlg.execute(MapCellParentIdsImpl(m_FeatureIds, m_FeatureParentIds, m_CellParentIds));
   }
 
-  QString filtName = "FindNeighbors";
-  FilterManager* fm = FilterManager::Instance();
-  IFilterFactory::Pointer findNeighborFactory = fm->getFactoryFromClassName(filtName);
-
-  DataArrayPath tempPath;
-
-  if(nullptr != findNeighborFactory.get())
-  {
-    // If we get this far, the Factory is good so creating the filter should not fail unless something has
-    // horribly gone wrong in which case the system is going to come down quickly after this.
-    AbstractFilter::Pointer find_Neighbor = findNeighborFactory->create();
-
-    // Connect up the Error/Warning/Progress object so the filter can report those things
-    connect(find_Neighbor.get(), SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), this, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)));
-    find_Neighbor->setDataContainerArray(getDataContainerArray()); // AbstractFilter implements this so no problem
-    // Now set the filter parameters for the filter using QProperty System since we can not directly
-    // instantiate the filter since it resides in a plugin. These calls are SLOW. DO NOT EVER do this in a
-    // tight loop. Your filter will slow down by 10X.
-    tempPath.update(getDataContainerName().getDataContainerName(), getCellFeatureAttributeMatrixName(), "");
-    QVariant v;
-    v.setValue(tempPath);
-    bool propWasSet = find_Neighbor->setProperty("CellFeatureAttributeMatrixPath", v);
-    if(!propWasSet)
-    {
-      QString ss = QObject::tr("Ti Dwell Fatigue Error Setting Property '%1' into filter '%2' which is a subfilter called by Ti Dwell Fatigue Error. The property was not set which could mean the "
-                               "property was not exposed with a Q_PROPERTY macro. Please notify the developers.")
-                       .arg("CellFeatureAttributeMatrixPath")
-                       .arg(filtName);
-      setErrorCondition(-109872, ss);
-    }
-
-    tempPath.update(getFeatureIdsArrayPath().getDataContainerName(), getFeatureIdsArrayPath().getAttributeMatrixName(), getCellParentIdsArrayName());
-    v.setValue(tempPath);
-    propWasSet = find_Neighbor->setProperty("FeatureIdsArrayPath", v);
-    if(!propWasSet)
-    {
-      QString ss = QObject::tr("Ti Dwell Fatigue Error Setting Property '%1' into filter '%2' which is a subfilter called by Ti Dwell Fatigue Error. The property was not set which could mean the "
-                               "property was not exposed with a Q_PROPERTY macro. Please notify the developers.")
-                       .arg("FeatureIdsArrayPath")
-                       .arg(filtName);
-      setErrorCondition(-109873, ss);
-    }
-
-    QString tempString("BoundaryCells");
-    v.setValue(tempString);
-    propWasSet = find_Neighbor->setProperty("BoundaryCellsArrayName", v);
-    if(!propWasSet)
-    {
-      QString ss = QObject::tr("Ti Dwell Fatigue Error Setting Property '%1' into filter '%2' which is a subfilter called by Ti Dwell Fatigue Error. The property was not set which could mean the "
-                               "property was not exposed with a Q_PROPERTY macro. Please notify the developers.")
-                       .arg("BoundaryCellsArrayName")
-                       .arg(filtName);
-      setErrorCondition(-109874, ss);
-    }
-
-    tempString = "SurfaceFeatures";
-    v.setValue(tempString);
-    propWasSet = find_Neighbor->setProperty("SurfaceFeaturesArrayName", v);
-    if(!propWasSet)
-    {
-      QString ss = QObject::tr("Ti Dwell Fatigue Error Setting Property '%1' into filter '%2' which is a subfilter called by Ti Dwell Fatigue Error. The property was not set which could mean the "
-                               "property was not exposed with a Q_PROPERTY macro. Please notify the developers.")
-                       .arg("SurfaceFeaturesArrayName")
-                       .arg(filtName);
-      setErrorCondition(-109875, ss);
-    }
-
-    v.setValue(false);
-    propWasSet = find_Neighbor->setProperty("StoreBoundaryCells", v);
-    if(!propWasSet)
-    {
-      QString ss = QObject::tr("Ti Dwell Fatigue Error Setting Property '%1' into filter '%2' which is a subfilter called by Ti Dwell Fatigue Error. The property was not set which could mean the "
-                               "property was not exposed with a Q_PROPERTY macro. Please notify the developers.")
-                       .arg("StoreBoundaryCellsArrayName")
-                       .arg(filtName);
-      setErrorCondition(-109876, ss);
-    }
-
-    v.setValue(false);
-    propWasSet = find_Neighbor->setProperty("StoreSurfaceFeatures", v);
-    if(!propWasSet)
-    {
-      QString ss = QObject::tr("Ti Dwell Fatigue Error Setting Property '%1' into filter '%2' which is a subfilter called by Ti Dwell Fatigue Error. The property was not set which could mean the "
-                               "property was not exposed with a Q_PROPERTY macro. Please notify the developers.")
-                       .arg("StoreSurfaceFeaturesArrayName")
-                       .arg(filtName);
-      setErrorCondition(-109877, ss);
-    }
-
-    tempString = "ParentNumNeighbors";
-    v.setValue(tempString);
-    propWasSet = find_Neighbor->setProperty("NumNeighborsArrayName", v);
-    if(!propWasSet)
-    {
-      QString ss = QObject::tr("Ti Dwell Fatigue Error Setting Property '%1' into filter '%2' which is a subfilter called by Ti Dwell Fatigue Error. The property was not set which could mean the "
-                               "property was not exposed with a Q_PROPERTY macro. Please notify the developers.")
-                       .arg("ParentNumNeighbors")
-                       .arg(filtName);
-      setErrorCondition(-109878, ss);
-    }
-
-    tempString = "ParentNeighborList";
-    v.setValue(tempString);
-    propWasSet = find_Neighbor->setProperty("NeighborListArrayName", v);
-    if(!propWasSet)
-    {
-      QString ss = QObject::tr("Ti Dwell Fatigue Error Setting Property '%1' into filter '%2' which is a subfilter called by Ti Dwell Fatigue Error. The property was not set which could mean the "
-                               "property was not exposed with a Q_PROPERTY macro. Please notify the developers.")
-                       .arg("ParentNeighborList")
-                       .arg(filtName);
-      setErrorCondition(-109879, ss);
-    }
+  if(getCancel())
+  {
+    return;
+  }
 
-    tempString = "ParentSharedSurfaceAreaList";
-    v.setValue(tempString);
-    propWasSet = find_Neighbor->setProperty("SharedSurfaceAreaListArrayName", v);
-    if(!propWasSet)
+  // The parent neighbors follow from the feature neighbors without rescanning the cells
+  FeatureGraph parentGraph = ContractGraph(neighborGraph, m_FeatureParentIds, totalFeatures);
+  NeighborList<int32_t>& parentNeighborList = *(m_ParentNeighborList.lock());
+  for(size_t i = 0; i < totalFeatures; ++i)
+  {
+    NeighborList<int32_t>::SharedVectorType parentNeighbors(new std::vector<int32_t>(parentGraph.neighbors.begin() + parentGraph.begins[i], parentGraph.neighbors.begin() + parentGraph.ends[i]));
+    m_ParentNumNeighbors[i] = static_cast<int32_t>(parentNeighbors->size());
+    parentNeighborList.setList(static_cast<int32_t>(i), parentNeighbors);
+  }
+  if(m_FindParentSharedSurfaceAreas)
+  {
+    NeighborList<float>& parentSharedSurfaceAreaList = *(m_ParentSharedSurfaceAreaList.lock());
+    for(size_t i = 0; i < totalFeatures; ++i)
     {
-      QString ss = QObject::tr("Ti Dwell Fatigue Error Setting Property '%1' into filter '%2' which is a subfilter called by Ti Dwell Fatigue Error. The property was not set which could mean the "
-                               "property was not exposed with a Q_PROPERTY macro. Please notify the developers.")
-                       .arg("ParentSharedSurfaceAreaList")
-                       .arg(filtName);
-      setErrorCondition(-109880, ss);
+      NeighborList<float>::SharedVectorType parentAreas(new std::vector<float>(parentGraph.areas.begin() + parentGraph.begins[i], parentGraph.areas.begin() + parentGraph.ends[i]));
+      parentSharedSurfaceAreaList.setList(static_cast<int32_t>(i), parentAreas);
     }
-    find_Neighbor->execute();
   }
 
-  std::vector<size_t> cDims(1, 1);
-  tempPath.update(getFeatureEulerAnglesArrayPath().getDataContainerName(), getFeatureEulerAnglesArrayPath().getAttributeMatrixName(), "ParentNeighborList");
-  m_ParentNeighborList = getDataContainerArray()->getPrereqArrayFromPath<NeighborList<int>>(this, tempPath, cDims);
-
   for(size_t i = 1; i < totalFeatures; ++i)
   {
     // only proceed if it's either an MTR or alpha glob
@@ -613,7 +948,7 @@ void TiDwellFatigueCrystallographicAnalysis::execute()
       // Determine if it's a hard-soft pair only if there the current ID is either a hardfeature, initiator or soft feature
       if(m_Initiators[i] || m_HardFeatures[i] || m_SoftFeatures[i])
       {
-        assign_HardSoftGroups(i);
+        assign_HardSoftGroups(i, parentGraph.neighbors.data() + parentGraph.begins[i], parentGraph.ends[i] - parentGraph.begins[i]);
       }
     }
   }
@@ -739,58 +1074,23 @@ void TiDwellFatigueCrystallographicAnalysis::determine_softfeatures(int index)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void TiDwellFatigueCrystallographicAnalysis::group_flaggedfeatures(int index)
+void TiDwellFatigueCrystallographicAnalysis::assign_HardSoftGroups(int index, const int32_t* parentNeighbors, size_t numParentNeighbors)
 {
-  // But since a pointer is difficult to use operators with we will now create a
-  // reference variable to the pointer with the correct variable name that allows
-  // us to use the same syntax as the "vector of vectors"
-  NeighborList<int>& neighborlist = *(m_NeighborList.lock());
-
-  for(int j = 0; j < neighborlist[index].size(); ++j)
-  {
-    if(m_FeatureParentIds[index] != neighborlist[index][j] && ((m_HardFeatures[index] && m_HardFeatures[neighborlist[index][j]]) || (m_SoftFeatures[index] && m_SoftFeatures[neighborlist[index][j]])))
-    {
-      if(m_FeatureParentIds[neighborlist[index][j]] == -1)
-      {
-        if(m_FeatureParentIds[index] == -1)
-        {
-          m_FeatureParentIds[neighborlist[index][j]] = index;
-        }
-        if(m_FeatureParentIds[index] != -1)
-        {
-          m_FeatureParentIds[neighborlist[index][j]] = m_FeatureParentIds[index];
-        }
-        group_flaggedfeatures(neighborlist[index][j]);
-      }
-    }
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void TiDwellFatigueCrystallographicAnalysis::assign_HardSoftGroups(int index)
-{
-  // But since a pointer is difficult to use operators with we will now create a
-  // reference variable to the pointer with the correct variable name that allows
-  // us to use the same syntax as the "vector of vectors"
-  NeighborList<int>& parentneighborlist = *(m_ParentNeighborList.lock());
-
   bool hardfeatureFlag = false;
   bool initiatorFlag = false;
   bool softfeatureFlag = false;
   int hardfeatureIndex = 0;
   int softfeatureIndex = 0;
 
-  for(int j = 0; j < parentneighborlist[index].size(); ++j)
+  for(size_t j = 0; j < numParentNeighbors; ++j)
   {
-    if((m_DoNotAssumeInitiatorPresence && m_FeaturePhases[index] == m_AlphaGlobPhase) || m_FeaturePhases[parentneighborlist[index][j]] == m_MTRPhase)
+    if((m_DoNotAssumeInitiatorPresence && m_FeaturePhases[index] == m_AlphaGlobPhase) || m_FeaturePhases[parentNeighbors[j]] == m_MTRPhase)
     {
       if(m_Initiators[index] && !initiatorFlag && m_DoNotAssumeInitiatorPresence && m_FeaturePhases[index] == m_AlphaGlobPhase)
       {
         initiatorFlag = true;
       }
-      if(m_Initiators[parentneighborlist[index][j]] && !initiatorFlag && m_DoNotAssumeInitiatorPresence && m_FeaturePhases[parentneighborlist[index][j]] == m_AlphaGlobPhase)
+      if(m_Initiators[parentNeighbors[j]] && !initiatorFlag && m_DoNotAssumeInitiatorPresence && m_FeaturePhases[parentNeighbors[j]] == m_AlphaGlobPhase)
       {
         initiatorFlag = true;
       }
@@ -799,20 +1099,20 @@ void TiDwellFatigueCrystallographicAnalysis::assign_HardSoftGroups(int index)
         hardfeatureFlag = true;
         hardfeatureIndex = index;
       }
-      if(m_HardFeatures[parentneighborlist[index][j]] && !hardfeatureFlag && m_FeaturePhases[parentneighborlist[index][j]] == m_MTRPhase)
+      if(m_HardFeatures[parentNeighbors[j]] && !hardfeatureFlag && m_FeaturePhases[parentNeighbors[j]] == m_MTRPhase)
       {
         hardfeatureFlag = true;
-        hardfeatureIndex = parentneighborlist[index][j];
+        hardfeatureIndex = parentNeighbors[j];
       }
       if(m_SoftFeatures[index] && !softfeatureFlag && m_FeaturePhases[index] == m_MTRPhase)
       {
         softfeatureFlag = true;
         softfeatureIndex = index;
       }
-      if(m_SoftFeatures[parentneighborlist[index][j]] && !softfeatureFlag && m_FeaturePhases[parentneighborlist[index][j]] == m_MTRPhase)
+      if(m_SoftFeatures[parentNeighbors[j]] && !softfeatureFlag && m_FeaturePhases[parentNeighbors[j]] == m_MTRPhase)
       {
         softfeatureFlag = true;
-        softfeatureIndex = parentneighborlist[index][j];
+        softfeatureIndex = parentNeighbors[j];
       }
       // only flag as a hard-soft pair if there's a neighboring group of initiator - hardfeature - soft feature and either the current index of the hardfeature or
       // soft feature have not already been flagged as a bad acting pair
@@ -1325,6 +1625,30 @@ DataArrayPath TiDwellFatigueCrystallographicAnalysis::getNeighborListArrayPath()
   return m_NeighborListArrayPath;
 }
 
+// -----------------------------------------------------------------------------
+void TiDwellFatigueCrystallographicAnalysis::setFindParentSharedSurfaceAreas(bool value)
+{
+  m_FindParentSharedSurfaceAreas = value;
+}
+
+// -----------------------------------------------------------------------------
+bool TiDwellFatigueCrystallographicAnalysis::getFindParentSharedSurfaceAreas() const
+{
+  return m_FindParentSharedSurfaceAreas;
+}
+
+// -----------------------------------------------------------------------------
+void TiDwellFatigueCrystallographicAnalysis::setSharedSurfaceAreaListArrayPath(const DataArrayPath& value)
+{
+  m_SharedSurfaceAreaListArrayPath = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath TiDwellFatigueCrystallographicAnalysis::getSharedSurfaceAreaListArrayPath() const
+{
+  return m_SharedSurfaceAreaListArrayPath;
+}
+
 // -----------------------------------------------------------------------------
 void TiDwellFatigueCrystallographicAnalysis::setCentroidsArrayPath(const DataArrayPath& value)
 {
@@ -418,6 +418,28 @@ public:
   DataArrayPath getNeighborListArrayPath() const;
   Q_PROPERTY(DataArrayPath NeighborListArrayPath READ getNeighborListArrayPath WRITE setNeighborListArrayPath)
 
+  /**
+   * @brief Setter property for FindParentSharedSurfaceAreas
+   */
+  void setFindParentSharedSurfaceAreas(bool value);
+  /**
+   * @brief Getter property for FindParentSharedSurfaceAreas
+   * @return Value of FindParentSharedSurfaceAreas
+   */
+  bool getFindParentSharedSurfaceAreas() const;
+  Q_PROPERTY(bool FindParentSharedSurfaceAreas READ getFindParentSharedSurfaceAreas WRITE setFindParentSharedSurfaceAreas)
+
+  /**
+   * @brief Setter property for SharedSurfaceAreaListArrayPath
+   */
+  void setSharedSurfaceAreaListArrayPath(const DataArrayPath& value);
+  /**
+   * @brief Getter property for SharedSurfaceAreaListArrayPath
+   * @return Value of SharedSurfaceAreaListArrayPath
+   */
+  DataArrayPath getSharedSurfaceAreaListArrayPath() const;
+  Q_PROPERTY(DataArrayPath SharedSurfaceAreaListArrayPath READ getSharedSurfaceAreaListArrayPath WRITE setSharedSurfaceAreaListArrayPath)
+
   /**
    * @brief Setter property for CentroidsArrayPath
    */
@@ -519,8 +541,7 @@ protected:
   bool determine_hardfeatures(int index);
   void determine_initiators(int index);
   void determine_softfeatures(int index);
-  void group_flaggedfeatures(int index);
-  void assign_HardSoftGroups(int index);
+  void assign_HardSoftGroups(int index, const int32_t* parentNeighbors, size_t numParentNeighbors);
   float find_angle(float g[3][3], float planeNormalU, float planeNormalV, float planeNormalW);
 
   /**
@@ -552,6 +573,8 @@ private:
   int32_t* m_CellParentIds = nullptr;
   std::weak_ptr<DataArray<int32_t>> m_FeatureParentIdsPtr;
   int32_t* m_FeatureParentIds = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_ParentNumNeighborsPtr;
+  int32_t* m_ParentNumNeighbors = nullptr;
   std::weak_ptr<DataArray<bool>> m_ActivePtr;
   bool* m_Active = nullptr;
   std::weak_ptr<DataArray<float>> m_FeatureEulerAnglesPtr;
@@ -594,13 +617,17 @@ private:
   DataArrayPath m_FeatureEulerAnglesArrayPath = {SIMPL::Defaults::SyntheticVolumeDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, SIMPL::FeatureData::EulerAngles};
   DataArrayPath m_FeaturePhasesArrayPath = {SIMPL::Defaults::SyntheticVolumeDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, SIMPL::FeatureData::Phases};
   DataArrayPath m_NeighborListArrayPath = {SIMPL::Defaults::SyntheticVolumeDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, SIMPL::FeatureData::NeighborList};
+  bool m_FindParentSharedSurfaceAreas = {false};
+  DataArrayPath m_SharedSurfaceAreaListArrayPath = {SIMPL::Defaults::SyntheticVolumeDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, SIMPL::FeatureData::SharedSurfaceAreaList};
   DataArrayPath m_CentroidsArrayPath = {SIMPL::Defaults::SyntheticVolumeDataContainerName, SIMPL::Defaults::CellFeatureAttributeMatrixName, SIMPL::FeatureData::Centroids};
   DataArrayPath m_CrystalStructuresArrayPath = {SIMPL::Defaults::StatsGenerator, SIMPL::Defaults::CellEnsembleAttributeMatrixName, SIMPL::EnsembleData::CrystalStructures};
 
   // Feature Data - make sure these are all initialized to nullptr in the constructor
 
   NeighborList<int>::WeakPointer m_NeighborList;
-  NeighborList<int>::WeakPointer m_ParentNeighborList;
+  NeighborList<int32_t>::WeakPointer m_ParentNeighborList;
+  NeighborList<float>::WeakPointer m_SharedSurfaceAreaList;
+  NeighborList<float>::WeakPointer m_ParentSharedSurfaceAreaList;
 
   // Ensemble Data - make sure these are all initialized to nullptr in the constructor
 
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace AdaptiveAlignmentShiftSearch
+{
+/**
+ * @brief Half width of the square window of candidate shifts evaluated around the current best shift
+ */
+constexpr int64_t k_WindowHalfWidth = 3;
+
+/**
+ * @brief Spacing, in voxels, of the grid of reference points compared at the finest pyramid level
+ */
+constexpr uint64_t k_BaseStride = 4;
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief InsertCandidate Inserts a shift into a list of candidates kept sorted by increasing cost; the
+ * list holds at most numStored entries and the worst candidate is dropped
+ */
+inline void InsertCandidate(int64_t xshift, int64_t yshift, float cost, uint64_t numStored, std::vector<int64_t>& xshifts, std::vector<int64_t>& yshifts, std::vector<float>& costs)
+{
+  int64_t s = static_cast<int64_t>(numStored);
+  while(s - 1 >= 0 && cost < costs[s - 1])
+  {
+    s--;
+  }
+  if(s >= static_cast<int64_t>(numStored))
+  {
+    return;
+  }
+  // lag the shifts already stored
+  for(int64_t t = static_cast<int64_t>(numStored) - 1; t > s; t--)
+  {
+    xshifts[t] = xshifts[t - 1];
+    yshifts[t] = yshifts[t - 1];
+    costs[t] = costs[t - 1];
+  }
+  xshifts[s] = xshift;
+  yshifts[s] = yshift;
+  costs[s] = cost;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief FindSliceShifts Searches the in-plane shift between a pair of adjacent slices. Starting from the
+ * coarsest of pyramidLevels levels, a window of candidate shifts spaced 2^level voxels apart is evaluated
+ * around the current best shift, recentering until the best shift stops moving; the result seeds the next
+ * finer level. At level L the cost function compares reference points spaced k_BaseStride * 2^L voxels apart,
+ * so coarse levels cost a fraction of the finest one while covering shifts 2^L times larger. Each shift is
+ * evaluated at most once per level. A single level reproduces the plain windowed search.
+ * @param dimX Slice dimension along X
+ * @param dimY Slice dimension along Y
+ * @param pyramidLevels Number of resolution levels (at least 1)
+ * @param maxStoredShifts Number of best candidates kept at the finest level
+ * @param costFunction Callable float(int64_t xshift, int64_t yshift, uint64_t stride); lower is better
+ * @param xshifts Best X shifts found, sorted by cost (resized to maxStoredShifts)
+ * @param yshifts Best Y shifts found, sorted by cost (resized to maxStoredShifts)
+ * @param costs Costs of the stored shifts (resized to maxStoredShifts)
+ */
+template <typename CostFunction>
+void FindSliceShifts(uint64_t dimX, uint64_t dimY, uint64_t pyramidLevels, uint64_t maxStoredShifts, CostFunction&& costFunction, std::vector<int64_t>& xshifts, std::vector<int64_t>& yshifts,
+                     std::vector<float>& costs)
+{
+  const int64_t halfDimX = static_cast<int64_t>(static_cast<uint64_t>(dimX * 0.5f));
+  const int64_t halfDimY = static_cast<int64_t>(static_cast<uint64_t>(dimY * 0.5f));
+
+  xshifts.resize(maxStoredShifts);
+  yshifts.resize(maxStoredShifts);
+  costs.resize(maxStoredShifts);
+
+  int64_t centerX = 0;
+  int64_t centerY = 0;
+  for(uint64_t level = (pyramidLevels > 0 ? pyramidLevels : 1); level-- > 0;)
+  {
+    const int64_t step = static_cast<int64_t>(1) << level;
+    const uint64_t stride = k_BaseStride * static_cast<uint64_t>(step);
+    const uint64_t numStored = (level == 0) ? maxStoredShifts : 1;
+
+    std::fill(xshifts.begin(), xshifts.end(), centerX);
+    std::fill(yshifts.begin(), yshifts.end(), centerY);
+    std::fill(costs.begin(), costs.end(), std::numeric_limits<float>::max());
+
+    std::set<std::pair<int64_t, int64_t>> evaluated;
+    int64_t oldX = 0;
+    int64_t oldY = 0;
+    do
+    {
+      oldX = xshifts[0];
+      oldY = yshifts[0];
+      for(int64_t j = -k_WindowHalfWidth; j <= k_WindowHalfWidth; j++)
+      {
+        for(int64_t k = -k_WindowHalfWidth; k <= k_WindowHalfWidth; k++)
+        {
+          const int64_t x = oldX + k * step;
+          const int64_t y = oldY + j * step;
+          if(std::llabs(x) >= halfDimX || std::llabs(y) >= halfDimY)
+          {
+            continue;
+          }
+          if(!evaluated.insert({x, y}).second)
+          {
+            continue;
+          }
+          InsertCandidate(x, y, costFunction(x, y, stride), numStored, xshifts, yshifts, costs);
+        }
+      }
+    } while(xshifts[0] != oldX || yshifts[0] != oldY);
+
+    centerX = xshifts[0];
+    centerY = yshifts[0];
+  }
+}
+} // namespace AdaptiveAlignmentShiftSearch
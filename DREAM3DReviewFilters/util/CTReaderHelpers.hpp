@@ -0,0 +1,77 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <type_traits>
+
+#include <sys/types.h>
+
+/**
+ * @brief Helpers shared by the raw CT volume readers (NorthStar .nsidat, Volume Graphics .vol)
+ */
+namespace CTReaderHelpers
+{
+// Choices for the "Output Data Type" parameter of the CT readers
+constexpr int32_t k_Float32Output = 0;
+constexpr int32_t k_UInt16Output = 1;
+constexpr int32_t k_UInt8Output = 2;
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief SeekFile Seeks to an absolute byte offset, using 64 bit offsets on every platform
+ * so that files larger than 2 GB can be addressed.
+ */
+inline int32_t SeekFile(FILE* f, int64_t offset)
+{
+#if defined(_MSC_VER)
+  return _fseeki64(f, offset, SEEK_SET);
+#else
+  return fseeko(f, static_cast<off_t>(offset), SEEK_SET);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief The DensityConverter struct maps raw float32 density values into the output type.
+ * Float output is a plain copy. Integer output windows the density to [windowMin, windowMax]
+ * and linearly quantizes it onto the full range of T.
+ */
+template <typename T>
+struct DensityConverter
+{
+  DensityConverter(float windowMin, float windowMax)
+  : m_WindowMin(windowMin)
+  {
+    if constexpr(!std::is_same_v<T, float>)
+    {
+      float range = windowMax - windowMin;
+      m_Scale = (range > 0.0f) ? static_cast<float>(std::numeric_limits<T>::max()) / range : 0.0f;
+    }
+  }
+
+  void convert(const float* source, T* destination, size_t count) const
+  {
+    if constexpr(std::is_same_v<T, float>)
+    {
+      if(source != destination)
+      {
+        std::copy(source, source + count, destination);
+      }
+    }
+    else
+    {
+      const float maxValue = static_cast<float>(std::numeric_limits<T>::max());
+      for(size_t i = 0; i < count; i++)
+      {
+        float value = std::clamp((source[i] - m_WindowMin) * m_Scale, 0.0f, maxValue);
+        destination[i] = static_cast<T>(value + 0.5f);
+      }
+    }
+  }
+
+  float m_WindowMin = 0.0f;
+  float m_Scale = 1.0f;
+};
+} // namespace CTReaderHelpers
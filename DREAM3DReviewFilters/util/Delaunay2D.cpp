@@ -1,9 +1,49 @@
 #include "Delaunay2D.h"
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+
 #include <Eigen/Dense>
 
 #include "SIMPLib/Math/MatrixMath.h"
 
+namespace
+{
+/**
+ * @brief Number of bits per axis used to quantize points onto the Hilbert curve
+ */
+constexpr uint32_t k_HilbertOrder = 16;
+
+/**
+ * @brief Rounds of the biased randomized insertion order stop halving below this size
+ */
+constexpr size_t k_MinRoundSize = 64;
+
+// -----------------------------------------------------------------------------
+uint64_t hilbertIndex(uint32_t x, uint32_t y)
+{
+  uint64_t d = 0;
+  for(uint32_t s = 1u << (k_HilbertOrder - 1); s > 0; s >>= 1)
+  {
+    const uint32_t rx = (x & s) > 0 ? 1 : 0;
+    const uint32_t ry = (y & s) > 0 ? 1 : 0;
+    d += static_cast<uint64_t>(s) * static_cast<uint64_t>(s) * ((3 * rx) ^ ry);
+    // rotate the quadrant so the curve stays continuous
+    if(ry == 0)
+    {
+      if(rx == 1)
+      {
+        x = s - 1 - (x & (s - 1));
+        y = s - 1 - (y & (s - 1));
+      }
+      std::swap(x, y);
+    }
+  }
+  return d;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -72,6 +112,10 @@ TriangleGeom::Pointer Delaunay2D::triangulate()
 
   findPointBounds(projectedVertices);
 
+  // Points are inserted along a space filling curve so each point location walk starts
+  // from a triangle next to the previous point
+  std::vector<int64_t> insertionOrder = findInsertionOrder(projectedVertices);
+
   double center[3];
   center[0] = (m_PointBounds[0] + m_PointBounds[1]) / 2.0;
   center[1] = (m_PointBounds[2] + m_PointBounds[3]) / 2.0;
@@ -122,7 +166,7 @@ TriangleGeom::Pointer Delaunay2D::triangulate()
   int64_t progressInt = 0;
   int64_t counter = 0;
 
-  for(int64_t ptId = 0; ptId < int64_t(numVerts); ptId++)
+  for(int64_t ptId : insertionOrder)
   {
     x[0] = projectedVertices[ptId][0];
     x[1] = projectedVertices[ptId][1];
@@ -218,7 +262,7 @@ TriangleGeom::Pointer Delaunay2D::triangulate()
       tri[0] = 0; // no triangle found
     }
 
-    if(counter > prog)
+    if(counter > prog && m_Observer != nullptr)
     {
       progressInt = static_cast<int64_t>((static_cast<float>(counter) / numVerts) * 100.0f);
       QString ss = m_MessageTitle + QObject::tr(" || %1% Complete").arg(progressInt);
@@ -445,82 +489,82 @@ int64_t Delaunay2D::findTriangle(double x[3], int64_t tri, double tol, int64_t n
   int i, j, ir, ic, inside, i2, i3;
   int64_t newNei;
   double p[3][3], n[2], vp[2], vx[2], dp, minProj;
-
-  m_Delaunay->getTriangleVertices(tri, pts);
-  m_Delaunay->getVertexCoordinates(pts[0], p[0]);
-  m_Delaunay->getVertexCoordinates(pts[1], p[1]);
-  m_Delaunay->getVertexCoordinates(pts[2], p[2]);
-
-  srand(tri);
-  ir = rand() % 3;
   const double del2D_tolerance = 1.0e-014;
 
-  for(inside = 1, minProj = del2D_tolerance, ic = 0; ic < 3; ic++)
+  // Walk from triangle to triangle towards the point
+  while(true)
   {
-    i = (ir + ic) % 3;
-    i2 = (i + 1) % 3;
-    i3 = (i + 2) % 3;
-
-    // create a 2D edge normal to define a "half-space"; evaluate points (i.e.,
-    // candidate point and other triangle vertex not on this edge).
-    n[0] = -(p[i2][1] - p[i][1]);
-    n[1] = p[i2][0] - p[i][0];
-    Normalize2x1(n);
-
-    // compute local vectors
-    for(j = 0; j < 2; j++)
-    {
-      vp[j] = p[i3][j] - p[i][j];
-      vx[j] = x[j] - p[i][j];
-    }
+    m_Delaunay->getTriangleVertices(tri, pts);
+    m_Delaunay->getVertexCoordinates(pts[0], p[0]);
+    m_Delaunay->getVertexCoordinates(pts[1], p[1]);
+    m_Delaunay->getVertexCoordinates(pts[2], p[2]);
 
-    // check for duplicate point
-    Normalize2x1(vp);
-    if(Normalize2x1(vx) <= tol)
-    {
-      m_NumDuplicatePoints++;
-      return -1;
-    }
+    // Vary the first edge tested between triangles without touching the global random state,
+    // so that several triangulations may run concurrently
+    ir = static_cast<int>(((static_cast<uint64_t>(tri) * 0x9E3779B97F4A7C15ULL) >> 32) % 3);
 
-    // see if two points are in opposite half spaces
-    dp = Dot2D(n, vx) * (Dot2D(n, vp) < 0 ? -1.0 : 1.0);
-    if(dp < del2D_tolerance)
+    for(inside = 1, minProj = del2D_tolerance, ic = 0; ic < 3; ic++)
     {
-      if(dp < minProj) // track edge most orthogonal to point direction
+      i = (ir + ic) % 3;
+      i2 = (i + 1) % 3;
+      i3 = (i + 2) % 3;
+
+      // create a 2D edge normal to define a "half-space"; evaluate points (i.e.,
+      // candidate point and other triangle vertex not on this edge).
+      n[0] = -(p[i2][1] - p[i][1]);
+      n[1] = p[i2][0] - p[i][0];
+      Normalize2x1(n);
+
+      // compute local vectors
+      for(j = 0; j < 2; j++)
       {
-        inside = 0;
-        nei[1] = pts[i];
-        nei[2] = pts[i2];
-        minProj = dp;
+        vp[j] = p[i3][j] - p[i][j];
+        vx[j] = x[j] - p[i][j];
       }
-    } // outside this edge
-  }   // for each edge
 
-  if(inside != 0) // all edges have tested positive
-  {
-    nei[0] = (-1);
-    return tri;
-  }
+      // check for duplicate point
+      Normalize2x1(vp);
+      if(Normalize2x1(vx) <= tol)
+      {
+        m_NumDuplicatePoints++;
+        return -1;
+      }
 
-  if(!inside && (fabs(minProj) < del2D_tolerance)) // on edge
-  {
-    nei[0] = m_Delaunay->getTriangleEdgeNeighbor(nei[1], nei[2], tri);
-    return tri;
-  }
+      // see if two points are in opposite half spaces
+      dp = Dot2D(n, vx) * (Dot2D(n, vp) < 0 ? -1.0 : 1.0);
+      if(dp < del2D_tolerance)
+      {
+        if(dp < minProj) // track edge most orthogonal to point direction
+        {
+          inside = 0;
+          nei[1] = pts[i];
+          nei[2] = pts[i2];
+          minProj = dp;
+        }
+      } // outside this edge
+    }   // for each edge
 
-  else // walk towards point
-  {
+    if(inside != 0) // all edges have tested positive
+    {
+      nei[0] = (-1);
+      return tri;
+    }
+
+    if(!inside && (fabs(minProj) < del2D_tolerance)) // on edge
+    {
+      nei[0] = m_Delaunay->getTriangleEdgeNeighbor(nei[1], nei[2], tri);
+      return tri;
+    }
+
+    // walk towards point
     newNei = m_Delaunay->getTriangleEdgeNeighbor(nei[1], nei[2], tri);
     if(newNei == nei[0])
     {
       m_NumDegeneracies++;
       return -1;
     }
-    else
-    {
-      nei[0] = tri;
-      return findTriangle(x, newNei, tol, nei, pts);
-    }
+    nei[0] = tri;
+    tri = newNei;
   }
 }
 
@@ -602,6 +646,47 @@ void Delaunay2D::findPointBounds(TriMesh::VertexCoordList& vertices)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<int64_t> Delaunay2D::findInsertionOrder(const TriMesh::VertexCoordList& vertices) const
+{
+  // Biased randomized insertion order: the shuffled points are split into rounds that double
+  // in size, and each round is sorted along a Hilbert curve over the XY bounds. The random
+  // rounds keep the triangulation well shaped while it grows, and the curve keeps consecutive
+  // points close together. A fixed seed keeps the output reproducible.
+  std::vector<int64_t> order(vertices.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::mt19937_64 generator(std::mt19937_64::default_seed);
+  std::shuffle(order.begin(), order.end(), generator);
+
+  const double maxCoord = static_cast<double>((1u << k_HilbertOrder) - 1);
+  const double rangeX = m_PointBounds[1] - m_PointBounds[0];
+  const double rangeY = m_PointBounds[3] - m_PointBounds[2];
+  const double scaleX = rangeX > 0.0 ? maxCoord / rangeX : 0.0;
+  const double scaleY = rangeY > 0.0 ? maxCoord / rangeY : 0.0;
+
+  std::vector<uint64_t> keys(vertices.size());
+  for(size_t v = 0; v < vertices.size(); v++)
+  {
+    const double qx = std::clamp((static_cast<double>(vertices[v][0]) - m_PointBounds[0]) * scaleX, 0.0, maxCoord);
+    const double qy = std::clamp((static_cast<double>(vertices[v][1]) - m_PointBounds[2]) * scaleY, 0.0, maxCoord);
+    keys[v] = hilbertIndex(static_cast<uint32_t>(qx), static_cast<uint32_t>(qy));
+  }
+
+  auto byCurve = [&keys](int64_t a, int64_t b) { return keys[a] < keys[b]; };
+  size_t end = order.size();
+  while(end > k_MinRoundSize)
+  {
+    size_t start = end / 2;
+    std::sort(order.begin() + start, order.begin() + end, byCurve);
+    end = start;
+  }
+  std::sort(order.begin(), order.begin() + end, byCurve);
+
+  return order;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
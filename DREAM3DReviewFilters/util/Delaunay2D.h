@@ -131,6 +131,8 @@ private:
 
   void findPointBounds(TriMesh::VertexCoordList& vertices);
 
+  std::vector<int64_t> findInsertionOrder(const TriMesh::VertexCoordList& vertices) const;
+
   void fixupBoundaryTriangles(int64_t numVerts, TriMesh::VertexCoordList& points, std::vector<int64_t>& triUse);
 
   double circumcircle(double a[2], double b[2], double c[2], double center[2]);
@@ -32,6 +32,11 @@
 
 #pragma once
 
+#include <array>
+#include <cmath>
+
+#include <Eigen/Dense>
+
 #include "SIMPLib/Math/SIMPLibMath.h"
 
 namespace EigenstrainsHelper
@@ -64,6 +69,13 @@ struct Tensor4D
 };
 
 using Tensor4DType = Tensor4D<double, 3, 3, 3, 3>;
+using Matrix6Type = Eigen::Matrix<double, 6, 6>;
+using Vector6Type = Eigen::Matrix<double, 6, 1>;
+
+/**
+ * @brief Tensor indices (i, j) of the six Mandel/Voigt components, in the 11, 22, 33, 23, 13, 12 order used by the strain arrays
+ */
+constexpr size_t k_MandelIndices[6][2] = {{0, 0}, {1, 1}, {2, 2}, {1, 2}, {0, 2}, {0, 1}};
 
 // -----------------------------------------------------------------------------
 // Calculates 32-point Gaussian quadrature of the input function
@@ -261,4 +273,67 @@ Tensor4DType find_eshelby(double a, double b, double c, double nu, bool ellipsoi
   }
   return eshelbyTensor;
 }
+
+// -----------------------------------------------------------------------------
+// Weight applied to Mandel component m; shear components are scaled by sqrt(2) so the 6x6 form of a
+// minor-symmetric fourth-rank tensor composes and inverts exactly like the tensor itself
+// -----------------------------------------------------------------------------
+inline double mandel_weight(size_t m)
+{
+  return m < 3 ? 1.0 : 1.41421356237309504880;
+}
+
+// -----------------------------------------------------------------------------
+// Maps a minor-symmetric fourth-rank tensor into its 6x6 Mandel matrix
+// -----------------------------------------------------------------------------
+inline Matrix6Type mandel_matrix(const Tensor4DType& tensor)
+{
+  Matrix6Type matrix;
+  for(size_t m = 0; m < 6; m++)
+  {
+    for(size_t n = 0; n < 6; n++)
+    {
+      matrix(m, n) = mandel_weight(m) * mandel_weight(n) * tensor(k_MandelIndices[m][0], k_MandelIndices[m][1], k_MandelIndices[n][0], k_MandelIndices[n][1]);
+    }
+  }
+  return matrix;
+}
+
+// -----------------------------------------------------------------------------
+// Maps a symmetric second-rank tensor into its 6-component Mandel vector
+// -----------------------------------------------------------------------------
+inline Vector6Type mandel_vector(const Eigen::Matrix3d& tensor)
+{
+  Vector6Type vector;
+  for(size_t m = 0; m < 6; m++)
+  {
+    vector(m) = mandel_weight(m) * tensor(k_MandelIndices[m][0], k_MandelIndices[m][1]);
+  }
+  return vector;
+}
+
+// -----------------------------------------------------------------------------
+// Maps a 6-component Mandel vector back into a symmetric second-rank tensor
+// -----------------------------------------------------------------------------
+inline Eigen::Matrix3d mandel_tensor(const Vector6Type& vector)
+{
+  Eigen::Matrix3d tensor;
+  for(size_t m = 0; m < 6; m++)
+  {
+    const double value = vector(m) / mandel_weight(m);
+    tensor(k_MandelIndices[m][0], k_MandelIndices[m][1]) = value;
+    tensor(k_MandelIndices[m][1], k_MandelIndices[m][0]) = value;
+  }
+  return tensor;
+}
+
+// -----------------------------------------------------------------------------
+// Calculates (S-I)^-1 in Mandel form, which maps the elastic strain of an inclusion to its eigenstrain in the
+// ellipsoid reference frame | e*' = (S-I)^-1 e'
+// -----------------------------------------------------------------------------
+inline Matrix6Type find_eshelby_inverse(double a, double b, double c, double nu, bool ellipsoidal)
+{
+  Matrix6Type eshelbyMatrix = mandel_matrix(find_eshelby(a, b, c, nu, ellipsoidal));
+  return (eshelbyMatrix - Matrix6Type::Identity()).inverse();
+}
 } // namespace EigenstrainsHelper
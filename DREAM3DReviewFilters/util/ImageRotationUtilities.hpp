@@ -1,14 +1,19 @@
 #pragma once
 
 #include "SIMPLib/Common/SIMPLArray.hpp"
+#include "SIMPLib/Common/SIMPLRange.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include <Eigen/Dense>
 
+#include <algorithm>
+#include <array>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 using Matrix3fR = Eigen::Matrix<float, 3, 3, Eigen::RowMajor>;
 using Matrix4fR = Eigen::Matrix<float, 4, 4, Eigen::RowMajor>;
@@ -46,39 +51,19 @@ struct RotateArgs
   float zMinNew = 0.0f;
 };
 
-template <typename T>
-T inline GetSourceArrayValue(const RotateArgs& params, Vector3i64 xyzIndex, DataArray<T>& sourceArray, size_t compIndex)
+/**
+ * @brief GetSourceTupleIndex Clamps the given voxel index to the source geometry and returns the tuple index
+ * @param params
+ * @param xyzIndex
+ * @return
+ */
+inline size_t GetSourceTupleIndex(const RotateArgs& params, Vector3i64 xyzIndex)
 {
-  if(xyzIndex[0] < 0)
-  {
-    xyzIndex[0] = 0;
-  }
-  if(xyzIndex[0] >= params.xp)
-  {
-    xyzIndex[0] = params.xp - 1;
-  }
-
-  if(xyzIndex[1] < 0)
-  {
-    xyzIndex[1] = 0;
-  }
-  if(xyzIndex[1] >= params.yp)
-  {
-    xyzIndex[1] = params.yp - 1;
-  }
-
-  if(xyzIndex[2] < 0)
-  {
-    xyzIndex[2] = 0;
-  }
-  if(xyzIndex[2] >= params.zp)
-  {
-    xyzIndex[2] = params.zp - 1;
-  }
+  xyzIndex[0] = std::clamp(xyzIndex[0], static_cast<int64_t>(0), params.xp - 1);
+  xyzIndex[1] = std::clamp(xyzIndex[1], static_cast<int64_t>(0), params.yp - 1);
+  xyzIndex[2] = std::clamp(xyzIndex[2], static_cast<int64_t>(0), params.zp - 1);
 
-  // Now just compute the proper index
-  size_t index = (xyzIndex[2] * params.xp * params.yp) + (xyzIndex[1] * params.xp) + xyzIndex[0];
-  return sourceArray[index * sourceArray.getNumberOfComponents() + compIndex];
+  return static_cast<size_t>((xyzIndex[2] * params.xp * params.yp) + (xyzIndex[1] * params.xp) + xyzIndex[0]);
 }
 
 /**
@@ -152,186 +137,160 @@ static const OctantOffsetArrayType k_IndexOffset7 = {Vector3i64{-1, 0, 0}, Vecto
 static const std::array<OctantOffsetArrayType, 8> k_AllOctantOffsets{k_IndexOffset0, k_IndexOffset1, k_IndexOffset2, k_IndexOffset3, k_IndexOffset4, k_IndexOffset5, k_IndexOffset6, k_IndexOffset7};
 
 /**
- * @brief FindInterpolationValues
+ * @brief FindInterpolationIndices Finds the 8 source tuples surrounding the inverse transformed point along with the
+ * offsets of the point from the first of those tuples
  * @param params
- * @param index
  * @param octant
  * @param oldIndicesU
  * @param oldCoords
- * @param sourceArray
- * @param pValues
+ * @param tupleIndices
  * @param uvw
  */
-template <typename T>
-inline void FindInterpolationValues(const RotateArgs& params, size_t index, size_t octant, Vector3s oldIndicesU, Eigen::Array4f& oldCoords, DataArray<T>& sourceArray, std::vector<T>& pValues,
-                                    Eigen::Vector3f& uvw)
+inline void FindInterpolationIndices(const RotateArgs& params, size_t octant, const Vector3s& oldIndicesU, const Eigen::Array4f& oldCoords, std::array<size_t, 8>& tupleIndices, Eigen::Vector3f& uvw)
 {
   const std::array<Vector3i64, 8>& indexOffset = k_AllOctantOffsets[octant];
 
   Vector3i64 oldIndices(static_cast<int64_t>(oldIndicesU[0]), static_cast<int64_t>(oldIndicesU[1]), static_cast<int64_t>(oldIndicesU[2]));
-  size_t numComps = sourceArray.getNumberOfComponents();
-
-  Vector3i64 pIndices;
-  Eigen::Vector3f p1Coord;
-
-  auto origin = params.origImageGeom->getOrigin();
 
   for(size_t i = 0; i < 8; i++)
   {
-    auto pIndices = oldIndices + indexOffset[i];
-    for(size_t compIndex = 0; compIndex < numComps; compIndex++)
-    {
-      T value = GetSourceArrayValue<T>(params, pIndices, sourceArray, compIndex);
-      pValues[i * numComps + compIndex] = value;
-    }
-    if(i == 0)
-    {
-      p1Coord = {pIndices[0] * params.xRes + (0.5F * params.xRes) + origin[0], pIndices[1] * params.yRes + (0.5F * params.yRes) + origin[1],
-                 pIndices[2] * params.zRes + (0.5F * params.zRes) + origin[2]};
-    }
+    tupleIndices[i] = GetSourceTupleIndex(params, oldIndices + indexOffset[i]);
   }
-  uvw[0] = oldCoords[0] - p1Coord[0];
-  uvw[1] = oldCoords[1] - p1Coord[1];
-  uvw[2] = oldCoords[2] - p1Coord[2];
+
+  auto origin = params.origImageGeom->getOrigin();
+  Vector3i64 p1Indices = oldIndices + indexOffset[0];
+  uvw[0] = oldCoords[0] - (p1Indices[0] * params.xRes + (0.5F * params.xRes) + origin[0]);
+  uvw[1] = oldCoords[1] - (p1Indices[1] * params.yRes + (0.5F * params.yRes) + origin[1]);
+  uvw[2] = oldCoords[2] - (p1Indices[2] * params.zRes + (0.5F * params.zRes) + origin[2]);
 }
 
 /**
- * @brief The RotateImageGeometryWithTrilinearInterpolation class
+ * @brief The ResamplingPlan class maps each voxel of the transformed geometry back into the original geometry. The
+ * plan is generated one row of output voxels at a time so that it can be shared by every resampled array without
+ * storing a full volume of indices and weights.
  */
-template <typename T, class FilterType>
-class RotateImageGeometryWithNearestNeighbor
+class ResamplingPlan
 {
-private:
-  FilterType* m_Filter = nullptr;
-  IDataArray::Pointer m_SourceArray;
-  IDataArray::Pointer m_TargetArray;
-  ImageRotationUtilities::RotateArgs m_Params;
-  Matrix4fR m_TransformationMatrix;
-
 public:
-  RotateImageGeometryWithNearestNeighbor(FilterType* filter, IDataArray::Pointer& sourceArray, IDataArray::Pointer& targetArray, RotateArgs& rotateArgs, Matrix4fR& transformationMatrix)
-  : m_Filter(filter)
-  , m_SourceArray(sourceArray)
-  , m_TargetArray(targetArray)
-  , m_Params(rotateArgs)
-  , m_TransformationMatrix(transformationMatrix)
+  /**
+   * @brief The Row struct holds the mapping for one row (fixed Y and Z) of output voxels. A source index of -1 marks
+   * an output voxel that falls outside of the original geometry.
+   */
+  struct Row
   {
+    std::vector<int64_t> sourceIndex;
+    std::vector<std::array<size_t, 8>> corners;
+    std::vector<Eigen::Vector3f> uvw;
+  };
+
+  ResamplingPlan(const RotateArgs& params, const Matrix4fR& transformationMatrix, bool computeWeights)
+  : m_Params(params)
+  , m_InverseTransform(transformationMatrix.inverse())
+  , m_ComputeWeights(computeWeights)
+  {
+  }
+
+  const RotateArgs& getParams() const
+  {
+    return m_Params;
+  }
+
+  bool hasWeights() const
+  {
+    return m_ComputeWeights;
   }
 
   /**
-   * @brief This is the main algorithm to perform the interpolation and get a final value that is placed into the transformed
-   * voxel. This uses Trilinear interpolation which will devolve into Bilinear and Linear interpolation depending on the
-   * values of U, V and W.
+   * @brief computeRow Fills the mapping for the output row at the given Y and Z index
+   * @param j
+   * @param k
+   * @param row
    */
-  void operator()() const
+  void computeRow(int64_t j, int64_t k, Row& row) const
   {
-    using DataArrayType = DataArray<T>;
-    using DataArrayPointerType = typename DataArrayType::Pointer;
-
-    DataArrayPointerType sourceArrayPtr = std::dynamic_pointer_cast<DataArrayType>(m_SourceArray);
-    DataArrayType& sourceArray = *(sourceArrayPtr.get());
-    const size_t numComps = sourceArray.getNumberOfComponents();
-    if(numComps == 0)
+    const size_t xpNew = static_cast<size_t>(m_Params.xpNew);
+    row.sourceIndex.resize(xpNew);
+    if(m_ComputeWeights)
     {
-      m_Filter->setErrorCondition(-1000, "Invalid DataArray with ZERO components");
-      m_Filter->sendThreadSafeProgressMessage(QString("%1: Number of Components was Zero for array. Exiting Transform.").arg(sourceArray.getName()));
-      return;
+      row.corners.resize(xpNew);
+      row.uvw.resize(xpNew);
     }
 
-    m_Filter->sendThreadSafeProgressMessage(QString("%1: Transform Starting").arg(sourceArray.getName()));
-
-    DataArrayPointerType targetArrayPtr = std::dynamic_pointer_cast<DataArrayType>(m_TargetArray);
-
-    //    std::ofstream originalPointsFile("/tmp/original_point_centers.csv", std::ios_base::binary);
-    //    originalPointsFile << "x,y,z" << std::endl;
-    //    std::ofstream transformedPointsFile("/tmp/transformed_point_centers.csv", std::ios_base::binary);
-    //    transformedPointsFile << "x,y,z,index,error" << std::endl;
-
     Vector3s origImageGeomDims(m_Params.origImageGeom->getDimensions().data());
-    Eigen::Vector3f coordsOld(0.0F, 0.0F, 0.0F);
-
-    // TrilinearInterpolationData<T> interpolationValues;
     Vector3s oldGeomIndices = {std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()};
 
     Eigen::Vector4f coordsNew;
-    std::vector<T> pValues(8 * numComps);
-    Eigen::Vector3f uvw;
-
-    Matrix4fR inverseTransform = m_TransformationMatrix.inverse();
+    coordsNew[1] = (static_cast<float>(j) * m_Params.yResNew) + m_Params.yMinNew + 0.5F * m_Params.yResNew;
+    coordsNew[2] = (static_cast<float>(k) * m_Params.zResNew) + m_Params.zMinNew + 0.5F * m_Params.zResNew;
+    coordsNew[3] = 1.0F; // We take translation into account
 
-    for(int64_t k = 0; k < m_Params.zpNew; k++)
+    for(size_t i = 0; i < xpNew; i++)
     {
-      if(m_Filter->getCancel() || m_Filter->getErrorCode() < 0)
+      coordsNew[0] = (static_cast<float>(i) * m_Params.xResNew) + m_Params.xMinNew + 0.5F * m_Params.xResNew;
+
+      Eigen::Array4f coordsOld = m_InverseTransform * coordsNew;
+
+      auto errorResult = m_Params.origImageGeom->computeCellIndex(coordsOld.data(), oldGeomIndices.data());
+      if(errorResult != ImageGeom::ErrorType::NoError)
       {
-        break;
+        row.sourceIndex[i] = -1;
+        continue;
       }
-      int64_t ktot = (m_Params.xpNew * m_Params.ypNew) * k;
 
-      m_Filter->sendThreadSafeProgressMessage(QString("%1: Interpolating values for slice '%2/%3'").arg(m_SourceArray->getName()).arg(k).arg(m_Params.zpNew));
-      for(int64_t j = 0; j < m_Params.ypNew; j++)
+      size_t oldIndex = (origImageGeomDims[0] * origImageGeomDims[1] * oldGeomIndices[2]) + (origImageGeomDims[0] * oldGeomIndices[1]) + oldGeomIndices[0];
+      row.sourceIndex[i] = static_cast<int64_t>(oldIndex);
+      if(m_ComputeWeights)
       {
-        int64_t jtot = (m_Params.xpNew) * j;
-        for(int64_t i = 0; i < m_Params.xpNew; i++)
-        {
-          int64_t newIndex = ktot + jtot + i;
-
-          coordsNew[0] = (static_cast<float>(i) * m_Params.xResNew) + m_Params.xMinNew + 0.5F * m_Params.xResNew;
-          coordsNew[1] = (static_cast<float>(j) * m_Params.yResNew) + m_Params.yMinNew + 0.5F * m_Params.yResNew;
-          coordsNew[2] = (static_cast<float>(k) * m_Params.zResNew) + m_Params.zMinNew + 0.5F * m_Params.zResNew;
-          coordsNew[3] = 1.0F; // We take translation into account
-
-          Eigen::Array4f coordsOld = inverseTransform * coordsNew;
-
-          auto errorResult = m_Params.origImageGeom->computeCellIndex(coordsOld.data(), oldGeomIndices.data());
-
-          if(errorResult == ImageGeom::ErrorType::NoError)
-          {
-            size_t oldIndex = (origImageGeomDims[0] * origImageGeomDims[1] * oldGeomIndices[2]) + (origImageGeomDims[0] * oldGeomIndices[1]) + oldGeomIndices[0];
-
-            if(!m_TargetArray->copyFromArray(newIndex, m_SourceArray, oldIndex, 1))
-            {
-              std::cout << "Array copy failed:\n    Source Array Name: '" << m_SourceArray->getName().toStdString() << "' Source Tuple Index: " << oldIndex << "\n    Dest Array Name:   '"
-                        << m_SourceArray->getName().toStdString() << "'   Dest. Tuple Index " << newIndex << "\n"
-                        << std::endl;
-              break;
-            }
-          }
-          else
-          {
-            T value = static_cast<T>(0);
-            targetArrayPtr->fillTuple(newIndex, value);
-          }
-        }
+        size_t octant = FindOctant(m_Params, oldIndex, {coordsOld.data()});
+        FindInterpolationIndices(m_Params, octant, oldGeomIndices, coordsOld, row.corners[i], row.uvw[i]);
       }
     }
+  }
 
-    m_SourceArray->resizeTuples(0);
+private:
+  RotateArgs m_Params;
+  Matrix4fR m_InverseTransform;
+  bool m_ComputeWeights = false;
+};
 
-    m_Filter->sendThreadSafeProgressMessage(QString("%1: Transform Ending").arg(sourceArray.getName()));
-  }
+/**
+ * @brief The IResampledArray class is the type erased interface used to apply a row of the ResamplingPlan to
+ * each of the arrays being transformed.
+ */
+class IResampledArray
+{
+public:
+  virtual ~IResampledArray() = default;
+
+  /**
+   * @brief applyRow Writes the output voxels of the given plan row, starting at the output tuple newIndexOffset
+   * @param row
+   * @param newIndexOffset
+   * @param linear Use trilinear interpolation instead of nearest neighbor
+   */
+  virtual void applyRow(const ResamplingPlan::Row& row, size_t newIndexOffset, bool linear) = 0;
+
+  /**
+   * @brief releaseSource Frees the memory of the source array once all rows have been applied
+   */
+  virtual void releaseSource() = 0;
 };
 
 /**
- * @brief The RotateImageGeometryWithTrilinearInterpolation class
+ * @brief The ResampledArray class gathers values from a source array into a target array using a ResamplingPlan row
  */
-template <typename T, class FilterType>
-class RotateImageGeometryWithTrilinearInterpolation
+template <typename T>
+class ResampledArray : public IResampledArray
 {
-private:
-  FilterType* m_Filter = nullptr;
-  IDataArray::Pointer m_SourceArray;
-  IDataArray::Pointer m_TargetArray;
-  ImageRotationUtilities::RotateArgs m_Params;
-  Matrix4fR m_TransformationMatrix;
 public:
-  RotateImageGeometryWithTrilinearInterpolation(FilterType* filter, IDataArray::Pointer& sourceArray, IDataArray::Pointer& targetArray, RotateArgs& rotateArgs, Matrix4fR& transformationMatrix)
-  : m_Filter(filter)
-  , m_SourceArray(sourceArray)
-  , m_TargetArray(targetArray)
-  , m_Params(rotateArgs)
-  , m_TransformationMatrix(transformationMatrix)
+  ResampledArray(typename DataArray<T>::Pointer sourceArray, typename DataArray<T>::Pointer targetArray)
+  : m_SourceArray(sourceArray)
+  , m_Source(sourceArray->getPointer(0))
+  , m_Target(targetArray->getPointer(0))
+  , m_NumComps(sourceArray->getNumberOfComponents())
   {
   }
+  ~ResampledArray() override = default;
 
   /**
    * @brief CalculateInterpolatedValue
@@ -342,200 +301,152 @@ public:
    * the subtractions. This should hopefully alleviate issue with trying to subtract unsigned integers
    * and ending up with what should have been a negative number but since it is unsigned the value
    * that the compiler will compute would be vastly different.
-   *
-   * @param sourceArray
-   * @param oldIndex
-   * @param indices
-   * @return
    */
-  T CalculateInterpolatedValue(std::vector<T>& pValues, Eigen::Vector3f& uvw, size_t numComps, size_t compIndex) const
+  T calculateInterpolatedValue(const std::array<size_t, 8>& corners, const Eigen::Vector3f& uvw, size_t compIndex) const
   {
-    constexpr size_t P1 = 0;
-    constexpr size_t P2 = 1;
-    constexpr size_t P3 = 2;
-    constexpr size_t P4 = 3;
-    constexpr size_t P5 = 4;
-    constexpr size_t P6 = 5;
-    constexpr size_t P7 = 6;
-    constexpr size_t P8 = 7;
-
     const float u = uvw[0];
     const float v = uvw[1];
     const float w = uvw[2];
 
-    T value = pValues[0];
-    // clang-format off
-    value += u * (pValues[P2 * numComps + compIndex] - pValues[P1 * numComps + compIndex]);
-    value += v * (pValues[P4 * numComps + compIndex] - pValues[P1 * numComps + compIndex]);
-    value += w * (pValues[P5 * numComps + compIndex] - pValues[P1 * numComps + compIndex]);
-    value += u * v * (pValues[P1 * numComps + compIndex] + pValues[P3 * numComps + compIndex] - pValues[P2 * numComps + compIndex] - pValues[P4 * numComps + compIndex]);
-    value += u * w * (pValues[P1 * numComps + compIndex] + pValues[P6 * numComps + compIndex] - pValues[P2 * numComps + compIndex] - pValues[P5 * numComps + compIndex]);
-    value += v * w * (pValues[P1 * numComps + compIndex] + pValues[P8 * numComps + compIndex] - pValues[P4 * numComps + compIndex] - pValues[P5 * numComps + compIndex]);
-    value += u * v * w *
-             ( pValues[P4 * numComps + compIndex]
-              + pValues[P2 * numComps + compIndex]
-              + pValues[P8 * numComps + compIndex]
-              + pValues[P6 * numComps + compIndex]
-              - pValues[P1 * numComps + compIndex]
-              - pValues[P3 * numComps + compIndex]
-              - pValues[P5 * numComps + compIndex]
-              - pValues[P7 * numComps + compIndex] );
-
-    // clang-format on
+    const T p1 = m_Source[corners[0] * m_NumComps + compIndex];
+    const T p2 = m_Source[corners[1] * m_NumComps + compIndex];
+    const T p3 = m_Source[corners[2] * m_NumComps + compIndex];
+    const T p4 = m_Source[corners[3] * m_NumComps + compIndex];
+    const T p5 = m_Source[corners[4] * m_NumComps + compIndex];
+    const T p6 = m_Source[corners[5] * m_NumComps + compIndex];
+    const T p7 = m_Source[corners[6] * m_NumComps + compIndex];
+    const T p8 = m_Source[corners[7] * m_NumComps + compIndex];
+
+    T value = p1;
+    value += u * (p2 - p1);
+    value += v * (p4 - p1);
+    value += w * (p5 - p1);
+    value += u * v * (p1 + p3 - p2 - p4);
+    value += u * w * (p1 + p6 - p2 - p5);
+    value += v * w * (p1 + p8 - p4 - p5);
+    value += u * v * w * (p4 + p2 + p8 + p6 - p1 - p3 - p5 - p7);
     return value;
   }
 
-  /**
-   * @brief This is the main algorithm to perform the interpolation and get a final value that is placed into the transformed
-   * voxel. This uses Trilinear interpolation which will devolve into Bilinear and Linear interpolation depending on the
-   * values of U, V and W.
-   */
-  void operator()() const
+  void applyRow(const ResamplingPlan::Row& row, size_t newIndexOffset, bool linear) override
   {
-    using DataArrayType = DataArray<T>;
-    using DataArrayPointerType = typename DataArrayType::Pointer;
-
-    DataArrayPointerType sourceArrayPtr = std::dynamic_pointer_cast<DataArrayType>(m_SourceArray);
-    DataArrayType& sourceArray = *(sourceArrayPtr.get());
-    const size_t numComps = sourceArray.getNumberOfComponents();
-    if(numComps == 0)
+    const size_t numVoxels = row.sourceIndex.size();
+    T* target = m_Target + newIndexOffset * m_NumComps;
+    for(size_t i = 0; i < numVoxels; i++)
     {
-      m_Filter->setErrorCondition(-1000, "Invalid DataArray with ZERO components");
-      m_Filter->sendThreadSafeProgressMessage(QString("%1: Number of Components was Zero for array. Exiting Transform.").arg(sourceArray.getName()));
-      return;
-    }
-
-    m_Filter->sendThreadSafeProgressMessage(QString("%1: Transform Starting").arg(sourceArray.getName()));
-
-    DataArrayPointerType targetArrayPtr = std::dynamic_pointer_cast<DataArrayType>(m_TargetArray);
-
-    //    std::ofstream originalPointsFile("/tmp/original_point_centers.csv", std::ios_base::binary);
-    //    originalPointsFile << "x,y,z" << std::endl;
-    //    std::ofstream transformedPointsFile("/tmp/transformed_point_centers.csv", std::ios_base::binary);
-    //    transformedPointsFile << "x,y,z,index,error" << std::endl;
-
-    Vector3s origImageGeomDims(m_Params.origImageGeom->getDimensions().data());
-    Eigen::Vector3f coordsOld(0.0F, 0.0F, 0.0F);
-
-    // TrilinearInterpolationData<T> interpolationValues;
-    Vector3s oldGeomIndices = {std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()};
-
-    Eigen::Vector4f coordsNew;
-    std::vector<T> pValues(8 * numComps);
-    Eigen::Vector3f uvw;
-
-    Matrix4fR inverseTransform = m_TransformationMatrix.inverse();
-
-    for(int64_t k = 0; k < m_Params.zpNew; k++)
-    {
-      if(m_Filter->getCancel() || m_Filter->getErrorCode() < 0)
+      T* dest = target + i * m_NumComps;
+      const int64_t sourceIndex = row.sourceIndex[i];
+      if(sourceIndex < 0)
       {
-        break;
+        std::fill(dest, dest + m_NumComps, static_cast<T>(0));
       }
-      int64_t ktot = (m_Params.xpNew * m_Params.ypNew) * k;
-
-      m_Filter->sendThreadSafeProgressMessage(QString("%1: Interpolating values for slice '%2/%3'").arg(m_SourceArray->getName()).arg(k).arg(m_Params.zpNew));
-      for(int64_t j = 0; j < m_Params.ypNew; j++)
+      else if(linear)
       {
-        int64_t jtot = (m_Params.xpNew) * j;
-        for(int64_t i = 0; i < m_Params.xpNew; i++)
+        for(size_t compIndex = 0; compIndex < m_NumComps; compIndex++)
         {
-          int64_t newIndex = ktot + jtot + i;
-
-          coordsNew[0] = (static_cast<float>(i) * m_Params.xResNew) + m_Params.xMinNew + 0.5F * m_Params.xResNew;
-          coordsNew[1] = (static_cast<float>(j) * m_Params.yResNew) + m_Params.yMinNew + 0.5F * m_Params.yResNew;
-          coordsNew[2] = (static_cast<float>(k) * m_Params.zResNew) + m_Params.zMinNew + 0.5F * m_Params.zResNew;
-          coordsNew[3] = 1.0F; // We take translation into account
-
-          Eigen::Array4f coordsOld = inverseTransform * coordsNew;
-
-          auto errorResult = m_Params.origImageGeom->computeCellIndex(coordsOld.data(), oldGeomIndices.data());
-          //          transformedPointsFile << coordsNew[0] << "," << coordsNew[1] << "," << coordsNew[2] << "," << newIndex << "," << static_cast<int32_t>(errorResult) << std::endl;
-          //          originalPointsFile << coordsOld[0] << "," << coordsOld[1] << "," << coordsOld[2]
-          //          << ","
-          //                             << oldIndex
-          /* << "," << value */
-          //                             << std::endl;
-          // Now we know what voxel the new cell center maps back to in the original geometry.
-          if(errorResult == ImageGeom::ErrorType::NoError)
-          {
-            size_t oldIndex = (origImageGeomDims[0] * origImageGeomDims[1] * oldGeomIndices[2]) + (origImageGeomDims[0] * oldGeomIndices[1]) + oldGeomIndices[0];
-            int octant = FindOctant(m_Params, oldIndex, {coordsOld.data()});
-
-            FindInterpolationValues(m_Params, oldIndex, octant, oldGeomIndices, coordsOld, sourceArray, pValues, uvw);
-            for(size_t compIndex = 0; compIndex < numComps; compIndex++)
-            {
-              T value = CalculateInterpolatedValue(pValues, uvw, numComps, compIndex);
-              targetArrayPtr->setComponent(newIndex, compIndex, value);
-            }
-          }
-          else
-          {
-            T value = static_cast<T>(0);
-            targetArrayPtr->fillTuple(newIndex, value);
-          }
+          dest[compIndex] = calculateInterpolatedValue(row.corners[i], row.uvw[i], compIndex);
         }
       }
+      else
+      {
+        const T* src = m_Source + static_cast<size_t>(sourceIndex) * m_NumComps;
+        std::copy(src, src + m_NumComps, dest);
+      }
     }
+  }
 
+  void releaseSource() override
+  {
     m_SourceArray->resizeTuples(0);
-
-    m_Filter->sendThreadSafeProgressMessage(QString("%1: Transform Ending").arg(sourceArray.getName()));
+    m_Source = nullptr;
   }
+
+private:
+  typename DataArray<T>::Pointer m_SourceArray;
+  const T* m_Source = nullptr;
+  T* m_Target = nullptr;
+  size_t m_NumComps = 0;
 };
 
 /**
- * @brief ExecuteParallelFunction
+ * @brief CreateResampledArray Wraps the source and target arrays in the matching ResampledArray. Returns a null
+ * pointer for array types that can not be interpolated (bool, string, StatsData...)
  * @param sourceArray
- * @param runner
- * @param args
+ * @param targetArray
+ * @return
  */
-template <template <class, class> class ClassT, class ParallelRunnerT, class FilterType, class... ArgsT>
-auto ExecuteParallelFunction(IDataArray::Pointer& sourceArray, ParallelRunnerT&& runner, FilterType* filter, ArgsT&&... args)
+template <typename T>
+std::unique_ptr<IResampledArray> CreateResampledArrayAs(const IDataArray::Pointer& sourceArray, const IDataArray::Pointer& targetArray)
 {
-
-  if(DataArray<int8_t>::Pointer array = std::dynamic_pointer_cast<DataArray<int8_t>>(sourceArray))
-  {
-    return runner.template execute<>(ClassT<int8_t, FilterType>(std::forward<ArgsT>(args)...));
-  }
-  if(DataArray<int16_t>::Pointer array = std::dynamic_pointer_cast<DataArray<int16_t>>(sourceArray))
+  typename DataArray<T>::Pointer source = std::dynamic_pointer_cast<DataArray<T>>(sourceArray);
+  typename DataArray<T>::Pointer target = std::dynamic_pointer_cast<DataArray<T>>(targetArray);
+  if(nullptr == source || nullptr == target)
   {
-    return runner.template execute<>(ClassT<int16_t, FilterType>(std::forward<ArgsT>(args)...));
+    return nullptr;
   }
-  if(DataArray<int32_t>::Pointer array = std::dynamic_pointer_cast<DataArray<int32_t>>(sourceArray))
-  {
-    return runner.template execute<>(ClassT<int32_t, FilterType>(std::forward<ArgsT>(args)...));
-  }
-  if(DataArray<int64_t>::Pointer array = std::dynamic_pointer_cast<DataArray<int64_t>>(sourceArray))
-  {
-    return runner.template execute<>(ClassT<int64_t, FilterType>(std::forward<ArgsT>(args)...));
-  }
-  if(DataArray<uint8_t>::Pointer array = std::dynamic_pointer_cast<DataArray<uint8_t>>(sourceArray))
-  {
-    return runner.template execute<>(ClassT<uint8_t, FilterType>(std::forward<ArgsT>(args)...));
-  }
-  if(DataArray<uint16_t>::Pointer array = std::dynamic_pointer_cast<DataArray<uint16_t>>(sourceArray))
-  {
-    return runner.template execute<>(ClassT<uint16_t, FilterType>(std::forward<ArgsT>(args)...));
-  }
-  if(DataArray<uint32_t>::Pointer array = std::dynamic_pointer_cast<DataArray<uint32_t>>(sourceArray))
-  {
-    return runner.template execute<>(ClassT<uint32_t, FilterType>(std::forward<ArgsT>(args)...));
-  }
-  if(DataArray<uint64_t>::Pointer array = std::dynamic_pointer_cast<DataArray<uint64_t>>(sourceArray))
+  return std::make_unique<ResampledArray<T>>(source, target);
+}
+
+inline std::unique_ptr<IResampledArray> CreateResampledArray(const IDataArray::Pointer& sourceArray, const IDataArray::Pointer& targetArray)
+{
+  std::unique_ptr<IResampledArray> resampled;
+  if((resampled = CreateResampledArrayAs<int8_t>(sourceArray, targetArray)) || (resampled = CreateResampledArrayAs<int16_t>(sourceArray, targetArray)) ||
+     (resampled = CreateResampledArrayAs<int32_t>(sourceArray, targetArray)) || (resampled = CreateResampledArrayAs<int64_t>(sourceArray, targetArray)) ||
+     (resampled = CreateResampledArrayAs<uint8_t>(sourceArray, targetArray)) || (resampled = CreateResampledArrayAs<uint16_t>(sourceArray, targetArray)) ||
+     (resampled = CreateResampledArrayAs<uint32_t>(sourceArray, targetArray)) || (resampled = CreateResampledArrayAs<uint64_t>(sourceArray, targetArray)) ||
+     (resampled = CreateResampledArrayAs<float>(sourceArray, targetArray)) || (resampled = CreateResampledArrayAs<double>(sourceArray, targetArray)))
   {
-    return runner.template execute<>(ClassT<uint64_t, FilterType>(std::forward<ArgsT>(args)...));
+    return resampled;
   }
-  if(DataArray<float>::Pointer array = std::dynamic_pointer_cast<DataArray<float>>(sourceArray))
+  return nullptr;
+}
+
+/**
+ * @brief The ResampleImageGeometryImpl class applies a ResamplingPlan to every array over a slab of output Z slices.
+ * Each plan row is computed once and then gathered into all of the arrays while it is still in cache.
+ */
+template <class FilterType>
+class ResampleImageGeometryImpl
+{
+public:
+  ResampleImageGeometryImpl(FilterType* filter, const ResamplingPlan& plan, const std::vector<std::unique_ptr<IResampledArray>>& arrays)
+  : m_Filter(filter)
+  , m_Plan(plan)
+  , m_Arrays(arrays)
   {
-    return runner.template execute<>(ClassT<float, FilterType>(std::forward<ArgsT>(args)...));
   }
-  if(DataArray<double>::Pointer array = std::dynamic_pointer_cast<DataArray<double>>(sourceArray))
+
+  void operator()(const SIMPLRange& range) const
   {
-    return runner.template execute<>(ClassT<double, FilterType>(std::forward<ArgsT>(args)...));
+    const RotateArgs& params = m_Plan.getParams();
+    const bool linear = m_Plan.hasWeights();
+    ResamplingPlan::Row row;
+
+    for(size_t k = range.min(); k < range.max(); k++)
+    {
+      if(m_Filter->getCancel() || m_Filter->getErrorCode() < 0)
+      {
+        break;
+      }
+      m_Filter->sendThreadSafeProgressMessage(QString("Interpolating values for slice '%1/%2'").arg(k).arg(params.zpNew));
+
+      size_t ktot = static_cast<size_t>(params.xpNew * params.ypNew) * k;
+      for(int64_t j = 0; j < params.ypNew; j++)
+      {
+        m_Plan.computeRow(j, static_cast<int64_t>(k), row);
+        size_t newIndexOffset = ktot + static_cast<size_t>(params.xpNew * j);
+        for(const auto& array : m_Arrays)
+        {
+          array->applyRow(row, newIndexOffset, linear);
+        }
+      }
+    }
   }
 
-  throw std::runtime_error("Can not interpolate data type. Bool, String, StatsData?");
-}
+private:
+  FilterType* m_Filter = nullptr;
+  const ResamplingPlan& m_Plan;
+  const std::vector<std::unique_ptr<IResampledArray>>& m_Arrays;
+};
 
 } // namespace ImageRotationUtilities
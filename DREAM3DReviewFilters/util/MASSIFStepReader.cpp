@@ -0,0 +1,472 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "MASSIFStepReader.h"
+
+#include <algorithm>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/StringOperations.h"
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/H5Utilities.h"
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "DREAM3DReview/DREAM3DReviewConstants.h"
+
+using namespace H5Support;
+
+namespace MassifConstants = MASSIFUtilitiesConstants::ImportMassifData;
+
+namespace Detail
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const std::vector<size_t>& tDims, const std::vector<size_t>& cDims)
+{
+  herr_t err = -1;
+  IDataArray::Pointer ptr;
+
+  ptr = DataArray<T>::CreateArray(tDims, cDims, datasetPath, true);
+
+  T* data = (T*)(ptr->getVoidPointer(0));
+  err = QH5Lite::readPointerDataset(locId, datasetPath, data);
+  if(err < 0)
+  {
+    ptr = IDataArray::NullPointer();
+  }
+  return ptr;
+}
+} // namespace Detail
+
+// -----------------------------------------------------------------------------
+MASSIFStepReader::MASSIFStepReader(const QString& filePath, const QString& filePrefix, size_t maxCachedSteps)
+: m_FilePath(filePath)
+, m_FilePrefix(filePrefix)
+, m_MaxCachedSteps(std::max(maxCachedSteps, static_cast<size_t>(1)))
+{
+}
+
+// -----------------------------------------------------------------------------
+MASSIFStepReader::~MASSIFStepReader()
+{
+  close();
+}
+
+// -----------------------------------------------------------------------------
+int32_t MASSIFStepReader::open()
+{
+  if(m_FileId >= 0)
+  {
+    return 0;
+  }
+  m_FileId = QH5Utilities::openFile(m_FilePath, true);
+  if(m_FileId < 0)
+  {
+    m_ErrorMessage = QObject::tr("Error Reading HDF5 file: %1").arg(m_FilePath);
+    return -1;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+void MASSIFStepReader::close()
+{
+  m_Cache.clear();
+  m_GeometryRead = false;
+  if(m_FileId >= 0)
+  {
+    QH5Utilities::closeFile(m_FileId);
+    m_FileId = -1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+QString MASSIFStepReader::getErrorMessage() const
+{
+  return m_ErrorMessage;
+}
+
+// -----------------------------------------------------------------------------
+QString MASSIFStepReader::getStepName(int32_t step) const
+{
+  QString paddedStep = m_FilePrefix;
+  paddedStep.append(StringOperations::GenerateIndexString(step, MassifConstants::MaxStepNumber));
+  return paddedStep;
+}
+
+// -----------------------------------------------------------------------------
+int32_t MASSIFStepReader::findAvailableSteps(std::vector<int32_t>& steps)
+{
+  steps.clear();
+  if(open() < 0)
+  {
+    return -1;
+  }
+
+  hid_t gid = QH5Utilities::openHDF5Object(m_FileId, MassifConstants::DCGrpName);
+  if(gid < 0)
+  {
+    m_ErrorMessage = QObject::tr("Could not open path: %1").arg(MassifConstants::DCGrpName);
+    return -2;
+  }
+  H5ScopedGroupSentinel sentinel(gid, false);
+
+  QList<QString> names;
+  herr_t err = QH5Utilities::getGroupObjects(gid, H5Utilities::CustomHDFDataTypes::Group, names);
+  if(err < 0)
+  {
+    m_ErrorMessage = QObject::tr("Could not list the steps in: %1").arg(MassifConstants::DCGrpName);
+    return -3;
+  }
+
+  for(const auto& name : names)
+  {
+    if(!name.startsWith(m_FilePrefix))
+    {
+      continue;
+    }
+    bool ok = false;
+    int32_t step = name.mid(m_FilePrefix.size()).toInt(&ok);
+    if(ok)
+    {
+      steps.push_back(step);
+    }
+  }
+  std::sort(steps.begin(), steps.end());
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+int32_t MASSIFStepReader::readGeometry(int32_t step, SizeVec3Type& dims, FloatVec3Type& origin, FloatVec3Type& spacing)
+{
+  if(m_GeometryRead)
+  {
+    dims = m_Dims;
+    origin = m_Origin;
+    spacing = m_Spacing;
+    return 0;
+  }
+  if(open() < 0)
+  {
+    return -3005;
+  }
+
+  QString totalPath = MassifConstants::DCGrpName;
+  hid_t gid = QH5Utilities::openHDF5Object(m_FileId, MassifConstants::DCGrpName);
+  if(gid < 0)
+  {
+    m_ErrorMessage = QObject::tr("Could not open path: %1").arg(totalPath);
+    return -3006;
+  }
+  H5ScopedGroupSentinel sentinel(gid, false);
+
+  QString stepName = getStepName(step);
+  totalPath.append("/" + stepName);
+  hid_t stepGid = QH5Utilities::openHDF5Object(gid, stepName);
+  if(stepGid < 0)
+  {
+    m_ErrorMessage = QObject::tr("Could not open path: %1").arg(totalPath);
+    return -3007;
+  }
+  sentinel.addGroupId(stepGid);
+
+  totalPath.append("/" + MassifConstants::GeometryGrpName);
+  hid_t geoGid = QH5Utilities::openHDF5Object(stepGid, MassifConstants::GeometryGrpName);
+  if(geoGid < 0)
+  {
+    m_ErrorMessage = QObject::tr("Could not open path: %1").arg(totalPath);
+    return -3007;
+  }
+  sentinel.addGroupId(geoGid);
+
+  std::vector<size_t> tDims(3, 0);
+  herr_t err = QH5Lite::readPointerDataset(geoGid, MassifConstants::DimGrpName, tDims.data());
+  if(err < 0)
+  {
+    m_ErrorMessage = QObject::tr("Could not read dataset %1 at path '%2'").arg(MassifConstants::DimGrpName).arg(totalPath);
+    return -3008;
+  }
+
+  err = QH5Lite::readPointerDataset(geoGid, MassifConstants::OriginGrpName, m_Origin.data());
+  if(err < 0)
+  {
+    m_ErrorMessage = QObject::tr("Could not read dataset %1 at path '%2'").arg(MassifConstants::OriginGrpName).arg(totalPath);
+    return -3009;
+  }
+
+  err = QH5Lite::readPointerDataset(geoGid, MassifConstants::SpacingGrpName, m_Spacing.data());
+  if(err < 0)
+  {
+    m_ErrorMessage = QObject::tr("Could not read dataset %1 at path '%2'").arg(MassifConstants::SpacingGrpName).arg(totalPath);
+    return -3010;
+  }
+
+  m_Dims = {tDims[0], tDims[1], tDims[2]};
+  m_GeometryRead = true;
+  dims = m_Dims;
+  origin = m_Origin;
+  spacing = m_Spacing;
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+QVector<QString> MASSIFStepReader::createHDF5DatasetPaths(int32_t step) const
+{
+  QVector<QString> arrayPaths;
+  QString parentPath = "/" + MassifConstants::DCGrpName + "/" + getStepName(step) + "/" + MassifConstants::Datapoint;
+
+  arrayPaths.push_back(parentPath + "/" + MassifConstants::DFieldsGrpName + "/" + MassifConstants::DField);
+  arrayPaths.push_back(parentPath + "/" + MassifConstants::EFieldsGrpName + "/" + MassifConstants::EField);
+  arrayPaths.push_back(parentPath + "/" + MassifConstants::SFieldsGrpName + "/" + MassifConstants::SField);
+  arrayPaths.push_back(parentPath + "/" + MassifConstants::DFieldsGrpName + "/" + MassifConstants::EVM);
+  arrayPaths.push_back(parentPath + "/" + MassifConstants::SFieldsGrpName + "/" + MassifConstants::SVM);
+  arrayPaths.push_back(parentPath + "/" + MassifConstants::EulerAngleGrpName + "/" + MassifConstants::Phi1);
+  arrayPaths.push_back(parentPath + "/" + MassifConstants::EulerAngleGrpName + "/" + MassifConstants::Phi);
+  arrayPaths.push_back(parentPath + "/" + MassifConstants::EulerAngleGrpName + "/" + MassifConstants::Phi2);
+  arrayPaths.push_back(parentPath + "/" + MassifConstants::GrainID);
+  arrayPaths.push_back(parentPath + "/" + MassifConstants::Phase);
+
+  return arrayPaths;
+}
+
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer MASSIFStepReader::readStep(int32_t step, const QString& attributeMatrixName, bool metaDataOnly)
+{
+  if(!m_GeometryRead)
+  {
+    m_ErrorMessage = QObject::tr("The geometry must be read before reading step %1").arg(step);
+    return AttributeMatrix::NullPointer();
+  }
+  if(open() < 0)
+  {
+    return AttributeMatrix::NullPointer();
+  }
+
+  std::vector<size_t> geometryDims = {m_Dims[0], m_Dims[1], m_Dims[2]};
+  AttributeMatrix::Pointer am = AttributeMatrix::New(geometryDims, attributeMatrixName, AttributeMatrix::Type::Cell);
+
+  for(const auto& hdf5ArrayPath : createHDF5DatasetPaths(step))
+  {
+    QString parentPath = QH5Utilities::getParentPath(hdf5ArrayPath);
+    hid_t parentId = QH5Utilities::openHDF5Object(m_FileId, parentPath);
+    if(parentId < 0)
+    {
+      m_ErrorMessage = QObject::tr("Could not open path: %1").arg(parentPath);
+      return AttributeMatrix::NullPointer();
+    }
+    H5ScopedGroupSentinel sentinel(parentId, false);
+
+    QString objectName = QH5Utilities::getObjectNameFromPath(hdf5ArrayPath);
+    IDataArray::Pointer dPtr = ReadDataArray(parentId, objectName, geometryDims, metaDataOnly);
+    if(dPtr == IDataArray::NullPointer())
+    {
+      m_ErrorMessage = QObject::tr("Could not read dataset '%1' at path '%2'").arg(objectName).arg(parentPath);
+      return AttributeMatrix::NullPointer();
+    }
+    am->insertOrAssign(dPtr);
+  }
+  return am;
+}
+
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer MASSIFStepReader::getStep(int32_t step)
+{
+  auto iter = std::find_if(m_Cache.begin(), m_Cache.end(), [step](const auto& entry) { return entry.first == step; });
+  if(iter != m_Cache.end())
+  {
+    // Move the entry to the front so that the least recently used step is evicted first
+    m_Cache.splice(m_Cache.begin(), m_Cache, iter);
+    return m_Cache.front().second;
+  }
+
+  if(!m_GeometryRead)
+  {
+    SizeVec3Type dims;
+    FloatVec3Type origin;
+    FloatVec3Type spacing;
+    if(readGeometry(step, dims, origin, spacing) < 0)
+    {
+      return AttributeMatrix::NullPointer();
+    }
+  }
+
+  AttributeMatrix::Pointer am = readStep(step, getStepName(step), false);
+  if(nullptr == am)
+  {
+    return am;
+  }
+  m_Cache.emplace_front(step, am);
+  while(m_Cache.size() > m_MaxCachedSteps)
+  {
+    m_Cache.pop_back();
+  }
+  return am;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer MASSIFStepReader::ReadDataArray(hid_t gid, const QString& name, std::vector<size_t> geoDims, bool metaDataOnly)
+{
+  herr_t err = -1;
+  hid_t typeId = -1;
+  H5T_class_t attr_type;
+  size_t attr_size;
+
+  QVector<hsize_t> dims;
+  IDataArray::Pointer ptr = IDataArray::NullPointer();
+  typeId = QH5Lite::getDatasetType(gid, name);
+  if(typeId < 0)
+  {
+    return ptr;
+  }
+  // Get the HDF5 DataSet information. the dimensions will be the combined Tuple Dims and the Data Array Componenet dimes
+  err = QH5Lite::getDatasetInfo(gid, name, dims, attr_type, attr_size);
+  if(err >= 0)
+  {
+    std::vector<size_t>& tDims = geoDims;
+    std::vector<size_t> cDims;
+
+    if(geoDims.size() == dims.size())
+    {
+      cDims.push_back(1);
+    }
+    else
+    {
+      for(int i = geoDims.size(); i < dims.size(); i++)
+      {
+        cDims.push_back(dims[i]);
+      }
+    }
+
+    // Unsupported dataset types leave ptr as a nullptr, which the caller reports as a read error
+    switch(attr_type)
+    {
+    case H5T_INTEGER:
+      if((H5Tequal(typeId, H5T_STD_U8BE) != 0) || (H5Tequal(typeId, H5T_STD_U8LE) != 0))
+      {
+        if(!metaDataOnly)
+        {
+          ptr = Detail::readH5Dataset<uint8_t>(gid, name, tDims, cDims);
+        }
+        else
+        {
+          ptr = DataArray<uint8_t>::CreateArray(tDims, cDims, name, false);
+        }
+      }
+      else if((H5Tequal(typeId, H5T_STD_U16BE) != 0) || (H5Tequal(typeId, H5T_STD_U16LE) != 0))
+      {
+        if(!metaDataOnly)
+        {
+          ptr = Detail::readH5Dataset<uint16_t>(gid, name, tDims, cDims);
+        }
+        else
+        {
+          ptr = DataArray<uint16_t>::CreateArray(tDims, cDims, name, false);
+        }
+      }
+      else if((H5Tequal(typeId, H5T_STD_U32BE) != 0) || (H5Tequal(typeId, H5T_STD_U32LE) != 0))
+      {
+        if(!metaDataOnly)
+        {
+          ptr = Detail::readH5Dataset<uint32_t>(gid, name, tDims, cDims);
+        }
+        else
+        {
+          ptr = DataArray<uint32_t>::CreateArray(tDims, cDims, name, false);
+        }
+      }
+      else if((H5Tequal(typeId, H5T_STD_U64BE) != 0) || (H5Tequal(typeId, H5T_STD_U64LE) != 0))
+      {
+        if(!metaDataOnly)
+        {
+          ptr = Detail::readH5Dataset<uint64_t>(gid, name, tDims, cDims);
+        }
+        else
+        {
+          ptr = DataArray<uint64_t>::CreateArray(tDims, cDims, name, false);
+        }
+      }
+      else if((H5Tequal(typeId, H5T_STD_I8BE) != 0) || (H5Tequal(typeId, H5T_STD_I8LE) != 0))
+      {
+        if(!metaDataOnly)
+        {
+          ptr = Detail::readH5Dataset<int8_t>(gid, name, tDims, cDims);
+        }
+        else
+        {
+          ptr = DataArray<int8_t>::CreateArray(tDims, cDims, name, false);
+        }
+      }
+      else if((H5Tequal(typeId, H5T_STD_I16BE) != 0) || (H5Tequal(typeId, H5T_STD_I16LE) != 0))
+      {
+        if(!metaDataOnly)
+        {
+          ptr = Detail::readH5Dataset<int16_t>(gid, name, tDims, cDims);
+        }
+        else
+        {
+          ptr = DataArray<int16_t>::CreateArray(tDims, cDims, name, false);
+        }
+      }
+      else if((H5Tequal(typeId, H5T_STD_I32BE) != 0) || (H5Tequal(typeId, H5T_STD_I32LE) != 0))
+      {
+        if(!metaDataOnly)
+        {
+          ptr = Detail::readH5Dataset<int32_t>(gid, name, tDims, cDims);
+        }
+        else
+        {
+          ptr = DataArray<int32_t>::CreateArray(tDims, cDims, name, false);
+        }
+      }
+      else if((H5Tequal(typeId, H5T_STD_I64BE) != 0) || (H5Tequal(typeId, H5T_STD_I64LE) != 0))
+      {
+        if(!metaDataOnly)
+        {
+          ptr = Detail::readH5Dataset<int64_t>(gid, name, tDims, cDims);
+        }
+        else
+        {
+          ptr = DataArray<int64_t>::CreateArray(tDims, cDims, name, false);
+        }
+      }
+      break;
+    case H5T_FLOAT:
+      if(attr_size == 4)
+      {
+        if(!metaDataOnly)
+        {
+          ptr = Detail::readH5Dataset<float>(gid, name, tDims, cDims);
+        }
+        else
+        {
+          ptr = DataArray<float>::CreateArray(tDims, cDims, name, false);
+        }
+      }
+      else if(attr_size == 8)
+      {
+        if(!metaDataOnly)
+        {
+          ptr = Detail::readH5Dataset<double>(gid, name, tDims, cDims);
+        }
+        else
+        {
+          ptr = DataArray<double>::CreateArray(tDims, cDims, name, false);
+        }
+      }
+      break;
+    default:
+      break;
+    }
+  }
+  H5Tclose(typeId);
+
+  return ptr;
+}
+
@@ -0,0 +1,120 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include <hdf5.h>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+
+/**
+ * @brief The MASSIFStepReader class provides access to the time steps stored in a MASSIF HDF5 output file.
+ * The file is opened once and kept open for the lifetime of the reader, the geometry is read once, and the
+ * field data of each step is only read when it is requested. Steps requested through getStep() are kept in a
+ * least-recently-used cache of at most maxCachedSteps steps, so time-series post-processing can walk hundreds
+ * of steps without reopening the file or holding every step in memory.
+ */
+class MASSIFStepReader
+{
+public:
+  /**
+   * @brief MASSIFStepReader
+   * @param filePath Path to the MASSIF HDF5 file
+   * @param filePrefix Prefix of the step group names (e.g. "Step-")
+   * @param maxCachedSteps Maximum number of steps kept in memory by getStep()
+   */
+  MASSIFStepReader(const QString& filePath, const QString& filePrefix, size_t maxCachedSteps = 2);
+  ~MASSIFStepReader();
+
+  /**
+   * @brief open Opens the HDF5 file. Calling open() on an already open reader is a no-op.
+   * @return Negative value on error
+   */
+  int32_t open();
+
+  /**
+   * @brief close Closes the HDF5 file and clears the step cache
+   */
+  void close();
+
+  /**
+   * @brief getErrorMessage Returns a description of the last error
+   */
+  QString getErrorMessage() const;
+
+  /**
+   * @brief getStepName Returns the name of the HDF5 group holding the given step
+   */
+  QString getStepName(int32_t step) const;
+
+  /**
+   * @brief findAvailableSteps Returns the sorted step numbers found in the file
+   * @return Negative value on error
+   */
+  int32_t findAvailableSteps(std::vector<int32_t>& steps);
+
+  /**
+   * @brief readGeometry Reads the image geometry stored with the given step. The geometry
+   * is read from the file only on the first call and returned from memory afterwards.
+   * @return Negative value on error
+   */
+  int32_t readGeometry(int32_t step, SizeVec3Type& dims, FloatVec3Type& origin, FloatVec3Type& spacing);
+
+  /**
+   * @brief readStep Reads all field data of a step into a new Cell AttributeMatrix, bypassing the cache.
+   * readGeometry() must have been called first.
+   * @param step Step number
+   * @param attributeMatrixName Name given to the created AttributeMatrix
+   * @param metaDataOnly Only create the arrays without reading any values (preflight)
+   * @return The AttributeMatrix or a nullptr on error
+   */
+  AttributeMatrix::Pointer readStep(int32_t step, const QString& attributeMatrixName, bool metaDataOnly);
+
+  /**
+   * @brief getStep Returns the field data of a step, reading it on first access and keeping
+   * at most maxCachedSteps steps in memory.
+   * @return The AttributeMatrix or a nullptr on error
+   */
+  AttributeMatrix::Pointer getStep(int32_t step);
+
+  /**
+   * @brief ReadDataArray Reads (or only creates, when metaDataOnly is true) a DataArray from the
+   * named dataset using the HDF5 type of the dataset to pick the array type.
+   */
+  static IDataArray::Pointer ReadDataArray(hid_t gid, const QString& name, std::vector<size_t> geoDims, bool metaDataOnly);
+
+private:
+  QString m_FilePath;
+  QString m_FilePrefix;
+  size_t m_MaxCachedSteps = 2;
+  hid_t m_FileId = -1;
+  QString m_ErrorMessage;
+
+  bool m_GeometryRead = false;
+  SizeVec3Type m_Dims = {0, 0, 0};
+  FloatVec3Type m_Origin = {0.0f, 0.0f, 0.0f};
+  FloatVec3Type m_Spacing = {1.0f, 1.0f, 1.0f};
+
+  std::list<std::pair<int32_t, AttributeMatrix::Pointer>> m_Cache;
+
+  /**
+   * @brief createHDF5DatasetPaths Returns the paths of the field datasets of a step
+   */
+  QVector<QString> createHDF5DatasetPaths(int32_t step) const;
+
+public:
+  MASSIFStepReader(const MASSIFStepReader&) = delete;            // Copy Constructor Not Implemented
+  MASSIFStepReader(MASSIFStepReader&&) = delete;                 // Move Constructor Not Implemented
+  MASSIFStepReader& operator=(const MASSIFStepReader&) = delete; // Copy Assignment Not Implemented
+  MASSIFStepReader& operator=(MASSIFStepReader&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,416 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+#include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/util/TextParsing.hpp"
+
+namespace ParaDisParser
+{
+/**
+ * @brief The NodeRecord struct holds one parsed node of the nodal data section. The tag packs the (domain, index)
+ * pair that identifies the node in the file; arms of the node are stored in [firstArm, firstArm + numArms).
+ */
+struct NodeRecord
+{
+  uint64_t tag = 0;
+  float coords[3] = {0.0f, 0.0f, 0.0f};
+  int32_t numArms = 0;
+  int32_t constraint = 0;
+  size_t firstArm = 0;
+};
+
+/**
+ * @brief The ArmRecord struct holds one parsed arm (segment end) of a node: the tag of the neighbor node, the
+ * Burgers vector and the raw (not normalized) slip plane normal
+ */
+struct ArmRecord
+{
+  uint64_t neighborTag = 0;
+  float burgers[3] = {0.0f, 0.0f, 0.0f};
+  float normal[3] = {0.0f, 0.0f, 0.0f};
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief PackTag Packs a node tag "domain,index" into a single key
+ */
+inline uint64_t PackTag(int64_t domain, int64_t index)
+{
+  return (static_cast<uint64_t>(static_cast<uint32_t>(domain)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(index));
+}
+
+using TextParsing::IsBlank;
+using TextParsing::MatchToken;
+using TextParsing::ParseFloat;
+using TextParsing::ParseInt;
+using TextParsing::SkipBlanks;
+using TextParsing::SkipLine;
+using TextParsing::SkipToken;
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief ParseTag Parses a node tag written as "domain,index"
+ */
+inline const char* ParseTag(const char* p, const char* end, uint64_t& tag)
+{
+  int64_t domain = 0;
+  int64_t index = 0;
+  p = ParseInt(p, end, domain);
+  if(nullptr == p || p >= end || *p != ',')
+  {
+    return nullptr;
+  }
+  p = ParseInt(p + 1, end, index);
+  if(nullptr == p)
+  {
+    return nullptr;
+  }
+  tag = PackTag(domain, index);
+  return p;
+}
+
+/**
+ * @brief The ParseNodesImpl class parses the node records of the nodal data section in parallel. The start of
+ * each record and the position of its first arm are found beforehand by a serial scan, so every record is
+ * parsed independently into preallocated storage.
+ */
+class ParseNodesImpl
+{
+public:
+  ParseNodesImpl(const std::vector<const char*>& recordStarts, const char* end, int32_t fileVersion, std::vector<NodeRecord>& nodes, std::vector<ArmRecord>& arms, std::vector<uint8_t>& valid)
+  : m_RecordStarts(recordStarts)
+  , m_End(end)
+  , m_FileVersion(fileVersion)
+  , m_Nodes(nodes)
+  , m_Arms(arms)
+  , m_Valid(valid)
+  {
+  }
+
+  bool parseRecord(size_t i) const
+  {
+    NodeRecord& node = m_Nodes[i];
+    const char* p = ParseTag(m_RecordStarts[i], m_End, node.tag);
+    for(size_t c = 0; c < 3 && nullptr != p; c++)
+    {
+      p = ParseFloat(p, m_End, node.coords[c]);
+    }
+    int64_t numArms = 0;
+    int64_t constraint = 0;
+    p = (nullptr != p) ? ParseInt(p, m_End, numArms) : nullptr;
+    p = (nullptr != p) ? ParseInt(p, m_End, constraint) : nullptr;
+    if(nullptr == p)
+    {
+      return false;
+    }
+    node.constraint = static_cast<int32_t>(constraint);
+
+    p = SkipLine(p, m_End);
+    if(m_FileVersion >= 5)
+    {
+      p = SkipLine(p, m_End);
+    }
+    for(int32_t k = 0; k < node.numArms; k++)
+    {
+      ArmRecord& arm = m_Arms[node.firstArm + k];
+      p = ParseTag(p, m_End, arm.neighborTag);
+      for(size_t c = 0; c < 3 && nullptr != p; c++)
+      {
+        p = ParseFloat(p, m_End, arm.burgers[c]);
+      }
+      if(nullptr == p)
+      {
+        return false;
+      }
+      p = SkipLine(p, m_End);
+      for(size_t c = 0; c < 3 && nullptr != p; c++)
+      {
+        p = ParseFloat(p, m_End, arm.normal[c]);
+      }
+      if(nullptr == p)
+      {
+        return false;
+      }
+      p = SkipLine(p, m_End);
+    }
+    return true;
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Valid[i] = parseRecord(i) ? 1 : 0;
+    }
+  }
+
+private:
+  const std::vector<const char*>& m_RecordStarts;
+  const char* m_End;
+  int32_t m_FileVersion;
+  std::vector<NodeRecord>& m_Nodes;
+  std::vector<ArmRecord>& m_Arms;
+  std::vector<uint8_t>& m_Valid;
+};
+
+/**
+ * @brief The SnapshotReader class reads one ParaDiS restart (data) file. The file is memory mapped (or read
+ * into a single buffer when mapping is not possible) and parsed in place: readHeader() extracts the file
+ * version, domain bounds and node count, and readNodes() locates every node record in one serial pass over
+ * the line breaks before parsing the records in parallel.
+ */
+class SnapshotReader
+{
+public:
+  explicit SnapshotReader(const QString& filePath)
+  : m_File(filePath)
+  {
+  }
+
+  ~SnapshotReader()
+  {
+    close();
+  }
+
+  SnapshotReader(const SnapshotReader&) = delete;
+  SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+  /**
+   * @brief open Maps the file into memory
+   * @return Negative value on error
+   */
+  int32_t open()
+  {
+    if(!m_File.open(QIODevice::ReadOnly))
+    {
+      m_ErrorMessage = QObject::tr("ParaDisReader Input file could not be opened: %1").arg(m_File.fileName());
+      return -100;
+    }
+    const qint64 size = m_File.size();
+    uchar* data = (size > 0) ? m_File.map(0, size) : nullptr;
+    if(nullptr != data)
+    {
+      m_Begin = reinterpret_cast<const char*>(data);
+      m_End = m_Begin + size;
+    }
+    else
+    {
+      m_Buffer = m_File.readAll();
+      m_Begin = m_Buffer.constData();
+      m_End = m_Begin + m_Buffer.size();
+    }
+    return 0;
+  }
+
+  /**
+   * @brief close Releases the mapping and the file
+   */
+  void close()
+  {
+    if(m_File.isOpen())
+    {
+      m_File.close();
+    }
+    m_Buffer.clear();
+    m_Begin = nullptr;
+    m_End = nullptr;
+    m_NodalData = nullptr;
+  }
+
+  /**
+   * @brief readHeader Parses the header up to the start of the nodal data section
+   * @return Negative value on error
+   */
+  int32_t readHeader()
+  {
+    const char* p = m_Begin;
+    // Version line: "dataFileVersion = N"
+    p = SkipToken(SkipToken(p, m_End), m_End);
+    int64_t version = 0;
+    if(nullptr == ParseInt(p, m_End, version))
+    {
+      m_ErrorMessage = QObject::tr("The file version could not be read from %1").arg(m_File.fileName());
+      return -391;
+    }
+    m_FileVersion = static_cast<int32_t>(version);
+    p = SkipLine(p, m_End);
+
+    for(const char* keyword : {"minCoordinates", "maxCoordinates"})
+    {
+      p = findLine(p, keyword);
+      if(nullptr == p)
+      {
+        return -392;
+      }
+      const size_t offset = (std::strcmp(keyword, "minCoordinates") == 0) ? 0 : 3;
+      for(size_t i = 0; i < 3; i++)
+      {
+        p = SkipLine(p, m_End);
+        if(nullptr == ParseFloat(p, m_End, m_DomainBounds[offset + i]))
+        {
+          m_ErrorMessage = QObject::tr("The %1 values could not be read from %2").arg(keyword).arg(m_File.fileName());
+          return -392;
+        }
+      }
+      p = SkipLine(p, m_End);
+    }
+
+    p = findLine(p, "nodeCount");
+    int64_t nodeCount = 0;
+    if(nullptr == p || nullptr == ParseInt(SkipToken(SkipToken(p, m_End), m_End), m_End, nodeCount) || nodeCount < 0)
+    {
+      m_ErrorMessage = QObject::tr("The nodeCount could not be read from %1").arg(m_File.fileName());
+      return -392;
+    }
+    m_NodeCount = static_cast<size_t>(nodeCount);
+    p = SkipLine(p, m_End);
+
+    p = findLine(p, "nodalData");
+    if(nullptr == p)
+    {
+      return -392;
+    }
+    // Skip the keyword line and the two comment lines describing the record layout
+    m_NodalData = SkipLine(SkipLine(SkipLine(p, m_End), m_End), m_End);
+    return 0;
+  }
+
+  /**
+   * @brief readNodes Parses the nodal data section into getNodes() and getArms()
+   * @return Negative value on error
+   */
+  int32_t readNodes()
+  {
+    // Serial scan for the record boundaries: only the arm count of each record is parsed
+    std::vector<const char*> recordStarts(m_NodeCount, nullptr);
+    m_Nodes.resize(m_NodeCount);
+    size_t numArms = 0;
+    const char* p = m_NodalData;
+    for(size_t i = 0; i < m_NodeCount; i++)
+    {
+      if(p >= m_End)
+      {
+        m_ErrorMessage = QObject::tr("%1 ended after %2 of %3 nodes").arg(m_File.fileName()).arg(i).arg(m_NodeCount);
+        return -393;
+      }
+      recordStarts[i] = p;
+      const char* q = p;
+      for(size_t t = 0; t < 4; t++)
+      {
+        q = SkipToken(q, m_End);
+      }
+      int64_t arms = 0;
+      if(nullptr == ParseInt(q, m_End, arms) || arms < 0)
+      {
+        m_ErrorMessage = QObject::tr("The arm count of node %1 could not be read from %2").arg(i).arg(m_File.fileName());
+        return -393;
+      }
+      m_Nodes[i].numArms = static_cast<int32_t>(arms);
+      m_Nodes[i].firstArm = numArms;
+      numArms += static_cast<size_t>(arms);
+
+      p = SkipLine(q, m_End);
+      if(m_FileVersion >= 5)
+      {
+        p = SkipLine(p, m_End);
+      }
+      for(int64_t k = 0; k < 2 * arms; k++)
+      {
+        p = SkipLine(p, m_End);
+      }
+    }
+
+    m_Arms.resize(numArms);
+    std::vector<uint8_t> valid(m_NodeCount, 0);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, m_NodeCount);
+    dataAlg.execute(ParseNodesImpl(recordStarts, m_End, m_FileVersion, m_Nodes, m_Arms, valid));
+
+    for(size_t i = 0; i < m_NodeCount; i++)
+    {
+      if(valid[i] == 0)
+      {
+        m_ErrorMessage = QObject::tr("Node %1 of %2 could not be parsed").arg(i).arg(m_File.fileName());
+        return -393;
+      }
+    }
+    return 0;
+  }
+
+  const QString& getErrorMessage() const
+  {
+    return m_ErrorMessage;
+  }
+
+  int32_t getFileVersion() const
+  {
+    return m_FileVersion;
+  }
+
+  /**
+   * @brief getDomainBounds Returns the minimum (0-2) and maximum (3-5) coordinates of the domain, in units of b
+   */
+  const float* getDomainBounds() const
+  {
+    return m_DomainBounds;
+  }
+
+  size_t getNodeCount() const
+  {
+    return m_NodeCount;
+  }
+
+  const std::vector<NodeRecord>& getNodes() const
+  {
+    return m_Nodes;
+  }
+
+  const std::vector<ArmRecord>& getArms() const
+  {
+    return m_Arms;
+  }
+
+private:
+  QFile m_File;
+  QByteArray m_Buffer;
+  const char* m_Begin = nullptr;
+  const char* m_End = nullptr;
+  const char* m_NodalData = nullptr;
+  QString m_ErrorMessage;
+
+  int32_t m_FileVersion = 0;
+  float m_DomainBounds[6] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+  size_t m_NodeCount = 0;
+  std::vector<NodeRecord> m_Nodes;
+  std::vector<ArmRecord> m_Arms;
+
+  /**
+   * @brief findLine Returns the start of the first line at or after p whose first token is keyword
+   */
+  const char* findLine(const char* p, const char* keyword)
+  {
+    while(p < m_End)
+    {
+      if(MatchToken(p, m_End, keyword))
+      {
+        return p;
+      }
+      p = SkipLine(p, m_End);
+    }
+    m_ErrorMessage = QObject::tr("The '%1' entry was not found in %2").arg(keyword).arg(m_File.fileName());
+    return nullptr;
+  }
+};
+} // namespace ParaDisParser
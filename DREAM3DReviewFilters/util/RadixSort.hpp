@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace RadixSort
+{
+/**
+ * @brief Number of key bits consumed per radix pass
+ */
+constexpr size_t k_DigitBits = 8;
+constexpr size_t k_NumBuckets = static_cast<size_t>(1) << k_DigitBits;
+
+/**
+ * @brief Smallest number of elements handed to a single block; at most k_MaxBlocks blocks are used
+ */
+constexpr size_t k_MinBlockSize = 1 << 16;
+constexpr size_t k_MaxBlocks = 64;
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief SortPairs Sorts keys in ascending order with a least significant digit radix sort, applying the same
+ * permutation to values. The sort is stable, so values sharing a key keep their input order. Only as many
+ * passes as needed to cover maxKey are made; each pass splits the input into fixed blocks that are counted
+ * and scattered in parallel, so the result does not depend on the number of threads.
+ * @param keys Keys to sort, none larger than maxKey
+ * @param values Values carried along with the keys (same length as keys)
+ * @param maxKey Largest key present
+ */
+template <typename KeyType, typename ValueType>
+void SortPairs(std::vector<KeyType>& keys, std::vector<ValueType>& values, KeyType maxKey)
+{
+  static_assert(std::is_unsigned<KeyType>::value, "RadixSort::SortPairs requires unsigned keys");
+
+  const size_t numElements = keys.size();
+  if(numElements < 2)
+  {
+    return;
+  }
+
+  const size_t numBlocks = std::clamp<size_t>(numElements / k_MinBlockSize, 1, k_MaxBlocks);
+  auto blockBegin = [numElements, numBlocks](size_t block) { return numElements * block / numBlocks; };
+
+  std::vector<KeyType> keysBuffer(numElements);
+  std::vector<ValueType> valuesBuffer(numElements);
+  std::vector<size_t> offsets(numBlocks * k_NumBuckets);
+
+  for(size_t shift = 0; shift < sizeof(KeyType) * 8 && (maxKey >> shift) != 0; shift += k_DigitBits)
+  {
+    std::fill(offsets.begin(), offsets.end(), 0);
+    const KeyType* srcKeys = keys.data();
+
+    ParallelDataAlgorithm countAlg;
+    countAlg.setRange(0, numBlocks);
+    countAlg.setGrain(1);
+    countAlg.execute([&](const SIMPLRange& range) {
+      for(size_t b = range.min(); b < range.max(); b++)
+      {
+        size_t* counts = offsets.data() + b * k_NumBuckets;
+        for(size_t i = blockBegin(b); i < blockBegin(b + 1); i++)
+        {
+          counts[(srcKeys[i] >> shift) & (k_NumBuckets - 1)]++;
+        }
+      }
+    });
+
+    // Exclusive scan in digit-major, block-minor order keeps equal digits in input order
+    size_t total = 0;
+    bool singleBucket = false;
+    for(size_t d = 0; d < k_NumBuckets; d++)
+    {
+      size_t bucketSize = 0;
+      for(size_t b = 0; b < numBlocks; b++)
+      {
+        size_t count = offsets[b * k_NumBuckets + d];
+        offsets[b * k_NumBuckets + d] = total;
+        total += count;
+        bucketSize += count;
+      }
+      singleBucket = singleBucket || bucketSize == numElements;
+    }
+    if(singleBucket)
+    {
+      continue;
+    }
+
+    const ValueType* srcValues = values.data();
+    ParallelDataAlgorithm scatterAlg;
+    scatterAlg.setRange(0, numBlocks);
+    scatterAlg.setGrain(1);
+    scatterAlg.execute([&](const SIMPLRange& range) {
+      for(size_t b = range.min(); b < range.max(); b++)
+      {
+        size_t* next = offsets.data() + b * k_NumBuckets;
+        for(size_t i = blockBegin(b); i < blockBegin(b + 1); i++)
+        {
+          size_t dest = next[(srcKeys[i] >> shift) & (k_NumBuckets - 1)]++;
+          keysBuffer[dest] = srcKeys[i];
+          valuesBuffer[dest] = srcValues[i];
+        }
+      }
+    });
+
+    keys.swap(keysBuffer);
+    values.swap(valuesBuffer);
+  }
+}
+} // namespace RadixSort
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+
+namespace SegmentRasterizer
+{
+/**
+ * @brief The Grid struct describes a regular grid of cells used as a rasterization target
+ */
+struct Grid
+{
+  double origin[3] = {0.0, 0.0, 0.0};
+  double spacing[3] = {1.0, 1.0, 1.0};
+  int64_t dims[3] = {0, 0, 0};
+
+  size_t getNumberOfCells() const
+  {
+    return static_cast<size_t>(dims[0]) * static_cast<size_t>(dims[1]) * static_cast<size_t>(dims[2]);
+  }
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief TraverseSegment Visits every cell of the grid crossed by the segment p1 -> p2 using the voxel traversal
+ * of Amanatides & Woo, calling visitor(cellIndex, length) with the length of the segment inside that cell.
+ * Only the cells the segment actually passes through are visited; the portion of the segment outside the grid
+ * is ignored.
+ */
+template <typename Visitor>
+void TraverseSegment(const float* p1, const float* p2, const Grid& grid, Visitor&& visitor)
+{
+  double start[3] = {p1[0], p1[1], p1[2]};
+  double dir[3] = {static_cast<double>(p2[0]) - p1[0], static_cast<double>(p2[1]) - p1[1], static_cast<double>(p2[2]) - p1[2]};
+  const double segmentLength = std::sqrt(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+  if(segmentLength <= 0.0)
+  {
+    return;
+  }
+
+  // Clip the segment parameter range [0, 1] against the grid bounds (slab method)
+  double tEnter = 0.0;
+  double tExit = 1.0;
+  for(size_t a = 0; a < 3; a++)
+  {
+    const double lower = grid.origin[a];
+    const double upper = grid.origin[a] + static_cast<double>(grid.dims[a]) * grid.spacing[a];
+    if(dir[a] == 0.0)
+    {
+      if(start[a] < lower || start[a] >= upper)
+      {
+        return;
+      }
+      continue;
+    }
+    double t0 = (lower - start[a]) / dir[a];
+    double t1 = (upper - start[a]) / dir[a];
+    if(t0 > t1)
+    {
+      std::swap(t0, t1);
+    }
+    tEnter = std::max(tEnter, t0);
+    tExit = std::min(tExit, t1);
+  }
+  if(tEnter >= tExit)
+  {
+    return;
+  }
+
+  // Locate the first cell from the midpoint of the first infinitesimal step to avoid boundary ambiguity
+  int64_t cell[3] = {0, 0, 0};
+  int64_t step[3] = {0, 0, 0};
+  double tMax[3] = {0.0, 0.0, 0.0};
+  double tDelta[3] = {0.0, 0.0, 0.0};
+  for(size_t a = 0; a < 3; a++)
+  {
+    const double entry = start[a] + dir[a] * tEnter;
+    cell[a] = static_cast<int64_t>(std::floor((entry - grid.origin[a]) / grid.spacing[a]));
+    cell[a] = std::clamp<int64_t>(cell[a], 0, grid.dims[a] - 1);
+    if(dir[a] > 0.0)
+    {
+      step[a] = 1;
+      tMax[a] = (grid.origin[a] + static_cast<double>(cell[a] + 1) * grid.spacing[a] - start[a]) / dir[a];
+      tDelta[a] = grid.spacing[a] / dir[a];
+    }
+    else if(dir[a] < 0.0)
+    {
+      step[a] = -1;
+      tMax[a] = (grid.origin[a] + static_cast<double>(cell[a]) * grid.spacing[a] - start[a]) / dir[a];
+      tDelta[a] = -grid.spacing[a] / dir[a];
+    }
+    else
+    {
+      tMax[a] = std::numeric_limits<double>::infinity();
+      tDelta[a] = std::numeric_limits<double>::infinity();
+    }
+  }
+
+  const size_t xStride = 1;
+  const size_t yStride = static_cast<size_t>(grid.dims[0]);
+  const size_t zStride = static_cast<size_t>(grid.dims[0]) * static_cast<size_t>(grid.dims[1]);
+
+  double t = tEnter;
+  while(t < tExit)
+  {
+    size_t axis = 0;
+    if(tMax[1] < tMax[axis])
+    {
+      axis = 1;
+    }
+    if(tMax[2] < tMax[axis])
+    {
+      axis = 2;
+    }
+    const double tNext = std::min(tMax[axis], tExit);
+    if(tNext > t)
+    {
+      visitor(static_cast<size_t>(cell[2]) * zStride + static_cast<size_t>(cell[1]) * yStride + static_cast<size_t>(cell[0]) * xStride, static_cast<float>((tNext - t) * segmentLength));
+    }
+    t = tNext;
+    if(t >= tExit)
+    {
+      break;
+    }
+    cell[axis] += step[axis];
+    if(cell[axis] < 0 || cell[axis] >= grid.dims[axis])
+    {
+      break;
+    }
+    tMax[axis] += tDelta[axis];
+  }
+}
+
+/**
+ * @brief The RasterizeEdgesImpl class accumulates the lengths of a set of edges into the cells of a grid in
+ * parallel over edges. Each cell holds numChannels values: channel 0 is the total length and channel 1 + c
+ * the length of edges in class c, as returned once per edge by the classifier (a negative class only adds
+ * to the total). Contributions are buffered per range of edges and flushed into the shared grid under a lock,
+ * so the per-edge traversal never contends.
+ */
+template <typename Classifier>
+class RasterizeEdgesImpl
+{
+public:
+  RasterizeEdgesImpl(const float* vertices, const MeshIndexType* edges, const Grid& grid, size_t numChannels, Classifier classifier, std::vector<float>& lengths, std::mutex& mutex)
+  : m_Vertices(vertices)
+  , m_Edges(edges)
+  , m_Grid(grid)
+  , m_NumChannels(numChannels)
+  , m_Classifier(classifier)
+  , m_Lengths(lengths)
+  , m_Mutex(mutex)
+  {
+  }
+
+  void rasterize(size_t start, size_t end) const
+  {
+    struct Contribution
+    {
+      size_t cell;
+      int32_t channel;
+      float length;
+    };
+    std::vector<Contribution> contributions;
+    contributions.reserve((end - start) * 4);
+
+    for(size_t i = start; i < end; i++)
+    {
+      const float* p1 = m_Vertices + 3 * m_Edges[2 * i + 0];
+      const float* p2 = m_Vertices + 3 * m_Edges[2 * i + 1];
+      const int32_t edgeClass = m_Classifier(i);
+      const int32_t channel = (edgeClass >= 0 && static_cast<size_t>(edgeClass) + 1 < m_NumChannels) ? edgeClass + 1 : 0;
+      TraverseSegment(p1, p2, m_Grid, [&](size_t cell, float length) { contributions.push_back({cell, channel, length}); });
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for(const Contribution& c : contributions)
+    {
+      m_Lengths[m_NumChannels * c.cell] += c.length;
+      if(c.channel > 0)
+      {
+        m_Lengths[m_NumChannels * c.cell + c.channel] += c.length;
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    rasterize(range.min(), range.max());
+  }
+
+private:
+  const float* m_Vertices;
+  const MeshIndexType* m_Edges;
+  const Grid& m_Grid;
+  size_t m_NumChannels;
+  Classifier m_Classifier;
+  std::vector<float>& m_Lengths;
+  std::mutex& m_Mutex;
+};
+
+/**
+ * @brief The GatherOverlappingCellsImpl class sums a fine grid into cells that each cover a 2x2x2 block of fine
+ * cells, with neighboring cells overlapping by one fine cell per axis; cell (l, k, j) covers fine cells
+ * (l..l+1, k..k+1, j..j+1). Each output cell is written by exactly one task, so it runs in parallel over Z.
+ */
+class GatherOverlappingCellsImpl
+{
+public:
+  GatherOverlappingCellsImpl(const std::vector<float>& fineLengths, const Grid& fineGrid, const size_t* cellDims, size_t numChannels, std::vector<float>& cellLengths)
+  : m_FineLengths(fineLengths)
+  , m_FineGrid(fineGrid)
+  , m_NumChannels(numChannels)
+  , m_CellLengths(cellLengths)
+  {
+    m_CellDims[0] = cellDims[0];
+    m_CellDims[1] = cellDims[1];
+    m_CellDims[2] = cellDims[2];
+  }
+
+  void gather(size_t zStart, size_t zEnd) const
+  {
+    const size_t fineX = static_cast<size_t>(m_FineGrid.dims[0]);
+    const size_t fineXY = fineX * static_cast<size_t>(m_FineGrid.dims[1]);
+    for(size_t j = zStart; j < zEnd; j++)
+    {
+      for(size_t k = 0; k < m_CellDims[1]; k++)
+      {
+        for(size_t l = 0; l < m_CellDims[0]; l++)
+        {
+          const size_t point = (j * m_CellDims[1] + k) * m_CellDims[0] + l;
+          float* out = m_CellLengths.data() + m_NumChannels * point;
+          for(size_t dz = 0; dz < 2; dz++)
+          {
+            for(size_t dy = 0; dy < 2; dy++)
+            {
+              for(size_t dx = 0; dx < 2; dx++)
+              {
+                const size_t fine = (j + dz) * fineXY + (k + dy) * fineX + (l + dx);
+                const float* in = m_FineLengths.data() + m_NumChannels * fine;
+                for(size_t c = 0; c < m_NumChannels; c++)
+                {
+                  out[c] += in[c];
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    gather(range.min(), range.max());
+  }
+
+private:
+  const std::vector<float>& m_FineLengths;
+  const Grid& m_FineGrid;
+  size_t m_CellDims[3] = {0, 0, 0};
+  size_t m_NumChannels;
+  std::vector<float>& m_CellLengths;
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief CreateStaggeredGrid Returns the fine grid underlying a lattice of cells spaced halfCellSize apart whose
+ * boxes are one full cell wide and start at min - halfCellSize / 2. Fine cell m spans one half cell, so the box
+ * of cell l along an axis is exactly fine cells l and l + 1.
+ */
+inline Grid CreateStaggeredGrid(const float* min, const float* halfCellSize, const size_t* cellDims)
+{
+  Grid grid;
+  for(size_t a = 0; a < 3; a++)
+  {
+    grid.origin[a] = static_cast<double>(min[a]) - 0.5 * static_cast<double>(halfCellSize[a]);
+    grid.spacing[a] = halfCellSize[a];
+    grid.dims[a] = static_cast<int64_t>(cellDims[a]) + 1;
+  }
+  return grid;
+}
+} // namespace SegmentRasterizer
@@ -2,6 +2,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
 #include <numeric>
 #include <type_traits>
 #include <vector>
@@ -164,6 +168,303 @@ double findSummation(const C<T, Ts...>& source)
   float sum = static_cast<float>(computeSum(source));
   return sum;
 }
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief The FeatureBuckets class groups the values of an array by feature id into a single flat buffer
+ * (compressed sparse row layout) using a two pass counting sort. The values of feature i occupy the
+ * range [begin(i), end(i)). Tuples that are masked out or whose feature id is outside [0, numFeatures)
+ * are skipped.
+ */
+template <typename T>
+class FeatureBuckets
+{
+public:
+  // std::vector<bool> can not hand out pointers, so bool values are stored as bytes
+  using StorageType = std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>;
+
+  FeatureBuckets(const T* data, const int32_t* featureIds, const bool* mask, size_t numTuples, size_t numFeatures)
+  : m_Offsets(numFeatures + 1, 0)
+  {
+    // First pass: count the values belonging to each feature
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      if(isIncluded(featureIds[i], mask, i, numFeatures))
+      {
+        m_Offsets[static_cast<size_t>(featureIds[i]) + 1]++;
+      }
+    }
+    std::partial_sum(m_Offsets.begin(), m_Offsets.end(), m_Offsets.begin());
+
+    // Second pass: scatter each value into its feature's bucket
+    m_Values.resize(m_Offsets[numFeatures]);
+    std::vector<size_t> cursors(m_Offsets.begin(), m_Offsets.end() - 1);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      if(isIncluded(featureIds[i], mask, i, numFeatures))
+      {
+        m_Values[cursors[featureIds[i]]++] = static_cast<StorageType>(data[i]);
+      }
+    }
+  }
+
+  size_t getNumberOfFeatures() const
+  {
+    return m_Offsets.size() - 1;
+  }
+
+  size_t size(size_t feature) const
+  {
+    return m_Offsets[feature + 1] - m_Offsets[feature];
+  }
+
+  StorageType* begin(size_t feature)
+  {
+    return m_Values.data() + m_Offsets[feature];
+  }
+
+  StorageType* end(size_t feature)
+  {
+    return m_Values.data() + m_Offsets[feature + 1];
+  }
+
+private:
+  std::vector<size_t> m_Offsets;
+  std::vector<StorageType> m_Values;
+
+  static bool isIncluded(int32_t featureId, const bool* mask, size_t index, size_t numFeatures)
+  {
+    return (nullptr == mask || mask[index]) && featureId >= 0 && static_cast<size_t>(featureId) < numFeatures;
+  }
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief The RangeStatistics struct holds the results of computeRangeStatistics. The sum is exact for
+ * integer types and Kahan compensated for floating point types.
+ */
+template <typename T>
+struct RangeStatistics
+{
+  using SumType = std::conditional_t<std::is_integral_v<T>, std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>, double>;
+
+  size_t count = 0;
+  T min = static_cast<T>(0);
+  T max = static_cast<T>(0);
+  SumType sum = static_cast<SumType>(0);
+  double mean = 0.0;
+  double m2 = 0.0;
+  double compensation = 0.0;
+
+  /**
+   * @brief Adds a single value using Welford's update
+   */
+  void add(T value)
+  {
+    if(count == 0)
+    {
+      min = value;
+      max = value;
+    }
+    else
+    {
+      min = std::min(min, value);
+      max = std::max(max, value);
+    }
+    if constexpr(std::is_integral_v<T>)
+    {
+      sum += static_cast<SumType>(value);
+    }
+    else
+    {
+      double y = static_cast<double>(value) - compensation;
+      double t = sum + y;
+      compensation = (t - sum) - y;
+      sum = t;
+    }
+    count++;
+    double delta = static_cast<double>(value) - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (static_cast<double>(value) - mean);
+  }
+
+  /**
+   * @brief Population standard deviation
+   */
+  double stdDeviation() const
+  {
+    return count > 0 ? std::sqrt(m2 / static_cast<double>(count)) : 0.0;
+  }
+
+  /**
+   * @brief Merges the statistics of another range into this one (Chan et al. parallel update)
+   */
+  void merge(const RangeStatistics<T>& other)
+  {
+    if(other.count == 0)
+    {
+      return;
+    }
+    if(count == 0)
+    {
+      *this = other;
+      return;
+    }
+    size_t total = count + other.count;
+    double delta = other.mean - mean;
+    mean += delta * static_cast<double>(other.count) / static_cast<double>(total);
+    m2 += other.m2 + delta * delta * static_cast<double>(count) * static_cast<double>(other.count) / static_cast<double>(total);
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    sum += other.sum;
+    count = total;
+  }
+};
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief computeRangeStatistics Computes count, min, max, sum, mean and variance of a range in a single
+ * pass using Welford's update
+ */
+template <typename T, typename Iterator>
+RangeStatistics<T> computeRangeStatistics(Iterator first, Iterator last)
+{
+  RangeStatistics<T> stats;
+  for(; first != last; ++first)
+  {
+    stats.add(static_cast<T>(*first));
+  }
+  return stats;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief findPercentileInPlace Finds the given percentile (0 - 100) of a range by selection, interpolating
+ * linearly between the closest ranks. The 50th percentile equals the median. The range is reordered.
+ */
+template <typename Iterator>
+float findPercentileInPlace(Iterator first, Iterator last, float percentile)
+{
+  const auto count = static_cast<size_t>(std::distance(first, last));
+  if(count == 0)
+  {
+    return 0.0f;
+  }
+  const double position = static_cast<double>(std::clamp(percentile, 0.0f, 100.0f)) / 100.0 * static_cast<double>(count - 1);
+  const auto lowRank = static_cast<size_t>(std::floor(position));
+  const double fraction = position - static_cast<double>(lowRank);
+
+  Iterator low = first + lowRank;
+  std::nth_element(first, low, last);
+  const double lowValue = static_cast<double>(*low);
+  if(fraction == 0.0 || lowRank + 1 >= count)
+  {
+    return static_cast<float>(lowValue);
+  }
+  // After selection every element above the low rank is not smaller, so the next rank is their minimum
+  const double highValue = static_cast<double>(*std::min_element(low + 1, last));
+  return static_cast<float>(lowValue + (highValue - lowValue) * fraction);
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief The HistogramQuantileSketch class estimates quantiles of a stream of values without storing
+ * them. Values are counted into a fixed number of equal width bins spanning the known [min, max] of the
+ * data, and a quantile is interpolated within the bin that holds its rank. The error is bounded by one
+ * bin width, (max - min) / numBins. Integer data whose range fits in the bins gets one bin per value,
+ * which makes the result exact. Sketches built over different parts of the data can be merged.
+ */
+template <typename T>
+class HistogramQuantileSketch
+{
+public:
+  HistogramQuantileSketch(T min, T max, size_t numBins)
+  : m_Min(static_cast<double>(min))
+  , m_Max(static_cast<double>(max))
+  {
+    const double range = static_cast<double>(max) - m_Min;
+    if constexpr(std::is_integral_v<T>)
+    {
+      if(range + 1.0 <= static_cast<double>(numBins))
+      {
+        m_Exact = true;
+        numBins = static_cast<size_t>(range) + 1;
+      }
+    }
+    m_Width = (m_Exact || range <= 0.0) ? 1.0 : range / static_cast<double>(numBins);
+    m_Counts.assign(numBins, 0);
+  }
+
+  void add(T value)
+  {
+    double bin = (static_cast<double>(value) - m_Min) / m_Width;
+    size_t index = bin <= 0.0 ? 0 : std::min(static_cast<size_t>(bin), m_Counts.size() - 1);
+    m_Counts[index]++;
+    m_Total++;
+  }
+
+  void merge(const HistogramQuantileSketch<T>& other)
+  {
+    std::transform(m_Counts.begin(), m_Counts.end(), other.m_Counts.begin(), m_Counts.begin(), std::plus<uint64_t>());
+    m_Total += other.m_Total;
+  }
+
+  /**
+   * @brief quantile Estimates the given percentile (0 - 100) with the same closest rank interpolation
+   * used by findPercentileInPlace
+   */
+  float quantile(float percentile) const
+  {
+    if(m_Total == 0)
+    {
+      return 0.0f;
+    }
+    const double position = static_cast<double>(std::clamp(percentile, 0.0f, 100.0f)) / 100.0 * static_cast<double>(m_Total - 1);
+    const auto lowRank = static_cast<uint64_t>(std::floor(position));
+    const double fraction = position - static_cast<double>(lowRank);
+    const double lowValue = valueAtRank(lowRank);
+    if(fraction == 0.0 || lowRank + 1 >= m_Total)
+    {
+      return static_cast<float>(lowValue);
+    }
+    const double highValue = valueAtRank(lowRank + 1);
+    return static_cast<float>(lowValue + (highValue - lowValue) * fraction);
+  }
+
+private:
+  double m_Min = 0.0;
+  double m_Max = 0.0;
+  double m_Width = 1.0;
+  bool m_Exact = false;
+  uint64_t m_Total = 0;
+  std::vector<uint64_t> m_Counts;
+
+  double valueAtRank(uint64_t rank) const
+  {
+    // A constant stream has no spread to interpolate over
+    if(m_Max <= m_Min)
+    {
+      return m_Min;
+    }
+    uint64_t before = 0;
+    for(size_t bin = 0; bin < m_Counts.size(); bin++)
+    {
+      const uint64_t count = m_Counts[bin];
+      if(rank < before + count)
+      {
+        if(m_Exact)
+        {
+          return m_Min + static_cast<double>(bin);
+        }
+        // Assume the values are spread evenly through the bin
+        const double offset = (static_cast<double>(rank - before) + 0.5) / static_cast<double>(count);
+        return std::clamp(m_Min + (static_cast<double>(bin) + offset) * m_Width, m_Min, m_Max);
+      }
+      before += count;
+    }
+    return m_Max;
+  }
+};
 } // namespace StatisticsHelpers
 
 #ifdef STATISTICS_FILTER_CLASS_NAME
@@ -180,7 +481,7 @@ enum createdPathID : RenameDataPath::DataID_t
   DataArrayID35 = 35, // StdDev
   DataArrayID36 = 36, // Summation
   DataArrayID37 = 37, // Histogram
-  DataArrayID38 = 38, //
+  DataArrayID38 = 38, // Percentiles
   DataArrayID39 = 39, // StandardizedArray
   DataArrayID40 = 40, //
 };
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief Helpers that tokenize text held in a memory buffer (typically a memory mapped file) in place, without
+ * allocating or requiring a null terminated string. Each function takes the current position and the end of
+ * the buffer and never reads past the end.
+ */
+namespace TextParsing
+{
+// -----------------------------------------------------------------------------
+inline bool IsBlank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief SkipBlanks Skips spaces and tabs, but never the end of the line
+ */
+inline const char* SkipBlanks(const char* p, const char* end)
+{
+  while(p < end && IsBlank(*p))
+  {
+    ++p;
+  }
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief SkipLine Returns the start of the line following the one containing p
+ */
+inline const char* SkipLine(const char* p, const char* end)
+{
+  const void* newline = (p < end) ? std::memchr(p, '\n', static_cast<size_t>(end - p)) : nullptr;
+  return (nullptr != newline) ? static_cast<const char*>(newline) + 1 : end;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief SkipToken Skips the next whitespace delimited token of the current line
+ */
+inline const char* SkipToken(const char* p, const char* end)
+{
+  p = SkipBlanks(p, end);
+  while(p < end && !IsBlank(*p) && *p != '\n')
+  {
+    ++p;
+  }
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief MatchToken Returns true if the first token of the line starting at p is exactly word
+ */
+inline bool MatchToken(const char* p, const char* end, const char* word)
+{
+  p = SkipBlanks(p, end);
+  const size_t length = std::strlen(word);
+  if(static_cast<size_t>(end - p) < length || std::memcmp(p, word, length) != 0)
+  {
+    return false;
+  }
+  p += length;
+  return p == end || IsBlank(*p) || *p == '\n';
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief ParseInt Parses a decimal integer after optional blanks. Returns the position after the number, or
+ * nullptr if no digits were found.
+ */
+inline const char* ParseInt(const char* p, const char* end, int64_t& value)
+{
+  p = SkipBlanks(p, end);
+  bool negative = false;
+  if(p < end && (*p == '-' || *p == '+'))
+  {
+    negative = (*p == '-');
+    ++p;
+  }
+  const char* digits = p;
+  int64_t result = 0;
+  while(p < end && *p >= '0' && *p <= '9')
+  {
+    result = result * 10 + (*p - '0');
+    ++p;
+  }
+  if(p == digits)
+  {
+    return nullptr;
+  }
+  value = negative ? -result : result;
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief ParseFloat Parses a decimal floating point number ("-1.25e+03" style) after optional blanks without
+ * allocating or requiring a null terminated buffer. Returns the position after the number, or nullptr if no
+ * digits were found.
+ */
+inline const char* ParseFloat(const char* p, const char* end, float& value)
+{
+  static const double k_Powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  p = SkipBlanks(p, end);
+  bool negative = false;
+  if(p < end && (*p == '-' || *p == '+'))
+  {
+    negative = (*p == '-');
+    ++p;
+  }
+
+  uint64_t mantissa = 0;
+  int32_t exponent = 0;
+  int32_t numDigits = 0;
+  bool foundDigit = false;
+  while(p < end && *p >= '0' && *p <= '9')
+  {
+    foundDigit = true;
+    if(numDigits < 19)
+    {
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+      numDigits += (mantissa != 0) ? 1 : 0;
+    }
+    else
+    {
+      exponent++;
+    }
+    ++p;
+  }
+  if(p < end && *p == '.')
+  {
+    ++p;
+    while(p < end && *p >= '0' && *p <= '9')
+    {
+      foundDigit = true;
+      if(numDigits < 19)
+      {
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+        numDigits += (mantissa != 0) ? 1 : 0;
+        exponent--;
+      }
+      ++p;
+    }
+  }
+  if(!foundDigit)
+  {
+    return nullptr;
+  }
+  if(p < end && (*p == 'e' || *p == 'E'))
+  {
+    int64_t exp = 0;
+    const char* next = ParseInt(p + 1, end, exp);
+    if(nullptr != next && next != p + 1 && !IsBlank(p[1]))
+    {
+      exponent += static_cast<int32_t>(exp);
+      p = next;
+    }
+  }
+
+  double result = static_cast<double>(mantissa);
+  if(exponent < 0)
+  {
+    result = (-exponent <= 22) ? result / k_Powers[-exponent] : result * std::pow(10.0, exponent);
+  }
+  else if(exponent > 0)
+  {
+    result = (exponent <= 22) ? result * k_Powers[exponent] : result * std::pow(10.0, exponent);
+  }
+  value = static_cast<float>(negative ? -result : result);
+  return p;
+}
+} // namespace TextParsing
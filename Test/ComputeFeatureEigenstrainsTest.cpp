@@ -335,6 +335,60 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  // Test that the Mandel form of (S-I)^-1 gives the same eigenstrains as the full 9x9 inverse
+  // -----------------------------------------------------------------------------
+  int MandelEshelbyInverseTest()
+  {
+    double eps = 1e-10;
+    double nu = 0.3;
+    double axes[4][3] = {{1.0, 1.0, 1.0}, {2.0, 2.0, 1.0}, {2.0, 1.0, 1.0}, {2.0, 1.0, 0.5}};
+
+    Eigen::Matrix3d elasticStrainTensor;
+    // clang-format off
+    elasticStrainTensor << 1.0e-3, 2.0e-4, -3.0e-4,
+                           2.0e-4, -5.0e-4, 4.0e-4,
+                           -3.0e-4, 4.0e-4, 7.0e-4;
+    // clang-format on
+
+    for(const auto& axis : axes)
+    {
+      EigenstrainsHelper::Tensor4DType eshelbyTensor = EigenstrainsHelper::find_eshelby(axis[0], axis[1], axis[2], nu, true);
+
+      // Reference | e*_ij = (S-I)^-1_ijkl e_kl using the 9x9 matrix of the tensor
+      Eigen::Matrix<double, 9, 9> eshelbyTensor99;
+      for(size_t i = 0; i < 3; i++)
+      {
+        for(size_t j = 0; j < 3; j++)
+        {
+          for(size_t k = 0; k < 3; k++)
+          {
+            for(size_t l = 0; l < 3; l++)
+            {
+              eshelbyTensor99(i * 3 + j, k * 3 + l) = eshelbyTensor(i, j, k, l);
+            }
+          }
+        }
+      }
+      Eigen::Matrix<double, 9, 9> eshelbyInverse99 = (eshelbyTensor99 - Eigen::Matrix<double, 9, 9>::Identity()).inverse();
+      Eigen::Matrix<double, 9, 1> elasticStrains9 = Eigen::Map<const Eigen::Matrix<double, 9, 1>>(elasticStrainTensor.data());
+      Eigen::Matrix<double, 9, 1> eigenstrains9 = eshelbyInverse99 * elasticStrains9;
+
+      EigenstrainsHelper::Matrix6Type eshelbyInverse = EigenstrainsHelper::find_eshelby_inverse(axis[0], axis[1], axis[2], nu, true);
+      Eigen::Matrix3d eigenstrainTensor = EigenstrainsHelper::mandel_tensor(eshelbyInverse * EigenstrainsHelper::mandel_vector(elasticStrainTensor));
+
+      for(size_t i = 0; i < 3; i++)
+      {
+        for(size_t j = 0; j < 3; j++)
+        {
+          DREAM3D_REQUIRED(std::abs(eigenstrainTensor(i, j) - eigenstrains9(i * 3 + j)), <, eps);
+        }
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -346,6 +400,7 @@ public:
     DREAM3D_REGISTER_TEST(TestComputeFeatureEigenstrainsTest());
     DREAM3D_REGISTER_TEST(GaussIntegrationTest());
     DREAM3D_REGISTER_TEST(FindEshelbyTest());
+    DREAM3D_REGISTER_TEST(MandelEshelbyInverseTest());
   }
 
 private:
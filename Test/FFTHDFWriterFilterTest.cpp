@@ -5,15 +5,23 @@
 #include <QtCore/QFile>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 #include "UnitTestSupport.hpp"
 
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/FFTHDFWriterFilter.h"
+
 #include "DREAM3DReviewTestFileLocations.h"
 
 class FFTHDFWriterFilterTest
@@ -82,6 +90,130 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  // Builds a 7x5x3 volume whose values encode the tuple and component index
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateTestData()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(SizeVec3Type(7, 5, 3));
+    dc->setGeometry(image);
+    dca->addOrReplaceDataContainer(dc);
+
+    std::vector<size_t> tDims = {7, 5, 3};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(am);
+
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(tDims, {1}, "FeatureIds", true);
+    Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(tDims, {1}, "Phases", true);
+    FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(tDims, {3}, "EulerAngles", true);
+    FloatArrayType::Pointer eigenstrains = FloatArrayType::CreateArray(tDims, {6}, "Eigenstrains", true);
+    for(size_t i = 0; i < featureIds->getNumberOfTuples(); i++)
+    {
+      featureIds->setValue(i, static_cast<int32_t>(i));
+      phases->setValue(i, static_cast<int32_t>(i % 3 + 1));
+      for(size_t c = 0; c < 3; c++)
+      {
+        eulers->setComponent(i, c, static_cast<float>(i) + 0.25f * static_cast<float>(c));
+      }
+      for(size_t c = 0; c < 6; c++)
+      {
+        eigenstrains->setComponent(i, c, -static_cast<float>(i) - 0.125f * static_cast<float>(c));
+      }
+    }
+    am->insertOrAssign(featureIds);
+    am->insertOrAssign(phases);
+    am->insertOrAssign(eulers);
+    am->insertOrAssign(eigenstrains);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Reads a dataset back through the HDF5 filter pipeline and checks its layout and filters
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void CheckChunkedDataset(hid_t gid, const IDataArray::Pointer& source, hid_t memType)
+  {
+    std::string name = source->getName().toStdString();
+    hid_t did = H5Dopen(gid, name.c_str(), H5P_DEFAULT);
+    DREAM3D_REQUIRED(did, >=, 0)
+    hid_t dcpl = H5Dget_create_plist(did);
+    DREAM3D_REQUIRE_EQUAL(H5Pget_layout(dcpl), H5D_CHUNKED)
+    std::vector<hsize_t> chunkDims(4, 0);
+    int rank = H5Pget_chunk(dcpl, 4, chunkDims.data());
+    DREAM3D_REQUIRED(rank, ==, 4)
+    DREAM3D_REQUIRED(chunkDims[0], ==, 2)
+    DREAM3D_REQUIRED(chunkDims[1], ==, 2)
+    DREAM3D_REQUIRED(chunkDims[2], ==, 4)
+    DREAM3D_REQUIRED(chunkDims[3], ==, source->getNumberOfComponents())
+    DREAM3D_REQUIRED(H5Pget_nfilters(dcpl), ==, 2)
+    H5Pclose(dcpl);
+
+    size_t numValues = source->getSize();
+    std::vector<T> values(numValues);
+    herr_t err = H5Dread(did, memType, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data());
+    H5Dclose(did);
+    DREAM3D_REQUIRED(err, >=, 0)
+    const T* expected = static_cast<const T*>(source->getVoidPointer(0));
+    for(size_t i = 0; i < numValues; i++)
+    {
+      DREAM3D_REQUIRED(values[i], ==, expected[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestChunkedCompression()
+  {
+    DataContainerArray::Pointer dca = CreateTestData();
+    FFTHDFWriterFilter::Pointer filter = FFTHDFWriterFilter::New();
+    filter->setDataContainerArray(dca);
+    filter->setOutputFile(UnitTest::FFTHDFWriterFilterTest::TestFile1);
+    filter->setWriteEigenstrains(true);
+    filter->setEigenstrainsOutputFile(UnitTest::FFTHDFWriterFilterTest::TestFile2);
+    filter->setFeatureIdsArrayPath(DataArrayPath("DataContainer", "CellData", "FeatureIds"));
+    filter->setCellPhasesArrayPath(DataArrayPath("DataContainer", "CellData", "Phases"));
+    filter->setCellEulerAnglesArrayPath(DataArrayPath("DataContainer", "CellData", "EulerAngles"));
+    filter->setCellEigenstrainsArrayPath(DataArrayPath("DataContainer", "CellData", "Eigenstrains"));
+    filter->setUseChunkedCompression(true);
+    // 4x2x2 chunks do not divide the 7x5x3 volume, so every dimension has partial edge chunks
+    filter->setChunkDimensions(IntVec3Type(4, 2, 2));
+    filter->setCompressionLevel(6);
+    filter->setUseShuffleFilter(true);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), ==, 0)
+
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    {
+      hid_t fileId = QH5Utilities::openFile(UnitTest::FFTHDFWriterFilterTest::TestFile1, true);
+      DREAM3D_REQUIRED(fileId, >=, 0)
+      H5ScopedFileSentinel sentinel(fileId, true);
+      hid_t gid = QH5Utilities::openHDF5Object(fileId, SIMPL::StringConstants::DataContainerGroupName);
+      DREAM3D_REQUIRED(gid, >=, 0)
+      sentinel.addGroupId(gid);
+      CheckChunkedDataset<int32_t>(gid, am->getAttributeArray("FeatureIds"), H5T_NATIVE_INT32);
+      CheckChunkedDataset<int32_t>(gid, am->getAttributeArray("Phases"), H5T_NATIVE_INT32);
+      CheckChunkedDataset<float>(gid, am->getAttributeArray("EulerAngles"), H5T_NATIVE_FLOAT);
+    }
+    {
+      hid_t fileId = QH5Utilities::openFile(UnitTest::FFTHDFWriterFilterTest::TestFile2, true);
+      DREAM3D_REQUIRED(fileId, >=, 0)
+      H5ScopedFileSentinel sentinel(fileId, true);
+      hid_t gid = QH5Utilities::openHDF5Object(fileId, SIMPL::StringConstants::DataContainerGroupName);
+      DREAM3D_REQUIRED(gid, >=, 0)
+      sentinel.addGroupId(gid);
+      CheckChunkedDataset<int32_t>(gid, am->getAttributeArray("FeatureIds"), H5T_NATIVE_INT32);
+      CheckChunkedDataset<float>(gid, am->getAttributeArray("Eigenstrains"), H5T_NATIVE_FLOAT);
+    }
+
+    filter->setCompressionLevel(10);
+    filter->preflight();
+    DREAM3D_REQUIRED(filter->getErrorCode(), ==, -11116)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -94,6 +226,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestFFTHDFWriterFilterTest())
+    DREAM3D_REGISTER_TEST(TestChunkedCompression())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
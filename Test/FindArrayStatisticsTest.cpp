@@ -0,0 +1,215 @@
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "DREAM3DReview/DREAM3DReviewFilters/FindArrayStatistics.h"
+#include "DREAM3DReviewTestFileLocations.h"
+
+class FindArrayStatisticsTest
+{
+  const QString k_DataContainerName = {"DataContainer"};
+  const QString k_CellAttributeMatrixName = {"CellData"};
+  const QString k_FeatureAttributeMatrixName = {"FeatureData"};
+  const QString k_StatisticsAttributeMatrixName = {"Statistics"};
+  const QString k_FeatureIdsArrayName = {"FeatureIds"};
+  const QString k_DataArrayName = {"Data"};
+  const QString k_MaskArrayName = {"Mask"};
+  const size_t k_NumFeatures = 4;
+  const float k_Constant = 2.5f;
+
+  // Feature 0 only has a masked tuple, feature 1 has the values 1 - 4 and a masked outlier,
+  // feature 2 has a single value and feature 3 is constant
+  const std::vector<int32_t> k_FeatureIds = {0, 1, 1, 1, 1, 1, 2, 3, 3, 3, 3};
+  const std::vector<float> k_Data = {100.0f, 3.0f, 1.0f, 1000.0f, 4.0f, 2.0f, 7.0f, 2.5f, 2.5f, 2.5f, 2.5f};
+  const std::vector<bool> k_Mask = {false, true, true, false, true, true, true, true, true, true, true};
+
+  // Expected per feature values; the standard deviation is the population standard deviation
+  const std::vector<size_t> k_Length = {0, 4, 1, 4};
+  const std::vector<float> k_Min = {0.0f, 1.0f, 7.0f, 2.5f};
+  const std::vector<float> k_Max = {0.0f, 4.0f, 7.0f, 2.5f};
+  const std::vector<float> k_Mean = {0.0f, 2.5f, 7.0f, 2.5f};
+  const std::vector<float> k_Median = {0.0f, 2.5f, 7.0f, 2.5f};
+  const std::vector<float> k_StdDeviation = {0.0f, 1.118034f, 0.0f, 0.0f};
+  const std::vector<float> k_Summation = {0.0f, 10.0f, 7.0f, 10.0f};
+  // 25th and 75th percentiles, interpolated between the closest ranks
+  const std::vector<float> k_Percentiles = {0.0f, 0.0f, 1.75f, 3.25f, 7.0f, 7.0f, 2.5f, 2.5f};
+
+public:
+  FindArrayStatisticsTest() = default;
+  virtual ~FindArrayStatisticsTest() = default;
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataStructure()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+    dca->addOrReplaceDataContainer(dc);
+
+    std::vector<size_t> tupleDims = {k_Data.size()};
+    AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tupleDims, k_CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAm);
+
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(tupleDims[0], k_FeatureIdsArrayName, true);
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(tupleDims[0], k_DataArrayName, true);
+    BoolArrayType::Pointer mask = BoolArrayType::CreateArray(tupleDims[0], k_MaskArrayName, true);
+    for(size_t i = 0; i < tupleDims[0]; i++)
+    {
+      featureIds->setValue(i, k_FeatureIds[i]);
+      data->setValue(i, k_Data[i]);
+      mask->setValue(i, k_Mask[i]);
+    }
+    cellAm->addOrReplaceAttributeArray(featureIds);
+    cellAm->addOrReplaceAttributeArray(data);
+    cellAm->addOrReplaceAttributeArray(mask);
+
+    AttributeMatrix::Pointer featureAm = AttributeMatrix::New({k_NumFeatures}, k_FeatureAttributeMatrixName, AttributeMatrix::Type::CellFeature);
+    dc->addOrReplaceAttributeMatrix(featureAm);
+
+    AttributeMatrix::Pointer statisticsAm = AttributeMatrix::New({1}, k_StatisticsAttributeMatrixName, AttributeMatrix::Type::Generic);
+    dc->addOrReplaceAttributeMatrix(statisticsAm);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  FindArrayStatistics::Pointer createFilter(const DataContainerArray::Pointer& dca)
+  {
+    FindArrayStatistics::Pointer filter = FindArrayStatistics::New();
+    filter->setDataContainerArray(dca);
+    filter->setSelectedArrayPath({k_DataContainerName, k_CellAttributeMatrixName, k_DataArrayName});
+    filter->setFindLength(true);
+    filter->setFindMin(true);
+    filter->setFindMax(true);
+    filter->setFindMean(true);
+    filter->setFindMedian(true);
+    filter->setFindStdDeviation(true);
+    filter->setFindSummation(true);
+    filter->setFindPercentiles(true);
+    filter->setPercentiles("25, 75");
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestExecutionByFeature()
+  {
+    DataContainerArray::Pointer dca = createDataStructure();
+    FindArrayStatistics::Pointer filter = createFilter(dca);
+    filter->setComputeByIndex(true);
+    filter->setFeatureIdsArrayPath({k_DataContainerName, k_CellAttributeMatrixName, k_FeatureIdsArrayName});
+    filter->setUseMask(true);
+    filter->setMaskArrayPath({k_DataContainerName, k_CellAttributeMatrixName, k_MaskArrayName});
+    filter->setDestinationAttributeMatrix({k_DataContainerName, k_FeatureAttributeMatrixName, ""});
+    filter->execute();
+    int32_t err = filter->getErrorCode();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    AttributeMatrix::Pointer am = dca->getDataContainer(k_DataContainerName)->getAttributeMatrix(k_FeatureAttributeMatrixName);
+
+    SizeTArrayType::Pointer lengthArray = am->getAttributeArrayAs<SizeTArrayType>("Length");
+    FloatArrayType::Pointer minArray = am->getAttributeArrayAs<FloatArrayType>("Minimum");
+    FloatArrayType::Pointer maxArray = am->getAttributeArrayAs<FloatArrayType>("Maximum");
+    FloatArrayType::Pointer meanArray = am->getAttributeArrayAs<FloatArrayType>("Mean");
+    FloatArrayType::Pointer medianArray = am->getAttributeArrayAs<FloatArrayType>("Median");
+    FloatArrayType::Pointer stdDevArray = am->getAttributeArrayAs<FloatArrayType>("StandardDeviation");
+    FloatArrayType::Pointer sumArray = am->getAttributeArrayAs<FloatArrayType>("Summation");
+    FloatArrayType::Pointer percentilesArray = am->getAttributeArrayAs<FloatArrayType>("Percentiles");
+    DREAM3D_REQUIRE_VALID_POINTER(lengthArray.get())
+    DREAM3D_REQUIRE_VALID_POINTER(minArray.get())
+    DREAM3D_REQUIRE_VALID_POINTER(maxArray.get())
+    DREAM3D_REQUIRE_VALID_POINTER(meanArray.get())
+    DREAM3D_REQUIRE_VALID_POINTER(medianArray.get())
+    DREAM3D_REQUIRE_VALID_POINTER(stdDevArray.get())
+    DREAM3D_REQUIRE_VALID_POINTER(sumArray.get())
+    DREAM3D_REQUIRE_VALID_POINTER(percentilesArray.get())
+
+    for(size_t i = 0; i < k_NumFeatures; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(k_Length[i], (*lengthArray)[i])
+      DREAM3D_REQUIRE_EQUAL(k_Min[i], (*minArray)[i])
+      DREAM3D_REQUIRE_EQUAL(k_Max[i], (*maxArray)[i])
+      DREAM3D_REQUIRE_EQUAL(k_Mean[i], (*meanArray)[i])
+      DREAM3D_REQUIRE_EQUAL(k_Median[i], (*medianArray)[i])
+      DREAM3D_REQUIRED(std::fabs(k_StdDeviation[i] - (*stdDevArray)[i]), <=, 1.0E-6f)
+      DREAM3D_REQUIRE_EQUAL(k_Summation[i], (*sumArray)[i])
+      DREAM3D_REQUIRE_EQUAL(k_Percentiles[2 * i], percentilesArray->getComponent(i, 0))
+      DREAM3D_REQUIRE_EQUAL(k_Percentiles[2 * i + 1], percentilesArray->getComponent(i, 1))
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestConstantArray()
+  {
+    // A constant array has zero range; the median and percentiles must be the constant itself for both
+    // the exact selection and the approximate quantile sketch
+    for(bool approximate : {false, true})
+    {
+      DataContainerArray::Pointer dca = createDataStructure();
+      FloatArrayType::Pointer data = dca->getDataContainer(k_DataContainerName)->getAttributeMatrix(k_CellAttributeMatrixName)->getAttributeArrayAs<FloatArrayType>(k_DataArrayName);
+      data->initializeWithValue(k_Constant);
+
+      FindArrayStatistics::Pointer filter = createFilter(dca);
+      filter->setUseApproximateQuantiles(approximate);
+      filter->setDestinationAttributeMatrix({k_DataContainerName, k_StatisticsAttributeMatrixName, ""});
+      filter->execute();
+      int32_t err = filter->getErrorCode();
+      DREAM3D_REQUIRED(err, >=, 0)
+
+      AttributeMatrix::Pointer am = dca->getDataContainer(k_DataContainerName)->getAttributeMatrix(k_StatisticsAttributeMatrixName);
+
+      SizeTArrayType::Pointer lengthArray = am->getAttributeArrayAs<SizeTArrayType>("Length");
+      FloatArrayType::Pointer minArray = am->getAttributeArrayAs<FloatArrayType>("Minimum");
+      FloatArrayType::Pointer maxArray = am->getAttributeArrayAs<FloatArrayType>("Maximum");
+      FloatArrayType::Pointer meanArray = am->getAttributeArrayAs<FloatArrayType>("Mean");
+      FloatArrayType::Pointer medianArray = am->getAttributeArrayAs<FloatArrayType>("Median");
+      FloatArrayType::Pointer stdDevArray = am->getAttributeArrayAs<FloatArrayType>("StandardDeviation");
+      FloatArrayType::Pointer percentilesArray = am->getAttributeArrayAs<FloatArrayType>("Percentiles");
+      DREAM3D_REQUIRE_VALID_POINTER(lengthArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(minArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(maxArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(meanArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(medianArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(stdDevArray.get())
+      DREAM3D_REQUIRE_VALID_POINTER(percentilesArray.get())
+
+      DREAM3D_REQUIRE_EQUAL(k_Data.size(), (*lengthArray)[0])
+      DREAM3D_REQUIRE_EQUAL(k_Constant, (*minArray)[0])
+      DREAM3D_REQUIRE_EQUAL(k_Constant, (*maxArray)[0])
+      DREAM3D_REQUIRE_EQUAL(k_Constant, (*meanArray)[0])
+      DREAM3D_REQUIRE_EQUAL(k_Constant, (*medianArray)[0])
+      DREAM3D_REQUIRE_EQUAL(0.0f, (*stdDevArray)[0])
+      DREAM3D_REQUIRE_EQUAL(k_Constant, percentilesArray->getComponent(0, 0))
+      DREAM3D_REQUIRE_EQUAL(k_Constant, percentilesArray->getComponent(0, 1))
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "###### FindArrayStatisticsTest ######" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestExecutionByFeature())
+    DREAM3D_REGISTER_TEST(TestConstantArray())
+  }
+
+public:
+  FindArrayStatisticsTest(const FindArrayStatisticsTest&) = delete;            // Copy Constructor Not Implemented
+  FindArrayStatisticsTest(FindArrayStatisticsTest&&) = delete;                 // Move Constructor Not Implemented
+  FindArrayStatisticsTest& operator=(const FindArrayStatisticsTest&) = delete; // Copy Assignment Not Implemented
+  FindArrayStatisticsTest& operator=(FindArrayStatisticsTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -163,6 +163,34 @@ public:
     DREAM3D_REQUIRE(TestSum<uint32_t>() == 21474836465);
   }
 
+  // -----------------------------------------------------------------------------
+  void TestQuantileSketch()
+  {
+    // A constant float array has zero range; the approximate median and percentiles must be the constant itself
+    const float constant = 2.5f;
+    std::vector<float> values(1001, constant);
+    StatisticsHelpers::HistogramQuantileSketch<float> constantSketch(constant, constant, 65536);
+    for(float value : values)
+    {
+      constantSketch.add(value);
+    }
+    DREAM3D_REQUIRE_EQUAL(constantSketch.quantile(50.0f), constant)
+    DREAM3D_REQUIRE_EQUAL(constantSketch.quantile(0.0f), constant)
+    DREAM3D_REQUIRE_EQUAL(constantSketch.quantile(99.0f), constant)
+    DREAM3D_REQUIRE_EQUAL(constantSketch.quantile(100.0f), constant)
+    DREAM3D_REQUIRE_EQUAL(StatisticsHelpers::findPercentileInPlace(values.begin(), values.end(), 50.0f), constant)
+
+    // Interpolated quantiles never leave the [min, max] range of the data
+    StatisticsHelpers::HistogramQuantileSketch<float> rampSketch(0.0f, 10.0f, 4);
+    for(size_t i = 0; i <= 10; i++)
+    {
+      rampSketch.add(static_cast<float>(i));
+    }
+    DREAM3D_REQUIRED(rampSketch.quantile(0.0f), >=, 0.0f)
+    DREAM3D_REQUIRED(rampSketch.quantile(100.0f), <=, 10.0f)
+    DREAM3D_REQUIRED(std::fabs(rampSketch.quantile(50.0f) - 5.0f), <=, 2.5f)
+  }
+
   // -----------------------------------------------------------------------------
   int TestExecution()
   {
@@ -271,6 +299,7 @@ public:
 
     DREAM3D_REGISTER_TEST(TestExecution())
     DREAM3D_REGISTER_TEST(TestStatisticHelper())
+    DREAM3D_REGISTER_TEST(TestQuantileSketch())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
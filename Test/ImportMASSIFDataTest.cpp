@@ -6,16 +6,29 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Utilities/StringOperations.h"
 #include "UnitTestSupport.hpp"
 
+#include "H5Support/H5Utilities.h"
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "DREAM3DReview/DREAM3DReviewConstants.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/ImportMASSIFData.h"
+#include "DREAM3DReview/DREAM3DReviewFilters/util/MASSIFStepReader.h"
+
 #include "DREAM3DReviewTestFileLocations.h"
 
+namespace MassifConstants = MASSIFUtilitiesConstants::ImportMassifData;
+
 class ImportMASSIFDataTest
 {
 
@@ -23,14 +36,17 @@ public:
   ImportMASSIFDataTest() = default;
   virtual ~ImportMASSIFDataTest() = default;
 
+  const QString k_MassifFile = UnitTest::TestTempDir + "/ImportMASSIFDataTest.h5";
+  const QString k_FilePrefix = "Step-";
+  const std::vector<hsize_t> k_FieldDims = {2, 3, 4};
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
   void RemoveTestFiles()
   {
 #if REMOVE_TEST_FILES
-    // QFile::remove(UnitTest::ImportMASSIFDataTest::TestFile1);
-    // QFile::remove(UnitTest::ImportMASSIFDataTest::TestFile2);
+    QFile::remove(k_MassifFile);
 #endif
   }
 
@@ -82,6 +98,153 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString stepName(int32_t step) const
+  {
+    return k_FilePrefix + StringOperations::GenerateIndexString(step, MassifConstants::MaxStepNumber);
+  }
+
+  // -----------------------------------------------------------------------------
+  // Writes steps 1 through 4 in the MASSIF layout; every value encodes its step and tuple index
+  // -----------------------------------------------------------------------------
+  void PrepareMassifFile()
+  {
+    hid_t fileId = QH5Utilities::createFile(k_MassifFile);
+    DREAM3D_REQUIRED(fileId, >=, 0)
+
+    const size_t numTuples = k_FieldDims[0] * k_FieldDims[1] * k_FieldDims[2];
+    for(int32_t step = 1; step <= 4; step++)
+    {
+      QString stepPath = "/" + MassifConstants::DCGrpName + "/" + stepName(step);
+      QString geomPath = stepPath + "/" + MassifConstants::GeometryGrpName;
+      QString pointPath = stepPath + "/" + MassifConstants::Datapoint;
+      QStringList groupPaths = {geomPath, pointPath + "/" + MassifConstants::DFieldsGrpName, pointPath + "/" + MassifConstants::EFieldsGrpName, pointPath + "/" + MassifConstants::SFieldsGrpName,
+                                pointPath + "/" + MassifConstants::EulerAngleGrpName};
+      for(const auto& groupPath : groupPaths)
+      {
+        DREAM3D_REQUIRED(H5Utilities::createGroupsFromPath(groupPath.toStdString(), fileId), >=, 0)
+      }
+
+      hsize_t geomDims[1] = {3};
+      std::vector<size_t> dimension = {k_FieldDims[2], k_FieldDims[1], k_FieldDims[0]};
+      std::vector<float> origin = {0.0f, 0.0f, 0.0f};
+      std::vector<float> spacing = {1.0f, 1.0f, 1.0f};
+      DREAM3D_REQUIRED(QH5Lite::writePointerDataset(fileId, geomPath + "/" + MassifConstants::DimGrpName, 1, geomDims, dimension.data()), >=, 0)
+      DREAM3D_REQUIRED(QH5Lite::writePointerDataset(fileId, geomPath + "/" + MassifConstants::OriginGrpName, 1, geomDims, origin.data()), >=, 0)
+      DREAM3D_REQUIRED(QH5Lite::writePointerDataset(fileId, geomPath + "/" + MassifConstants::SpacingGrpName, 1, geomDims, spacing.data()), >=, 0)
+
+      std::vector<float> field(numTuples);
+      std::vector<int32_t> ids(numTuples);
+      for(size_t i = 0; i < numTuples; i++)
+      {
+        field[i] = static_cast<float>(step * 1000 + i);
+        ids[i] = static_cast<int32_t>(step * 100 + i);
+      }
+      QStringList fieldPaths = {pointPath + "/" + MassifConstants::DFieldsGrpName + "/" + MassifConstants::DField,
+                                pointPath + "/" + MassifConstants::EFieldsGrpName + "/" + MassifConstants::EField,
+                                pointPath + "/" + MassifConstants::SFieldsGrpName + "/" + MassifConstants::SField,
+                                pointPath + "/" + MassifConstants::DFieldsGrpName + "/" + MassifConstants::EVM,
+                                pointPath + "/" + MassifConstants::SFieldsGrpName + "/" + MassifConstants::SVM,
+                                pointPath + "/" + MassifConstants::EulerAngleGrpName + "/" + MassifConstants::Phi1,
+                                pointPath + "/" + MassifConstants::EulerAngleGrpName + "/" + MassifConstants::Phi,
+                                pointPath + "/" + MassifConstants::EulerAngleGrpName + "/" + MassifConstants::Phi2};
+      for(const auto& fieldPath : fieldPaths)
+      {
+        DREAM3D_REQUIRED(QH5Lite::writePointerDataset(fileId, fieldPath, 3, k_FieldDims.data(), field.data()), >=, 0)
+      }
+      DREAM3D_REQUIRED(QH5Lite::writePointerDataset(fileId, pointPath + "/" + MassifConstants::GrainID, 3, k_FieldDims.data(), ids.data()), >=, 0)
+      DREAM3D_REQUIRED(QH5Lite::writePointerDataset(fileId, pointPath + "/" + MassifConstants::Phase, 3, k_FieldDims.data(), ids.data()), >=, 0)
+    }
+    QH5Utilities::closeFile(fileId);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestImportStepRange()
+  {
+    ImportMASSIFData::Pointer filter = ImportMASSIFData::New();
+    filter->setMassifInputFilePath(k_MassifFile);
+    filter->setFilePrefix(k_FilePrefix);
+    filter->setImportStepRange(true);
+    filter->setStepNumber(1);
+    filter->setEndStepNumber(4);
+    filter->setStepIncrement(2);
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      filter->setDataContainerArray(dca);
+      filter->preflight();
+      DREAM3D_REQUIRED(filter->getErrorCode(), ==, 0)
+      DataContainer::Pointer dc = dca->getDataContainer(MassifConstants::MassifDC);
+      DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+      DREAM3D_REQUIRE_VALID_POINTER(dc->getAttributeMatrix(stepName(3)).get())
+    }
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      filter->setDataContainerArray(dca);
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCode(), ==, 0)
+
+      DataContainer::Pointer dc = dca->getDataContainer(MassifConstants::MassifDC);
+      SizeVec3Type dims = dc->getGeometryAs<ImageGeom>()->getDimensions();
+      DREAM3D_REQUIRED(dims[0], ==, k_FieldDims[2])
+      DREAM3D_REQUIRED(dims[1], ==, k_FieldDims[1])
+      DREAM3D_REQUIRED(dims[2], ==, k_FieldDims[0])
+
+      // Steps 1 and 3 are imported; steps 2 and 4 fall between the increments
+      DREAM3D_REQUIRED(dc->getAttributeMatrixNames().size(), ==, 2)
+      DREAM3D_REQUIRE_EQUAL(dc->doesAttributeMatrixExist(stepName(2)), false)
+      DREAM3D_REQUIRE_EQUAL(dc->doesAttributeMatrixExist(stepName(4)), false)
+      for(int32_t step : {1, 3})
+      {
+        AttributeMatrix::Pointer am = dc->getAttributeMatrix(stepName(step));
+        DREAM3D_REQUIRE_VALID_POINTER(am.get())
+        FloatArrayType::Pointer field = am->getAttributeArrayAs<FloatArrayType>(MassifConstants::SField);
+        Int32ArrayType::Pointer ids = am->getAttributeArrayAs<Int32ArrayType>(MassifConstants::GrainID);
+        DREAM3D_REQUIRE_VALID_POINTER(field.get())
+        DREAM3D_REQUIRE_VALID_POINTER(ids.get())
+        size_t last = field->getNumberOfTuples() - 1;
+        DREAM3D_REQUIRED(last, ==, 23)
+        DREAM3D_REQUIRED(field->getValue(0), ==, static_cast<float>(step * 1000))
+        DREAM3D_REQUIRED(field->getValue(last), ==, static_cast<float>(step * 1000 + last))
+        DREAM3D_REQUIRED(ids->getValue(last), ==, static_cast<int32_t>(step * 100 + last))
+      }
+    }
+    {
+      filter->setStepNumber(5);
+      filter->setEndStepNumber(9);
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      filter->setDataContainerArray(dca);
+      filter->preflight();
+      DREAM3D_REQUIRED(filter->getErrorCode(), ==, -3013)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStepCache()
+  {
+    MASSIFStepReader reader(k_MassifFile, k_FilePrefix, 1);
+    AttributeMatrix::Pointer step1 = reader.getStep(1);
+    DREAM3D_REQUIRE_VALID_POINTER(step1.get())
+    DREAM3D_REQUIRE_EQUAL(reader.getStep(1).get(), step1.get())
+
+    // With room for a single step, reading step 3 evicts step 1 so it is read again
+    AttributeMatrix::Pointer step3 = reader.getStep(3);
+    DREAM3D_REQUIRE_VALID_POINTER(step3.get())
+    FloatArrayType::Pointer field = step3->getAttributeArrayAs<FloatArrayType>(MassifConstants::DField);
+    DREAM3D_REQUIRED(field->getValue(0), ==, 3000.0f)
+    DREAM3D_REQUIRE_EQUAL(reader.getStep(3).get(), step3.get())
+    AttributeMatrix::Pointer step1Again = reader.getStep(1);
+    DREAM3D_REQUIRE_VALID_POINTER(step1Again.get())
+    DREAM3D_REQUIRE_EQUAL(step1Again.get() == step1.get(), false)
+
+    DREAM3D_REQUIRE_EQUAL(reader.getStep(7).get() == nullptr, true)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -93,6 +256,9 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestImportMASSIFDataTest())
+    DREAM3D_REGISTER_TEST(PrepareMassifFile())
+    DREAM3D_REGISTER_TEST(TestImportStepRange())
+    DREAM3D_REGISTER_TEST(TestStepCache())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
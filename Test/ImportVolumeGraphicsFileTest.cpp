@@ -59,6 +59,13 @@ public:
   const QString k_VolFile = UnitTest::TestTempDir + "/VolumeGraphicsTest.vol";
   const SizeVec3Type k_Dimensions = {50, 20, 80};
 
+  // -----------------------------------------------------------------------------
+  // Every voxel of the fixture holds a value that encodes its own position
+  static float VoxelValue(float x, float y, float z)
+  {
+    return x + 100.0F * y + 10000.0F * z;
+  }
+
   // -----------------------------------------------------------------------------
   void RemoveTestFiles()
   {
@@ -76,7 +83,14 @@ public:
     std::string volFile = k_VolFile.toStdString();
     FILE* f = fopen(volFile.c_str(), "wb");
     size_t count = k_Dimensions[0] * k_Dimensions[1] * k_Dimensions[2];
-    std::vector<float> data(count, 2.0F);
+    std::vector<float> data(count);
+    for(size_t i = 0; i < count; i++)
+    {
+      size_t x = i % k_Dimensions[0];
+      size_t y = (i / k_Dimensions[0]) % k_Dimensions[1];
+      size_t z = i / (k_Dimensions[0] * k_Dimensions[1]);
+      data[i] = VoxelValue(x, y, z);
+    }
     if(fwrite(data.data(), sizeof(float), count, f) != count)
     {
       DREAM3D_REQUIRE_EQUAL(1, 0)
@@ -142,13 +156,106 @@ public:
       FloatArrayType& data = *(am->getAttributeArrayAs<FloatArrayType>("Density"));
 
       size_t numTuples = data.getNumberOfTuples();
+      DREAM3D_REQUIRED(numTuples, ==, 80000)
       for(size_t i = 0; i < numTuples; i++)
       {
-        DREAM3D_REQUIRED(data[i], ==, 2.0F)
+        size_t x = i % k_Dimensions[0];
+        size_t y = (i / k_Dimensions[0]) % k_Dimensions[1];
+        size_t z = i / (k_Dimensions[0] * k_Dimensions[1]);
+        DREAM3D_REQUIRED(data[i], ==, VoxelValue(x, y, z))
       }
     }
   }
 
+  // -----------------------------------------------------------------------------
+  void TestSubvolumeStrideAndType()
+  {
+    // X 10..29 by 2, Y 5..14 by 3 (the last block is a single row) and Z 20..59 by 4
+    ImportVolumeGraphicsFile::Pointer filter = ImportVolumeGraphicsFile::New();
+    filter->setVGHeaderFile(QString(UnitTest::TestTempDir + "/VolumeGraphicsTest.vgi"));
+    filter->setImportSubvolume(true);
+    filter->setStartVoxelCoord({10, 5, 20});
+    filter->setEndVoxelCoord({29, 14, 59});
+    filter->setStride({2, 3, 4});
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      filter->setDataContainerArray(dca);
+      filter->execute();
+      int32_t err = filter->getErrorCode();
+      DREAM3D_REQUIRED(err, ==, 0)
+
+      DataContainer::Pointer dc = dca->getDataContainer("VolumeGraphics");
+      ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
+      SizeVec3Type dims = imageGeom->getDimensions();
+      DREAM3D_REQUIRED(dims[0], ==, 10)
+      DREAM3D_REQUIRED(dims[1], ==, 4)
+      DREAM3D_REQUIRED(dims[2], ==, 10)
+
+      // Without binning each output voxel is the first source voxel of its stride block
+      FloatArrayType& data = *(dc->getAttributeMatrix("CT Data")->getAttributeArrayAs<FloatArrayType>("Density"));
+      DREAM3D_REQUIRED(data.getNumberOfTuples(), ==, 400)
+      for(size_t oz = 0; oz < dims[2]; oz++)
+      {
+        for(size_t oy = 0; oy < dims[1]; oy++)
+        {
+          for(size_t ox = 0; ox < dims[0]; ox++)
+          {
+            size_t index = (oz * dims[1] + oy) * dims[0] + ox;
+            DREAM3D_REQUIRED(data[index], ==, VoxelValue(10 + 2 * ox, 5 + 3 * oy, 20 + 4 * oz))
+          }
+        }
+      }
+      DREAM3D_REQUIRED(data[0], ==, VoxelValue(10, 5, 20))
+      DREAM3D_REQUIRED(data[9], ==, VoxelValue(28, 5, 20))
+      DREAM3D_REQUIRED(data[30], ==, VoxelValue(10, 14, 20))
+      DREAM3D_REQUIRED(data[360], ==, VoxelValue(10, 5, 56))
+      DREAM3D_REQUIRED(data[399], ==, VoxelValue(28, 14, 56))
+    }
+    filter->setBinVoxels(true);
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      filter->setDataContainerArray(dca);
+      filter->execute();
+      int32_t err = filter->getErrorCode();
+      DREAM3D_REQUIRED(err, ==, 0)
+
+      // The fixture is linear in X, Y and Z, so each binned voxel holds the value at the center of its block
+      FloatArrayType& data = *(dca->getDataContainer("VolumeGraphics")->getAttributeMatrix("CT Data")->getAttributeArrayAs<FloatArrayType>("Density"));
+      DREAM3D_REQUIRED(data.getNumberOfTuples(), ==, 400)
+      DREAM3D_REQUIRED(data[0], ==, VoxelValue(10.5F, 6.0F, 21.5F))
+      DREAM3D_REQUIRED(data[9], ==, VoxelValue(28.5F, 6.0F, 21.5F))
+      DREAM3D_REQUIRED(data[30], ==, VoxelValue(10.5F, 14.0F, 21.5F))
+      DREAM3D_REQUIRED(data[360], ==, VoxelValue(10.5F, 6.0F, 57.5F))
+      DREAM3D_REQUIRED(data[399], ==, VoxelValue(28.5F, 14.0F, 57.5F))
+    }
+    {
+      filter->setOutputDataType(2);
+      filter->setDensityWindowMin(200000.0F);
+      filter->setDensityWindowMax(800000.0F);
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      filter->setDataContainerArray(dca);
+      filter->execute();
+      int32_t err = filter->getErrorCode();
+      DREAM3D_REQUIRED(err, ==, 0)
+
+      // (value - 200000) * 255 / 600000, rounded to the nearest integer
+      UInt8ArrayType::Pointer data = dca->getDataContainer("VolumeGraphics")->getAttributeMatrix("CT Data")->getAttributeArrayAs<UInt8ArrayType>("Density");
+      DREAM3D_REQUIRE_VALID_POINTER(data.get())
+      DREAM3D_REQUIRED(data->getValue(0), ==, 7)
+      DREAM3D_REQUIRED(data->getValue(160), ==, 75)
+      DREAM3D_REQUIRED(data->getValue(360), ==, 160)
+      DREAM3D_REQUIRED(data->getValue(399), ==, 160)
+    }
+    {
+      filter->setEndVoxelCoord({50, 14, 59});
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      filter->setDataContainerArray(dca);
+      filter->preflight();
+      int32_t err = filter->getErrorCode();
+      DREAM3D_REQUIRED(err, ==, -91508)
+    }
+  }
+
   // -----------------------------------------------------------------------------
   void operator()()
   {
@@ -157,6 +264,7 @@ public:
 
     DREAM3D_REGISTER_TEST(PrepareFiles())
     DREAM3D_REGISTER_TEST(TestFilter())
+    DREAM3D_REGISTER_TEST(TestSubvolumeStrideAndType())
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
 